@@ -0,0 +1,103 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+/**
+ * \page example_benchmark_multipleEvalFixedDimension_cpp Fixed-dimension multiple evaluation
+ * Compares the runtime-dimension kernels of OperationMultipleEvalLinear and
+ * OperationMultipleEvalModLinear with the compile-time specialized kernels of
+ * OperationMultipleEvalFixedDimension for all specialized dimensionalities.
+ */
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalFixedDimension.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalLinear.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalModLinear.hpp>
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::base::Grid;
+using sgpp::base::OperationMultipleEval;
+using sgpp::base::OperationMultipleEvalFixedDimension;
+
+/**
+ * Runs mult and multTranspose a few times and returns the average runtime of one pair in ms.
+ */
+double measure(OperationMultipleEval& op, DataVector& alpha, DataVector& values,
+               size_t repetitions) {
+  DataVector result(alpha.getSize());
+  auto begin = std::chrono::high_resolution_clock::now();
+
+  for (size_t r = 0; r < repetitions; r++) {
+    op.mult(alpha, values);
+    op.multTranspose(values, result);
+  }
+
+  auto end = std::chrono::high_resolution_clock::now();
+  return static_cast<double>(
+             std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count()) /
+         1000.0 / static_cast<double>(repetitions);
+}
+
+int main(int argc, char** argv) {
+  const size_t numberDataPoints = 20000;
+  const size_t repetitions = 5;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  std::cout << "grid, dim, level, grid size, runtime-d (ms), fixed-d (ms), speedup" << std::endl;
+
+  for (size_t dim = OperationMultipleEvalFixedDimension::MIN_DIMENSION;
+       dim <= OperationMultipleEvalFixedDimension::MAX_DIMENSION; dim++) {
+    // keep the grid size moderate for the higher dimensions
+    const size_t level = (dim <= 4) ? 6 : ((dim <= 8) ? 4 : 3);
+
+    DataMatrix dataset(numberDataPoints, dim);
+
+    for (size_t i = 0; i < dataset.getSize(); i++) {
+      dataset[i] = distribution(generator);
+    }
+
+    for (bool modified : {false, true}) {
+      std::unique_ptr<Grid> grid(modified ? Grid::createModLinearGrid(dim)
+                                          : Grid::createLinearGrid(dim));
+      grid->getGenerator().regular(level);
+
+      DataVector alpha(grid->getSize());
+
+      for (size_t i = 0; i < alpha.getSize(); i++) {
+        alpha[i] = distribution(generator);
+      }
+
+      DataVector values(numberDataPoints);
+      std::unique_ptr<OperationMultipleEval> runtimeOp;
+
+      if (modified) {
+        runtimeOp.reset(new sgpp::base::OperationMultipleEvalModLinear(*grid, dataset));
+      } else {
+        runtimeOp.reset(new sgpp::base::OperationMultipleEvalLinear(*grid, dataset));
+      }
+
+      OperationMultipleEvalFixedDimension fixedOp(*grid, dataset);
+
+      const double runtimeDuration = measure(*runtimeOp, alpha, values, repetitions);
+      const double fixedDuration = measure(fixedOp, alpha, values, repetitions);
+
+      std::cout << (modified ? "modlinear" : "linear") << ", " << dim << ", " << level << ", "
+                << grid->getSize() << ", " << std::fixed << std::setprecision(2)
+                << runtimeDuration << ", " << fixedDuration << ", "
+                << runtimeDuration / fixedDuration << std::endl;
+    }
+  }
+
+  return 0;
+}
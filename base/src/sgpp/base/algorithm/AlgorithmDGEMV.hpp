@@ -10,10 +10,15 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 
+#include <sgpp/base/algorithm/EvaluationMatrixCache.hpp>
 #include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
+#include <sgpp/base/algorithm/ScatterTransposed.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <cstdint>
+#include <limits>
 #include <vector>
 #include <utility>
 #include <iostream>
@@ -35,7 +40,9 @@ class AlgorithmDGEMV {
   /**
    * Performs the DGEMV Operation on the grid
    *
-   * This operation can be executed in parallel by setting the USEOMP define
+   * This operation can be executed in parallel by setting the USEOMP define. The grid points are
+   * split into one range per thread (see scatterTransposed()), so no thread needs a private
+   * copy of the result.
    *
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
@@ -45,23 +52,184 @@ class AlgorithmDGEMV {
    */
   void mult_transposed(GridStorage& storage, BASIS& basis,
                        const DataVector& source, DataMatrix& x, DataVector& result) {
+    result.setAll(0.0);
+
+    const double* source_data = source.getPointer();
+    double* result_data = result.getPointer();
+
+    scatterTransposed(storage.getSize(), source.getSize(), ScatterEvaluator(storage, basis, x),
+                      [source_data, result_data](size_t grid_point, size_t data_point,
+                                                 double value) {
+      result_data[grid_point] += value * source_data[data_point];
+    });
+  }
+
+  /**
+   * Performs the DGEMV Operation on the grid having a transposed matrix
+   *
+   * This operation can be executed in parallel by setting the USEOMP define
+   *
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vector of the matrix vector multiplication
+   */
+  void mult(GridStorage& storage, BASIS& basis, const DataVector& source,
+            DataMatrix& x, DataVector& result) {
     typedef std::vector<std::pair<size_t, double> > IndexValVector;
 
     result.setAll(0.0);
 
     #pragma omp parallel
     {
-      size_t source_size = source.getSize();
-      DataVector privateResult(result);
+      size_t result_size = result.getSize();
+
+      DataVector line(x.getNcols());
+      IndexValVector vec;
+
+      GetAffectedBasisFunctions<BASIS> ga(storage);
+
+      #pragma omp for schedule (static)
+
+      for (size_t i = 0; i < result_size; i++) {
+        vec.clear();
+
+        x.getRow(i, line);
+
+        ga(basis, line, vec);
+
+        for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
+          result[i] += iter->second * source[iter->first];
+        }
+      }
+    }
+  }
+
+  /**
+   * Performs the transposed DGEMV Operation on the grid like mult_transposed(), but uses the
+   * matrix stored in the cache if caching is enabled. If the matrix for the current grid and
+   * dataset has not been cached yet, it is built first. If it does not fit into the cache's memory
+   * budget, the basis functions are evaluated as usual.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vector of the matrix vector multiplication
+   * @param cache cache of the evaluation matrix
+   */
+  void mult_transposed(GridStorage& storage, BASIS& basis, const DataVector& source,
+                       DataMatrix& x, DataVector& result, EvaluationMatrixCache& cache) {
+    if (use_cache(storage, basis, x, cache)) {
+      cache.multTranspose(source, result);
+    } else {
+      mult_transposed(storage, basis, source, x, result);
+    }
+  }
+
+  /**
+   * Performs the DGEMV Operation on the grid like mult(), but uses the matrix stored in the cache
+   * if caching is enabled (see the cached variant of mult_transposed()).
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vector of the matrix vector multiplication
+   * @param cache cache of the evaluation matrix
+   */
+  void mult(GridStorage& storage, BASIS& basis, const DataVector& source, DataMatrix& x,
+            DataVector& result, EvaluationMatrixCache& cache) {
+    if (use_cache(storage, basis, x, cache)) {
+      cache.mult(source, result);
+    } else {
+      mult(storage, basis, source, x, result);
+    }
+  }
+
+  /**
+   * Prepares the cache for the grid and the dataset: the cached matrix is discarded if the grid or
+   * the dataset have changed and built if it is missing and fits into the memory budget.
+   * Kernels with a faster evaluation than mult() and mult_transposed() can use this to apply the
+   * cached matrix if possible and to fall back to their own evaluation otherwise.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param cache cache of the evaluation matrix
+   * @return true if caching is enabled and the cache holds the matrix for the grid and the dataset
+   */
+  bool use_cache(GridStorage& storage, BASIS& basis, DataMatrix& x,
+                 EvaluationMatrixCache& cache) {
+    if (!cache.isEnabled()) {
+      return false;
+    }
+
+    cache.synchronize(storage, x);
+
+    if (!cache.isBuilt() && !cache.exceedsMemoryBudget()) {
+      build_matrix(storage, basis, x, cache);
+    }
+
+    return cache.isBuilt();
+  }
+
+  /**
+   * Evaluates the basis functions at all data points and stores the resulting sparse matrix in
+   * the cache. If the matrix exceeds the memory budget of the cache, the evaluation is stopped and
+   * the cache is marked accordingly.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param cache cache the matrix is stored in
+   * @return true if the matrix has been stored
+   */
+  bool build_matrix(GridStorage& storage, BASIS& basis, DataMatrix& x,
+                    EvaluationMatrixCache& cache) {
+    typedef std::vector<std::pair<size_t, double> > IndexValVector;
+
+    size_t num_rows = x.getNrows();
+    size_t num_columns = storage.getSize();
+    size_t max_entries = cache.getMaxEntries();
+
+    if (num_rows > std::numeric_limits<uint32_t>::max() ||
+        num_columns > std::numeric_limits<uint32_t>::max()) {
+      cache.setExceedsMemoryBudget();
+      return false;
+    }
+
+    std::vector<size_t> row_pointers(num_rows + 1, 0);
+    std::vector<uint32_t> column_indices;
+    std::vector<double> values;
+    size_t num_entries = 0;
+    bool too_large = false;
+
+    #pragma omp parallel
+    {
       DataVector line(x.getNcols());
       IndexValVector vec;
       GetAffectedBasisFunctions<BASIS> ga(storage);
 
-      privateResult.setAll(0.0);
+      // entries of the contiguous block of rows processed by this thread
+      std::vector<uint32_t> private_indices;
+      std::vector<double> private_values;
+      size_t first_row = num_rows;
 
       #pragma omp for schedule(static)
 
-      for (size_t i = 0; i < source_size; i++) {
+      for (size_t i = 0; i < num_rows; i++) {
+        bool stop;
+        #pragma omp atomic read
+        stop = too_large;
+
+        if (stop) {
+          continue;
+        }
+
+        first_row = std::min(first_row, i);
         vec.clear();
 
         x.getRow(i, line);
@@ -69,73 +237,71 @@ class AlgorithmDGEMV {
         ga(basis, line, vec);
 
         for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
-          privateResult[iter->first] += iter->second * source[i];
+          private_indices.push_back(static_cast<uint32_t>(iter->first));
+          private_values.push_back(iter->second);
+        }
+
+        row_pointers[i + 1] = vec.size();
+
+        size_t total;
+        #pragma omp atomic capture
+        total = num_entries += vec.size();
+
+        if (total > max_entries) {
+          #pragma omp atomic write
+          too_large = true;
         }
       }
 
-      #pragma omp critical
+      #pragma omp single
       {
-        result.add(privateResult);
+        if (!too_large) {
+          for (size_t i = 0; i < num_rows; i++) {
+            row_pointers[i + 1] += row_pointers[i];
+          }
+
+          column_indices.resize(num_entries);
+          values.resize(num_entries);
+        }
+      }
+
+      if (!too_large && !private_indices.empty()) {
+        std::copy(private_indices.begin(), private_indices.end(),
+                  column_indices.begin() + row_pointers[first_row]);
+        std::copy(private_values.begin(), private_values.end(),
+                  values.begin() + row_pointers[first_row]);
       }
     }
-  }
-  // implementation requires OpenMP 4.0 support
-  //        void mult_transposed(GridStorage& storage, BASIS& basis,
-  //        const DataVector& source, DataMatrix& x, DataVector& result) {
-  //          typedef std::vector<std::pair<size_t, double> > IndexValVector;
-  //
-  //          result.setAll(0.0);
-  //          #pragma omp declare reduction(accumulate :
-  // ... sgpp::base::DataVector : omp_out.add(omp_in))
-  // ... initializer ( omp_priv = DataVector(omp_orig.getSize(), 0))
-  //
-  //
-  //          #pragma omp parallel
-  //          {
-  //            size_t source_size = source.getSize();
-  //            DataVector line(x.getNcols());
-  //            IndexValVector vec;
-  //            GetAffectedBasisFunctions<BASIS> ga(storage);
-  //
-  //
-  //            #pragma omp for reduction(accumulate:result) schedule(static)
-  //
-  //            for (size_t i = 0; i < source_size; i++) {
-  //              vec.clear();
-  //
-  //              x.getRow(i, line);
-  //
-  //              ga(basis, line, vec);
-  //
-  //              for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
-  //                result[iter->first] += iter->second * source[i];
-  //              }
-  //            }
-  //          }
-  //        }
 
+    if (too_large) {
+      cache.setExceedsMemoryBudget();
+      return false;
+    }
+
+    cache.setMatrix(row_pointers, column_indices, values, num_columns);
+    return true;
+  }
 
   /**
-   * Performs the DGEMV Operation on the grid having a transposed matrix
-   *
-   * This operation can be executed in parallel by setting the USEOMP define
-   *
+   * Performs the DGEMV Operation on the grid for several coefficient vectors at once. The basis
+   * functions are evaluated once per data point and applied to all columns of source.
    *
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
-   * @param source the coefficients of the grid points
+   * @param source the coefficients of the grid points, one column per function
    * @param x the d-dimensional vector with data points (row-wise)
-   * @param result the result vector of the matrix vector multiplication
+   * @param result the results, one row per data point and one column per function
    */
-  void mult(GridStorage& storage, BASIS& basis, const DataVector& source,
-            DataMatrix& x, DataVector& result) {
+  void mult_multiple(GridStorage& storage, BASIS& basis, const DataMatrix& source,
+                     DataMatrix& x, DataMatrix& result) {
     typedef std::vector<std::pair<size_t, double> > IndexValVector;
 
     result.setAll(0.0);
 
     #pragma omp parallel
     {
-      size_t result_size = result.getSize();
+      size_t result_size = result.getNrows();
+      size_t num_cols = source.getNcols();
 
       DataVector line(x.getNcols());
       IndexValVector vec;
@@ -151,12 +317,76 @@ class AlgorithmDGEMV {
 
         ga(basis, line, vec);
 
+        double* resultRow = result.getPointer() + i * num_cols;
+
         for (IndexValVector::iterator iter = vec.begin(); iter != vec.end(); iter++) {
-          result[i] += iter->second * source[iter->first];
+          const double* sourceRow = source.getPointer() + iter->first * num_cols;
+
+          for (size_t j = 0; j < num_cols; j++) {
+            resultRow[j] += iter->second * sourceRow[j];
+          }
         }
       }
     }
   }
+
+  /**
+   * Performs the transposed DGEMV Operation on the grid for several source vectors at once. The
+   * basis functions are evaluated once per data point and applied to all columns of source.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the values of the data points, one column per vector
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the results, one row per grid point and one column per vector
+   */
+  void mult_transposed_multiple(GridStorage& storage, BASIS& basis, const DataMatrix& source,
+                                DataMatrix& x, DataMatrix& result) {
+    result.setAll(0.0);
+
+    size_t num_cols = source.getNcols();
+    const double* source_data = source.getPointer();
+    double* result_data = result.getPointer();
+
+    scatterTransposed(storage.getSize(), source.getNrows(), ScatterEvaluator(storage, basis, x),
+                      [num_cols, source_data, result_data](size_t grid_point, size_t data_point,
+                                                           double value) {
+      const double* sourceRow = source_data + data_point * num_cols;
+      double* resultRow = result_data + grid_point * num_cols;
+
+      for (size_t j = 0; j < num_cols; j++) {
+        resultRow[j] += value * sourceRow[j];
+      }
+    });
+  }
+
+ private:
+  /**
+   * Evaluates the basis functions at a data point for scatterTransposed().
+   */
+  struct ScatterEvaluator {
+    ScatterEvaluator(GridStorage& storage, BASIS& basis, DataMatrix& x)
+        : basis(basis), x(x), line(x.getNcols()), ga(storage) {}
+
+    void operator()(size_t i, ScatterBuffer& buffer) {
+      vec.clear();
+
+      x.getRow(i, line);
+
+      ga(basis, line, vec);
+
+      for (std::vector<std::pair<size_t, double> >::iterator iter = vec.begin();
+           iter != vec.end(); iter++) {
+        buffer(iter->first, iter->second);
+      }
+    }
+
+    BASIS& basis;
+    DataMatrix& x;
+    DataVector line;
+    std::vector<std::pair<size_t, double> > vec;
+    GetAffectedBasisFunctions<BASIS> ga;
+  };
 };
 
 }  // namespace base
@@ -46,6 +46,20 @@ class AlgorithmEvaluationTransposed {
    * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
    */
   void operator()(BASIS& basis, const DataVector& point, double alpha, DataVector& result) {
+    AddOp op(alpha, result);
+    (*this)(basis, point, op);
+  }
+
+  /**
+   * Calls op(i, \f$\phi_i(x)\f$) for all basis functions that are non-zero at a given evaluation
+   * point.
+   *
+   * @param basis a sparse grid basis
+   * @param point evaluation point within the domain
+   * @param op functor receiving the sequence numbers and values of the basis functions
+   */
+  template <class OP>
+  void operator()(BASIS& basis, const DataVector& point, OP& op) {
     GridStorage::grid_iterator working(storage);
 
     const size_t bits = sizeof(index_t) * 8;  // how many levels can we store in a index_type?
@@ -76,13 +90,21 @@ class AlgorithmEvaluationTransposed {
       }
     }
 
-    rec(basis, newPoint, 0, 1.0, working, source, alpha, result);
+    rec(basis, newPoint, 0, 1.0, working, source, op);
     delete[] source;
   }
 
  protected:
   GridStorage& storage;
 
+  /// adds alpha * phi_i(x) to the result of grid point i
+  struct AddOp {
+    AddOp(double alpha, DataVector& result) : alpha(alpha), result(result) {}
+    inline void operator()(size_t seq, double value) { result[seq] += alpha * value; }
+    double alpha;
+    DataVector& result;
+  };
+
   /**
    * Recursive traversal of the "tree" of basis functions for evaluation, used in operator().
    * For a given evaluation point \f$x\f$, it stores tuples (std::pair) of
@@ -94,13 +116,12 @@ class AlgorithmEvaluationTransposed {
    * @param value the value of the evaluation of the current basis function up to (excluding) dimension current_dim (product of the evaluations of the one-dimensional ones)
    * @param working iterator working on the GridStorage of the basis
    * @param source array of indices for each dimension (identifying the indices of the current grid point)
-   * @param alpha the coefficient of current ansatzfunction
-   * @param result vector that will contain the local support of the given ansatzfuction for all evaluations points
+   * @param op functor receiving the sequence numbers and values of the basis functions
    */
+  template <class OP>
   void rec(BASIS& basis, DataVector& point, size_t current_dim,
            double value, GridStorage::grid_iterator& working,
-           index_t* source, double alpha,
-           DataVector& result) {
+           index_t* source, OP& op) {
     const unsigned int BITS_IN_BYTE = 8;
     // maximum possible level for the index type
     const level_t max_level = static_cast<level_t>(sizeof(index_t) * BITS_IN_BYTE - 1);
@@ -125,9 +146,9 @@ class AlgorithmEvaluationTransposed {
         const double new_value = basis.eval(work_level, work_index, point[current_dim]) * value;
 
         if (current_dim == storage.getDimension() - 1) {
-          result[seq] += alpha * new_value;
+          op(seq, new_value);
         } else {
-          rec(basis, point, current_dim + 1, new_value, working, source, alpha, result);
+          rec(basis, point, current_dim + 1, new_value, working, source, op);
           if (!hint) working.resetToLevelOne(current_dim+1);
         }
       }
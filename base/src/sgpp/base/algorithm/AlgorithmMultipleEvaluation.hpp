@@ -12,6 +12,7 @@
 
 #include <sgpp/base/algorithm/AlgorithmEvaluation.hpp>
 #include <sgpp/base/algorithm/AlgorithmEvaluationTransposed.hpp>
+#include <sgpp/base/algorithm/ScatterTransposed.hpp>
 
 #include <sgpp/globaldef.hpp>
 
@@ -38,6 +39,9 @@ class AlgorithmMultipleEvaluation {
   /**
    * Performs a transposed mass evaluation
    *
+   * The grid points are split into one range per thread (see scatterTransposed()), so no thread
+   * needs a private copy of the result.
+   *
    * @param storage GridStorage object that contains the grid's points information
    * @param basis a reference to a class that implements a specific basis
    * @param source the coefficients of the grid points
@@ -47,54 +51,15 @@ class AlgorithmMultipleEvaluation {
   void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source, DataMatrix& x,
                       DataVector& result) {
     result.setAll(0.0);
-    size_t source_size = source.getSize();
-
-#pragma omp parallel
-    {
-      DataVector privateResult(result.getSize());
-      privateResult.setAll(0.0);
-
-      DataVector line(x.getNcols());
-      AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
-
-      privateResult.setAll(0.0);
 
-#pragma omp for schedule(static)
-
-      for (size_t i = 0; i < source_size; i++) {
-        x.getRow(i, line);
+    const double* sourceData = source.getPointer();
+    double* resultData = result.getPointer();
 
-        AlgoEvalTrans(basis, line, source[i], privateResult);
-      }
-
-#pragma omp critical
-      { result.add(privateResult); }
-    }
+    scatterTransposed(storage.getSize(), source.getSize(), ScatterEvaluator(storage, basis, x),
+                      [sourceData, resultData](size_t gridPoint, size_t dataPoint, double value) {
+      resultData[gridPoint] += value * sourceData[dataPoint];
+    });
   }
-  // implementation requires OpenMP 4.0 support
-  //        void mult_transpose(GridStorage& storage, BASIS& basis, DataVector& source,
-  //                            DataMatrix& x, DataVector& result) {
-  //          result.setAll(0.0);
-  //          size_t source_size = source.getSize();
-  //
-  //          #pragma omp declare reduction(accumulate :
-  // ...      sgpp::base::DataVector : omp_out.add(omp_in))
-  // ...      initializer ( omp_priv = DataVector(omp_orig.getSize(), 0))
-  //
-  //          #pragma omp parallel
-  //          {
-  //            DataVector line(x.getNcols());
-  //            AlgorithmEvaluationTransposed<BASIS> AlgoEvalTrans(storage);
-  //
-  //            #pragma omp for reduction(accumulate:result) schedule(static)
-  //
-  //            for (size_t i = 0; i < source_size; i++) {
-  //              x.getRow(i, line);
-  //
-  //              AlgoEvalTrans(basis, line, source[i], result);
-  //            }
-  //          }
-  //        }
 
   /**
    * Performs a mass evaluation
@@ -124,6 +89,25 @@ class AlgorithmMultipleEvaluation {
       }
     }
   }
+
+ protected:
+  /**
+   * Evaluates the basis functions at a data point for scatterTransposed().
+   */
+  struct ScatterEvaluator {
+    ScatterEvaluator(GridStorage& storage, BASIS& basis, DataMatrix& x)
+        : basis(basis), x(x), line(x.getNcols()), algoEvalTrans(storage) {}
+
+    void operator()(size_t i, ScatterBuffer& buffer) {
+      x.getRow(i, line);
+      algoEvalTrans(basis, line, buffer);
+    }
+
+    BASIS& basis;
+    DataMatrix& x;
+    DataVector line;
+    AlgorithmEvaluationTransposed<BASIS> algoEvalTrans;
+  };
 };
 
 }  // namespace base
@@ -0,0 +1,235 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ALGORITHMMULTIPLEEVALUATIONFIXEDDIMENSION_HPP
+#define ALGORITHMMULTIPLEEVALUATIONFIXEDDIMENSION_HPP
+
+#include <sgpp/base/algorithm/ScatterTransposed.hpp>
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <array>
+#include <cmath>
+#include <type_traits>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Variant of AlgorithmMultipleEvaluation for a dimensionality DIM that is known at compile time.
+ *
+ * The recursive descent of AlgorithmEvaluation is unrolled over the dimensions by the compiler,
+ * the per-point index and coordinate buffers live on the stack instead of the heap and the 1D
+ * basis is called non-virtually, so it can be inlined into the traversal.
+ * Semantics are identical to AlgorithmMultipleEvaluation (points outside the bounding box
+ * evaluate to zero).
+ *
+ * @tparam BASIS 1D basis type of the grid (must not have boundary points)
+ * @tparam DIM dimensionality of the grid
+ */
+template <class BASIS, size_t DIM>
+class AlgorithmMultipleEvaluationFixedDimension {
+ public:
+  /**
+   * Performs a mass evaluation
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the grid points
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vector of the matrix vector multiplication
+   */
+  void mult(GridStorage& storage, BASIS& basis, const DataVector& source, const DataMatrix& x,
+            DataVector& result) {
+    const size_t resultSize = result.getSize();
+
+#pragma omp parallel
+    {
+      GridStorage::grid_iterator working(storage);
+      std::array<double, DIM> point;
+      std::array<index_t, DIM> path;
+
+#pragma omp for schedule(static)
+
+      for (size_t i = 0; i < resultSize; i++) {
+        double value = 0.0;
+
+        if (prepareRow(storage, x.getPointer() + i * DIM, point, path)) {
+          MultOp op(source, value);
+          rec(storage, basis, point, path, 1.0, working, op, std::integral_constant<size_t, 0>());
+        }
+
+        result[i] = value;
+      }
+    }
+  }
+
+  /**
+   * Performs a transposed mass evaluation
+   *
+   * The grid points are split into one range per thread (see scatterTransposed()), so no thread
+   * needs a private copy of the result.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param basis a reference to a class that implements a specific basis
+   * @param source the coefficients of the data points
+   * @param x the d-dimensional vector with data points (row-wise)
+   * @param result the result vector of the matrix vector multiplication
+   */
+  void mult_transpose(GridStorage& storage, BASIS& basis, const DataVector& source,
+                      const DataMatrix& x, DataVector& result) {
+    result.setAll(0.0);
+
+    const double* sourceData = source.getPointer();
+    double* resultData = result.getPointer();
+
+    scatterTransposed(storage.getSize(), source.getSize(),
+                      ScatterEvaluator(*this, storage, basis, x),
+                      [sourceData, resultData](size_t gridPoint, size_t dataPoint, double value) {
+      resultData[gridPoint] += value * sourceData[dataPoint];
+    });
+  }
+
+ protected:
+  /// accumulates alpha_i * phi_i(x) into a scalar
+  struct MultOp {
+    MultOp(const DataVector& alpha, double& result) : alpha(alpha), result(result) {}
+    inline void operator()(size_t seq, double value) { result += alpha[seq] * value; }
+    const DataVector& alpha;
+    double& result;
+  };
+
+  /// evaluates the basis functions at a data point for scatterTransposed()
+  struct ScatterEvaluator {
+    ScatterEvaluator(AlgorithmMultipleEvaluationFixedDimension& algorithm, GridStorage& storage,
+                     BASIS& basis, const DataMatrix& x)
+        : algorithm(algorithm), storage(storage), basis(basis), x(x), working(storage) {}
+
+    /// every thread gets a copy with its own iterator
+    ScatterEvaluator(const ScatterEvaluator& other)
+        : algorithm(other.algorithm),
+          storage(other.storage),
+          basis(other.basis),
+          x(other.x),
+          working(other.storage) {}
+
+    void operator()(size_t i, ScatterBuffer& buffer) {
+      if (prepareRow(storage, x.getPointer() + i * DIM, point, path)) {
+        algorithm.rec(storage, basis, point, path, 1.0, working, buffer,
+                      std::integral_constant<size_t, 0>());
+      }
+    }
+
+    AlgorithmMultipleEvaluationFixedDimension& algorithm;
+    GridStorage& storage;
+    BASIS& basis;
+    const DataMatrix& x;
+    GridStorage::grid_iterator working;
+    std::array<double, DIM> point;
+    std::array<index_t, DIM> path;
+  };
+
+  /**
+   * Transforms a data point to the unit cube and computes the index path used for the descent.
+   *
+   * @param storage GridStorage object that contains the grid's points information
+   * @param row pointer to the DIM coordinates of the data point
+   * @param point transformed coordinates
+   * @param path bit pattern of the descent in each dimension
+   * @return false if the point lies outside of the bounding box
+   */
+  static inline bool prepareRow(GridStorage& storage, const double* row,
+                                std::array<double, DIM>& point, std::array<index_t, DIM>& path) {
+    const size_t bits = sizeof(index_t) * 8;
+    BoundingBox* bb = storage.getBoundingBox();
+
+    for (size_t d = 0; d < DIM; d++) {
+      if (!bb->isContainingPoint(d, row[d])) {
+        return false;
+      }
+
+      point[d] = bb->transformPointToUnitCube(d, row[d]);
+      const double temp = std::floor(point[d] * static_cast<double>(1 << (bits - 2))) * 2.0;
+
+      if (point[d] == 1.0) {
+        path[d] = static_cast<index_t>(temp - 1);
+      } else {
+        path[d] = static_cast<index_t>(temp + 1);
+      }
+    }
+
+    return true;
+  }
+
+  /**
+   * Recursive traversal in dimension CUR, see AlgorithmEvaluation::rec.
+   */
+  template <size_t CUR, class OP>
+  inline void rec(GridStorage& storage, BASIS& basis, const std::array<double, DIM>& point,
+                  const std::array<index_t, DIM>& path, double value,
+                  GridStorage::grid_iterator& working, OP& op,
+                  std::integral_constant<size_t, CUR>) {
+    const level_t maxLevel = static_cast<level_t>(sizeof(index_t) * 8 - 1);
+    const index_t srcIndex = path[CUR];
+    level_t workLevel = 1;
+
+    while (true) {
+      const size_t seq = working.seq();
+
+      if (storage.isInvalidSequenceNumber(seq)) {
+        break;
+      }
+
+      index_t workIndex;
+      level_t temp;
+      working.get(CUR, temp, workIndex);
+
+      const double newValue = basis.BASIS::eval(workLevel, workIndex, point[CUR]) * value;
+      descend(storage, basis, point, path, newValue, seq, working, op,
+              std::integral_constant<size_t, CUR + 1>());
+
+      if (working.hint()) {
+        break;
+      }
+
+      const bool right = (srcIndex & (1 << (maxLevel - workLevel))) > 0;
+      workLevel++;
+
+      if (right) {
+        working.rightChild(CUR);
+      } else {
+        working.leftChild(CUR);
+      }
+    }
+
+    working.resetToLevelOne(CUR);
+  }
+
+  /// last dimension reached: hand the product of the 1D values to the accumulator
+  template <class OP>
+  inline void descend(GridStorage&, BASIS&, const std::array<double, DIM>&,
+                      const std::array<index_t, DIM>&, double value, size_t seq,
+                      GridStorage::grid_iterator&, OP& op,
+                      std::integral_constant<size_t, DIM>) {
+    op(seq, value);
+  }
+
+  /// continue the descent in the next dimension
+  template <size_t NEXT, class OP>
+  inline void descend(GridStorage& storage, BASIS& basis, const std::array<double, DIM>& point,
+                      const std::array<index_t, DIM>& path, double value, size_t,
+                      GridStorage::grid_iterator& working, OP& op,
+                      std::integral_constant<size_t, NEXT>) {
+    rec(storage, basis, point, path, value, working, op, std::integral_constant<size_t, NEXT>());
+  }
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* ALGORITHMMULTIPLEEVALUATIONFIXEDDIMENSION_HPP */
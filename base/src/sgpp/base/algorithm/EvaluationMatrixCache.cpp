@@ -0,0 +1,197 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/algorithm/EvaluationMatrixCache.hpp>
+#include <sgpp/base/exception/algorithm_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+template <typename T>
+void multCSR(const std::vector<size_t>& pointers, const std::vector<uint32_t>& indices,
+             const std::vector<T>& values, const DataVector& source, DataVector& result) {
+  size_t numRows = pointers.size() - 1;
+  const double* sourceData = source.getPointer();
+  double* resultData = result.getPointer();
+
+  #pragma omp parallel for schedule(static)
+
+  for (size_t i = 0; i < numRows; i++) {
+    double sum = 0.0;
+
+    for (size_t k = pointers[i]; k < pointers[i + 1]; k++) {
+      sum += values[k] * sourceData[indices[k]];
+    }
+
+    resultData[i] = sum;
+  }
+}
+
+}  // namespace
+
+EvaluationMatrixCache::EvaluationMatrixCache()
+    : enabled(false),
+      singlePrecision(false),
+      tooLarge(false),
+      memoryBudget(defaultMemoryBudget),
+      gridStorage(nullptr),
+      gridModificationCount(0),
+      gridSize(0),
+      datasetPointer(nullptr),
+      datasetRows(0),
+      numColumns(0) {}
+
+void EvaluationMatrixCache::enable(size_t memoryBudget, bool singlePrecision) {
+  if (enabled && (memoryBudget != this->memoryBudget || singlePrecision != this->singlePrecision)) {
+    clear();
+  }
+
+  enabled = true;
+  this->memoryBudget = memoryBudget;
+  this->singlePrecision = singlePrecision;
+}
+
+void EvaluationMatrixCache::disable() {
+  enabled = false;
+  clear();
+}
+
+bool EvaluationMatrixCache::isEnabled() const { return enabled; }
+
+void EvaluationMatrixCache::invalidate() { clear(); }
+
+void EvaluationMatrixCache::synchronize(GridStorage& storage, const DataMatrix& x) {
+  if (&storage != gridStorage || storage.getModificationCount() != gridModificationCount ||
+      x.getPointer() != datasetPointer || x.getNrows() != datasetRows) {
+    clear();
+    gridStorage = &storage;
+    gridModificationCount = storage.getModificationCount();
+    gridSize = storage.getSize();
+    datasetPointer = x.getPointer();
+    datasetRows = x.getNrows();
+  }
+}
+
+bool EvaluationMatrixCache::isBuilt() const { return !rowPointers.empty(); }
+
+bool EvaluationMatrixCache::exceedsMemoryBudget() const { return tooLarge; }
+
+size_t EvaluationMatrixCache::getMaxEntries() const {
+  size_t pointerBytes = (datasetRows + gridSize + 2) * sizeof(size_t);
+
+  if (pointerBytes >= memoryBudget) {
+    return 0;
+  }
+
+  return (memoryBudget - pointerBytes) / getBytesPerEntry();
+}
+
+void EvaluationMatrixCache::setMatrix(std::vector<size_t>& rowPointers,
+                                      std::vector<uint32_t>& columnIndices,
+                                      std::vector<double>& values, size_t numColumns) {
+  this->numColumns = numColumns;
+  this->rowPointers.swap(rowPointers);
+  this->columnIndices.swap(columnIndices);
+
+  if (singlePrecision) {
+    valuesSP.assign(values.begin(), values.end());
+    std::vector<double>().swap(values);
+    buildTranspose(valuesSP, transposedValuesSP);
+  } else {
+    this->values.swap(values);
+    buildTranspose(this->values, transposedValues);
+  }
+}
+
+void EvaluationMatrixCache::setExceedsMemoryBudget() {
+  clear();
+  tooLarge = true;
+}
+
+void EvaluationMatrixCache::mult(const DataVector& source, DataVector& result) const {
+  if (result.getSize() != rowPointers.size() - 1 || source.getSize() != numColumns) {
+    throw algorithm_exception("EvaluationMatrixCache::mult: dimensions do not match");
+  }
+
+  if (singlePrecision) {
+    multCSR(rowPointers, columnIndices, valuesSP, source, result);
+  } else {
+    multCSR(rowPointers, columnIndices, values, source, result);
+  }
+}
+
+void EvaluationMatrixCache::multTranspose(const DataVector& source, DataVector& result) const {
+  if (source.getSize() != rowPointers.size() - 1 || result.getSize() != numColumns) {
+    throw algorithm_exception("EvaluationMatrixCache::multTranspose: dimensions do not match");
+  }
+
+  if (singlePrecision) {
+    multCSR(columnPointers, rowIndices, transposedValuesSP, source, result);
+  } else {
+    multCSR(columnPointers, rowIndices, transposedValues, source, result);
+  }
+}
+
+size_t EvaluationMatrixCache::getMemoryUsage() const {
+  return (rowPointers.size() + columnPointers.size()) * sizeof(size_t) +
+         columnIndices.size() * getBytesPerEntry();
+}
+
+size_t EvaluationMatrixCache::getBytesPerEntry() const {
+  // index and value, for the row-wise and the column-wise storage
+  return 2 * (sizeof(uint32_t) + (singlePrecision ? sizeof(float) : sizeof(double)));
+}
+
+void EvaluationMatrixCache::clear() {
+  tooLarge = false;
+  numColumns = 0;
+  std::vector<size_t>().swap(rowPointers);
+  std::vector<uint32_t>().swap(columnIndices);
+  std::vector<double>().swap(values);
+  std::vector<float>().swap(valuesSP);
+  std::vector<size_t>().swap(columnPointers);
+  std::vector<uint32_t>().swap(rowIndices);
+  std::vector<double>().swap(transposedValues);
+  std::vector<float>().swap(transposedValuesSP);
+}
+
+template <typename T>
+void EvaluationMatrixCache::buildTranspose(const std::vector<T>& rowValues,
+                                           std::vector<T>& columnValues) {
+  size_t numRows = rowPointers.size() - 1;
+  size_t numEntries = columnIndices.size();
+
+  // counting sort of the entries by their column
+  columnPointers.assign(numColumns + 1, 0);
+
+  for (size_t k = 0; k < numEntries; k++) {
+    columnPointers[columnIndices[k] + 1]++;
+  }
+
+  for (size_t j = 0; j < numColumns; j++) {
+    columnPointers[j + 1] += columnPointers[j];
+  }
+
+  std::vector<size_t> position(columnPointers.begin(), columnPointers.end() - 1);
+  rowIndices.resize(numEntries);
+  columnValues.resize(numEntries);
+
+  for (size_t i = 0; i < numRows; i++) {
+    for (size_t k = rowPointers[i]; k < rowPointers[i + 1]; k++) {
+      size_t target = position[columnIndices[k]]++;
+      rowIndices[target] = static_cast<uint32_t>(i);
+      columnValues[target] = rowValues[k];
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
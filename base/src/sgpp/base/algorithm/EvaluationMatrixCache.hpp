@@ -0,0 +1,156 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef EVALUATIONMATRIXCACHE_HPP
+#define EVALUATIONMATRIXCACHE_HPP
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/GridStorage.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Stores the sparse matrix @f$(B)_{i,j} = \varphi_j(x_i)@f$ of the basis function values at a
+ * dataset, such that repeated multiplications with @f$B@f$ and @f$B^T@f$ on the same grid and
+ * dataset (e.g., in the iterations of a CG solver) do not need to search the affected basis
+ * functions of every data point again.
+ * The matrix is kept in compressed sparse row format for the multiplication with @f$B@f$ and
+ * additionally in compressed sparse column format, such that the multiplication with @f$B^T@f$
+ * can be parallelized over the grid points without private copies of the result.
+ *
+ * Caching is disabled by default. The matrix is built by AlgorithmDGEMV on the first
+ * multiplication after caching has been enabled. If it would need more memory than the given
+ * budget, the cache remembers that and the multiplications fall back to the evaluation of the
+ * basis functions until the grid or the dataset change.
+ * The cached matrix is discarded automatically if the number of data points, the address of the
+ * dataset or the grid change, where the latter is detected by
+ * HashGridStorage::getModificationCount() in constant time. Changes of the values of the dataset
+ * or in-place changes of the grid points or the bounding box are not detected, invalidate() has
+ * to be called in that case.
+ */
+class EvaluationMatrixCache {
+ public:
+  /// default memory budget in bytes
+  static const size_t defaultMemoryBudget = static_cast<size_t>(1) << 30;
+
+  EvaluationMatrixCache();
+
+  /**
+   * Enables caching.
+   *
+   * @param memoryBudget maximum number of bytes the cached matrix may occupy
+   * @param singlePrecision if true, the matrix entries are stored as float, which saves a third of
+   * the memory at the cost of accuracy. The multiplications still accumulate in double precision.
+   */
+  void enable(size_t memoryBudget = defaultMemoryBudget, bool singlePrecision = false);
+
+  /**
+   * Disables caching and frees the cached matrix.
+   */
+  void disable();
+
+  bool isEnabled() const;
+
+  /**
+   * Discards the cached matrix, it is rebuilt on the next multiplication.
+   */
+  void invalidate();
+
+  /**
+   * Compares the grid and the dataset with the ones the cache has been set up for and discards
+   * the cached matrix if they differ.
+   */
+  void synchronize(GridStorage& storage, const DataMatrix& x);
+
+  /**
+   * @return true if the matrix for the current grid and dataset is cached
+   */
+  bool isBuilt() const;
+
+  /**
+   * @return true if the matrix for the current grid and dataset does not fit into the memory
+   * budget
+   */
+  bool exceedsMemoryBudget() const;
+
+  /**
+   * @return the maximum number of nonzero entries that fit into the memory budget
+   */
+  size_t getMaxEntries() const;
+
+  /**
+   * Stores the matrix, given in compressed sparse row format. The vectors are consumed.
+   *
+   * @param rowPointers entries of row i are stored at rowPointers[i], ..., rowPointers[i+1]-1
+   * @param columnIndices grid point indices of the entries
+   * @param values basis function values of the entries
+   * @param numColumns number of grid points
+   */
+  void setMatrix(std::vector<size_t>& rowPointers, std::vector<uint32_t>& columnIndices,
+                 std::vector<double>& values, size_t numColumns);
+
+  /**
+   * Marks the matrix for the current grid and dataset as too large for the memory budget.
+   */
+  void setExceedsMemoryBudget();
+
+  /**
+   * @param source the coefficients of the grid points
+   * @param result the values at the data points
+   */
+  void mult(const DataVector& source, DataVector& result) const;
+
+  /**
+   * @param source the values at the data points
+   * @param result the results for the grid points
+   */
+  void multTranspose(const DataVector& source, DataVector& result) const;
+
+  /**
+   * @return the number of bytes occupied by the cached matrix
+   */
+  size_t getMemoryUsage() const;
+
+ private:
+  bool enabled;
+  bool singlePrecision;
+  bool tooLarge;
+  size_t memoryBudget;
+
+  // identify the grid and the dataset the matrix belongs to
+  const GridStorage* gridStorage;
+  size_t gridModificationCount;
+  size_t gridSize;
+  const double* datasetPointer;
+  size_t datasetRows;
+
+  size_t numColumns;
+  std::vector<size_t> rowPointers;
+  std::vector<uint32_t> columnIndices;
+  std::vector<double> values;
+  std::vector<float> valuesSP;
+  std::vector<size_t> columnPointers;
+  std::vector<uint32_t> rowIndices;
+  std::vector<double> transposedValues;
+  std::vector<float> transposedValuesSP;
+
+  size_t getBytesPerEntry() const;
+  void clear();
+
+  template <typename T>
+  void buildTranspose(const std::vector<T>& rowValues, std::vector<T>& columnValues);
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* EVALUATIONMATRIXCACHE_HPP */
@@ -6,7 +6,9 @@
 #ifndef GETAFFECTEDBASISFUNCTIONS_HPP
 #define GETAFFECTEDBASISFUNCTIONS_HPP
 
+#include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearStretchedBoundaryBasis.hpp>
 #include <sgpp/base/operation/hash/common/basis/PrewaveletBasis.hpp>
@@ -72,13 +74,16 @@ class GetAffectedBasisFunctions {
    * \f[ \sum_{r\in\mathbf{result}} \alpha[r\rightarrow\mathbf{first}] \cdot
    * r\rightarrow\mathbf{second}. \f]
    *
+   * Like AlgorithmEvaluation, the point is transformed from the grid's bounding box to the unit
+   * cube and no basis function is affected if the point lies outside of the bounding box.
+   *
    * @param basis a sparse grid basis
    * @param point evaluation point within the domain
    * @param result a vector to store the results in
    */
   void operator()(BASIS& basis, const DataVector& point,
                   std::vector<std::pair<size_t, double> >& result) {
-    GridStorage::grid_iterator working(storage);
+    result.clear();
 
     // typedef level_t level_type;
     typedef index_t index_type;
@@ -87,6 +92,19 @@ class GetAffectedBasisFunctions {
 
     size_t dim = storage.getDimension();
 
+    // Check for bounding box
+    BoundingBox* bb = storage.getBoundingBox();
+    DataVector unitPoint(dim);
+
+    for (size_t d = 0; d < dim; ++d) {
+      if (!bb->isContainingPoint(d, point[d])) {
+        return;
+      }
+
+      unitPoint[d] = bb->transformPointToUnitCube(d, point[d]);
+    }
+
+    GridStorage::grid_iterator working(storage);
     index_type* source = new index_type[dim];
 
     for (size_t d = 0; d < dim; ++d) {
@@ -98,19 +116,18 @@ class GetAffectedBasisFunctions {
       // be absorbed (see floating point absorbtion).
       // This trick needs a mantissa with >= 32 bits.
       // This will not work with 64 bit indices.
-      if (point[d] == 1.0) {
+      if (unitPoint[d] == 1.0) {
         // source[d] = static_cast<index_type>(static_cast<double>(temp) - 1.0);
         source[d] = 0x7fffffff;
       } else {
         // This does not really work on grids with borders.
-        double temp = floor(point[d] * static_cast<double>(1 << (bits - 2))) * 2;
+        double temp = floor(unitPoint[d] * static_cast<double>(1 << (bits - 2))) * 2;
         // TODO(dirk): why the + 1?
         source[d] = static_cast<index_type>(static_cast<double>(temp) + 1.0);
       }
     }
 
-    result.clear();
-    rec(basis, point, 0, 1.0, working, source, result);
+    rec(basis, unitPoint, 0, 1.0, working, source, result);
 
     delete[] source;
   }
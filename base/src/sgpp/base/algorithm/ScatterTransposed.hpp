@@ -0,0 +1,155 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef SCATTERTRANSPOSED_HPP
+#define SCATTERTRANSPOSED_HPP
+
+#include <sgpp/globaldef.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * Value of a basis function at a data point, buffered by scatterTransposed().
+ */
+struct ScatterContribution {
+  size_t gridPoint;
+  size_t dataPoint;
+  double value;
+};
+
+/**
+ * Receives the nonzero basis function values at a data point in scatterTransposed() and sorts
+ * them into the buffers of the threads owning the grid points.
+ */
+class ScatterBuffer {
+ public:
+  ScatterBuffer(std::vector<ScatterContribution>* buckets, size_t rangeSize)
+      : buckets(buckets), rangeSize(rangeSize), dataPoint(0), numEntries(0) {}
+
+  /**
+   * @param gridPoint sequence number of the basis function
+   * @param value value of the basis function at the current data point
+   */
+  inline void operator()(size_t gridPoint, double value) {
+    ScatterContribution contribution = {gridPoint, dataPoint, value};
+    buckets[gridPoint / rangeSize].push_back(contribution);
+    numEntries++;
+  }
+
+  std::vector<ScatterContribution>* buckets;
+  size_t rangeSize;
+  size_t dataPoint;
+  size_t numEntries;
+};
+
+/**
+ * Parallel transposed evaluation without a private copy of the result per thread.
+ *
+ * The grid points are split into contiguous sequence number ranges, one per thread, and
+ * accumulate(grid point, data point, value) is called for every nonzero value by the thread owning
+ * the grid point. Hence, accumulate may update the results of the grid point without
+ * synchronization. The data points are processed in blocks: first, the threads evaluate the basis
+ * functions at the points of a block and buffer the values by owning thread, then every thread
+ * accumulates the values of its range. The block size is adapted such that the buffers stay
+ * small. The order of the accumulation only depends on the number of threads.
+ *
+ * Every thread works on its own copy of evaluator, which has to provide
+ * operator()(size_t dataPoint, ScatterBuffer& buffer) calling buffer(grid point, value) for
+ * every basis function that does not vanish at the data point.
+ *
+ * @param numGridPoints number of grid points
+ * @param numDataPoints number of data points
+ * @param evaluator evaluates the basis functions at a data point
+ * @param accumulate functor called for every nonzero value
+ */
+template <class EVALUATOR, class ACCUMULATE>
+void scatterTransposed(size_t numGridPoints, size_t numDataPoints, const EVALUATOR& evaluator,
+                       ACCUMULATE accumulate) {
+  // number of buffered values per thread the block size is adapted to
+  const size_t targetEntries = static_cast<size_t>(1) << 16;
+  // maximum number of data points per thread and block
+  const size_t maxPoints = 1024;
+
+  size_t numThreads = 1;
+  size_t rangeSize = 1;
+  size_t pointsPerThread = 16;
+  size_t blockEntries = 0;
+  // buckets[producer * numThreads + owner] holds the values computed by thread producer for
+  // the grid points of thread owner
+  std::vector<std::vector<ScatterContribution> > buckets;
+
+#pragma omp parallel
+  {
+    size_t thread = 0;
+#ifdef _OPENMP
+    thread = static_cast<size_t>(omp_get_thread_num());
+#endif
+
+#pragma omp single
+    {
+#ifdef _OPENMP
+      numThreads = static_cast<size_t>(omp_get_num_threads());
+#endif
+      rangeSize = std::max(static_cast<size_t>(1), (numGridPoints + numThreads - 1) / numThreads);
+      buckets.resize(numThreads * numThreads);
+    }
+
+    EVALUATOR privateEvaluator(evaluator);
+    ScatterBuffer buffer(&buckets[thread * numThreads], rangeSize);
+    size_t blockStart = 0;
+
+    while (blockStart < numDataPoints) {
+      size_t blockEnd = std::min(numDataPoints, blockStart + pointsPerThread * numThreads);
+      buffer.numEntries = 0;
+
+#pragma omp for schedule(static) nowait
+
+      for (size_t i = blockStart; i < blockEnd; i++) {
+        buffer.dataPoint = i;
+        privateEvaluator(i, buffer);
+      }
+
+#pragma omp atomic
+      blockEntries += buffer.numEntries;
+
+#pragma omp barrier
+
+      for (size_t producer = 0; producer < numThreads; producer++) {
+        std::vector<ScatterContribution>& bucket = buckets[producer * numThreads + thread];
+
+        for (size_t k = 0; k < bucket.size(); k++) {
+          accumulate(bucket[k].gridPoint, bucket[k].dataPoint, bucket[k].value);
+        }
+
+        bucket.clear();
+      }
+
+#pragma omp single
+      {
+        // adapt the size of the next block to the number of values per data point
+        size_t points = (blockEnd - blockStart + numThreads - 1) / numThreads;
+        size_t entriesPerThread = std::max(static_cast<size_t>(1), blockEntries / numThreads);
+        pointsPerThread = std::max(static_cast<size_t>(1),
+                                   std::min(maxPoints, targetEntries * points / entriesPerThread));
+        blockEntries = 0;
+      }
+
+      blockStart = blockEnd;
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* SCATTERTRANSPOSED_HPP */
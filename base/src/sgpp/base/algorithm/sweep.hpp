@@ -11,10 +11,15 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
 #include <vector>
 #include <utility>
 #include <iostream>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 namespace sgpp {
 namespace base {
@@ -24,6 +29,16 @@ namespace base {
  * FUNC should be a class with overwritten operator(). For an example see laplace_up_functor in laplace.hpp.
  * It must be default constructable or copyable.
  * STORAGE must provide a grid_iterator supporting left_child, step_right, up, hint and seq.
+ *
+ * The DataVector variants of sweep1D and sweep1D_Boundary process the independent 1D poles in
+ * dim_sweep concurrently with OpenMP tasks, each task working with its own copy of the functor.
+ * If called from within a parallel region (e.g. from a task of the UpDown schemes), the tasks
+ * are spawned into the enclosing team and awaited before returning. sweep1DFused executes two
+ * functors per pole within the same task and adds their results through a pole-sized buffer,
+ * so no grid-sized temporary vector is needed.
+ * Functors that record state shared between their copies (e.g. the stencil hierarchisation
+ * functors, which append to common stencil vectors) have to be run serially, see
+ * setParallelPoles().
  */
 template<class FUNC>
 class sweep {
@@ -38,6 +53,8 @@ class sweep {
   const std::vector<size_t> algoDims;
   /// number of algorithmic dimensions
   const size_t numAlgoDims_;
+  /// whether the poles of the DataVector sweeps are processed concurrently
+  bool parallelPoles;
 
  public:
   /**
@@ -47,7 +64,7 @@ class sweep {
    */
   explicit sweep(GridStorage& storage) : functor(), storage(storage),
     algoDims(storage.getAlgorithmicDimensions()),
-    numAlgoDims_(storage.getAlgorithmicDimensions().size()) {
+    numAlgoDims_(storage.getAlgorithmicDimensions().size()), parallelPoles(true) {
   }
 
   /**
@@ -59,7 +76,7 @@ class sweep {
   sweep(FUNC& functor, GridStorage& storage) :
     functor(functor), storage(storage),
     algoDims(storage.getAlgorithmicDimensions()),
-    numAlgoDims_(storage.getAlgorithmicDimensions().size()) {
+    numAlgoDims_(storage.getAlgorithmicDimensions().size()), parallelPoles(true) {
   }
 
   /**
@@ -68,6 +85,17 @@ class sweep {
   ~sweep() {
   }
 
+  /**
+   * Enables or disables the concurrent processing of the poles (enabled by default).
+   * If disabled, the poles are processed one after another in the order of the grid traversal
+   * by the calling thread.
+   *
+   * @param parallelPoles true if the poles may be processed by concurrent tasks
+   */
+  void setParallelPoles(bool parallelPoles) {
+    this->parallelPoles = parallelPoles;
+  }
+
   /**
    * Descends on all dimensions beside dim_sweep. Class functor for dim_sweep
    * Boundaries are not regarded
@@ -88,8 +116,11 @@ class sweep {
     }
 
     grid_iterator index(storage);
+    PoleList poles(storage.getDimension());
 
-    sweep_rec(source, result, index, dim_list, storage.getDimension() - 1, dim_sweep);
+    collectPoles_rec(index, dim_list, storage.getDimension() - 1, poles);
+    SinglePoleOp op(functor, source, result, dim_sweep);
+    sweepPoles(op, poles);
   }
 
   /**
@@ -139,9 +170,46 @@ class sweep {
 
     grid_iterator index(storage);
     index.resetToLevelZero();
+    PoleList poles(storage.getDimension());
 
-    sweep_Boundary_rec(source, result, index, dim_list, storage.getDimension() - 1,
-                       dim_sweep);
+    collectPoles_Boundary_rec(index, dim_list, storage.getDimension() - 1, poles);
+    SinglePoleOp op(functor, source, result, dim_sweep);
+    sweepPoles(op, poles);
+  }
+
+  /**
+   * Descends on all dimensions beside dim_sweep and executes the class functor and
+   * secondFunctor for dim_sweep on every pole, so that
+   * result = functor(source) + secondFunctor(source). This replaces two calls of sweep1D
+   * and the addition of a grid-sized temporary, e.g. for the last dimension of an up/down
+   * scheme. The functors themselves are not fused: each pole is still traversed four times
+   * (both functors, saving and adding the values of the second one), but the pole stays in
+   * cache and only a pole-sized buffer is used. Both functors have to overwrite the result of
+   * every point of the pole and must not read from result.
+   * Boundaries are not regarded
+   *
+   * @param secondFunctor the second functor that is executed on the grid
+   * @param source a DataVector containing the source coefficients of the grid points
+   * @param result a DataVector containing the result coefficients of the grid points
+   * @param dim_sweep the dimension in which the functors are executed
+   */
+  template <class FUNC2>
+  void sweep1DFused(FUNC2& secondFunctor, DataVector& source, DataVector& result,
+                    size_t dim_sweep) {
+    std::vector<size_t> dim_list;
+
+    for (size_t i = 0; i < storage.getDimension(); i++) {
+      if (i != dim_sweep) {
+        dim_list.push_back(i);
+      }
+    }
+
+    grid_iterator index(storage);
+    PoleList poles(storage.getDimension());
+
+    collectPoles_rec(index, dim_list, storage.getDimension() - 1, poles);
+    FusedPoleOp<FUNC2> op(functor, secondFunctor, storage, source, result, dim_sweep);
+    sweepPoles(op, poles);
   }
 
 
@@ -173,6 +241,284 @@ class sweep {
   }
 
  protected:
+  /**
+   * Level-index vectors of the grid points where the 1D poles start. Points are stored
+   * explicitly (instead of sequence numbers) as boundary sweeps may start at points that are
+   * not contained in the grid.
+   */
+  class PoleList {
+   public:
+    /// appends the current point of the iterator
+    void add(grid_iterator& index) {
+      level_t l;
+      index_t i;
+
+      for (size_t d = 0; d < dim; d++) {
+        index.get(d, l, i);
+        levels.push_back(l);
+        indices.push_back(i);
+      }
+    }
+
+    /// moves the iterator to the start of the p-th pole
+    void get(size_t p, grid_iterator& index) const {
+      const size_t offset = p * dim;
+
+      for (size_t d = 0; d + 1 < dim; d++) {
+        index.push(d, levels[offset + d], indices[offset + d]);
+      }
+
+      // set rehashes the point
+      index.set(dim - 1, levels[offset + dim - 1], indices[offset + dim - 1]);
+    }
+
+    size_t size() const { return (dim > 0) ? (levels.size() / dim) : 0; }
+
+    explicit PoleList(size_t dim) : dim(dim) {}
+
+   private:
+    size_t dim;
+    std::vector<level_t> levels;
+    std::vector<index_t> indices;
+  };
+
+  /// applies the functor to a single pole
+  struct SinglePoleOp {
+    SinglePoleOp(FUNC& functor, DataVector& source, DataVector& result, size_t dim_sweep)
+        : functor(functor), source(source), result(result), dim_sweep(dim_sweep) {}
+
+    void operator()(grid_iterator& index) { functor(source, result, index, dim_sweep); }
+
+    FUNC functor;
+    DataVector& source;
+    DataVector& result;
+    size_t dim_sweep;
+  };
+
+  /**
+   * applies the functor and a second functor to a single pole and adds up both results.
+   * The values of the second functor are buffered pole-locally, so no grid-sized temporary
+   * is needed. The pole is traversed by both functors and by gather_rec and scatterAdd_rec.
+   */
+  template <class FUNC2>
+  struct FusedPoleOp {
+    FusedPoleOp(FUNC& functor, FUNC2& secondFunctor, GridStorage& storage, DataVector& source,
+                DataVector& result, size_t dim_sweep)
+        : functor(functor),
+          secondFunctor(secondFunctor),
+          storage(storage),
+          source(source),
+          result(result),
+          dim_sweep(dim_sweep) {}
+
+    void operator()(grid_iterator& index) {
+      secondFunctor(source, result, index, dim_sweep);
+      buffer.clear();
+      gather_rec(index);
+      functor(source, result, index, dim_sweep);
+      size_t pos = 0;
+      scatterAdd_rec(index, pos);
+    }
+
+    /// stores the pole's result values in pre-order
+    void gather_rec(grid_iterator& index) {
+      buffer.push_back(result[index.seq()]);
+
+      if (!index.hint()) {
+        index.leftChild(dim_sweep);
+
+        if (!storage.isInvalidSequenceNumber(index.seq())) {
+          gather_rec(index);
+        }
+
+        index.stepRight(dim_sweep);
+
+        if (!storage.isInvalidSequenceNumber(index.seq())) {
+          gather_rec(index);
+        }
+
+        index.up(dim_sweep);
+      }
+    }
+
+    /// adds the buffered values to the pole's result values, same order as gather_rec
+    void scatterAdd_rec(grid_iterator& index, size_t& pos) {
+      result[index.seq()] += buffer[pos++];
+
+      if (!index.hint()) {
+        index.leftChild(dim_sweep);
+
+        if (!storage.isInvalidSequenceNumber(index.seq())) {
+          scatterAdd_rec(index, pos);
+        }
+
+        index.stepRight(dim_sweep);
+
+        if (!storage.isInvalidSequenceNumber(index.seq())) {
+          scatterAdd_rec(index, pos);
+        }
+
+        index.up(dim_sweep);
+      }
+    }
+
+    FUNC functor;
+    FUNC2 secondFunctor;
+    GridStorage& storage;
+    DataVector& source;
+    DataVector& result;
+    size_t dim_sweep;
+    std::vector<double> buffer;
+  };
+
+  /**
+   * Executes a pole operation on all given poles, see the class description for the
+   * parallelization.
+   *
+   * @param op pole operation (SinglePoleOp or FusedPoleOp), copied for every task
+   * @param poles grid points where the poles start
+   */
+  template <class POLEOP>
+  void sweepPoles(POLEOP& op, const PoleList& poles) {
+#ifdef _OPENMP
+    if (parallelPoles && !omp_in_parallel() && (omp_get_max_threads() > 1)) {
+#pragma omp parallel
+      {
+#pragma omp single
+        sweepPolesTasks(op, poles);
+      }
+      return;
+    }
+#endif
+    sweepPolesTasks(op, poles);
+  }
+
+  /**
+   * Spawns one task per chunk of poles and waits for their completion.
+   *
+   * @param op pole operation (SinglePoleOp or FusedPoleOp), copied for every task
+   * @param poles grid points where the poles start
+   */
+  template <class POLEOP>
+  void sweepPolesTasks(POLEOP& op, const PoleList& poles) {
+    const size_t numPoles = poles.size();
+    size_t numTasks = 1;
+#ifdef _OPENMP
+    if (parallelPoles) {
+      numTasks = std::min(numPoles, 4 * static_cast<size_t>(omp_get_max_threads()));
+    }
+#endif
+    const size_t chunkSize = (numTasks > 0) ? ((numPoles + numTasks - 1) / numTasks) : 0;
+
+    for (size_t start = 0; start < numPoles; start += chunkSize) {
+#pragma omp task firstprivate(start) shared(op, poles) if (numTasks > 1)
+      {
+        POLEOP taskOp(op);
+        grid_iterator index(storage);
+        const size_t end = std::min(start + chunkSize, numPoles);
+
+        for (size_t p = start; p < end; p++) {
+          poles.get(p, index);
+          taskOp(index);
+        }
+      }
+    }
+
+#pragma omp taskwait
+  }
+
+  /**
+   * Collects the grid points on which sweep_rec would execute the functor.
+   * Boundaries are not regarded
+   *
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param poles grid points where the poles start
+   */
+  void collectPoles_rec(grid_iterator& index, std::vector<size_t>& dim_list, size_t dim_rem,
+                        PoleList& poles) {
+    poles.add(index);
+
+    for (size_t d = 0; d < dim_rem; d++) {
+      size_t current_dim = dim_list[d];
+
+      if (index.hint()) {
+        continue;
+      }
+
+      index.leftChild(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collectPoles_rec(index, dim_list, d + 1, poles);
+      }
+
+      index.stepRight(current_dim);
+
+      if (!storage.isInvalidSequenceNumber(index.seq())) {
+        collectPoles_rec(index, dim_list, d + 1, poles);
+      }
+
+      index.up(current_dim);
+    }
+  }
+
+  /**
+   * Collects the grid points on which sweep_Boundary_rec would execute the functor.
+   * Boundaries are regarded
+   *
+   * @param index current grid position
+   * @param dim_list list of dimensions, that should be handled
+   * @param dim_rem number of remaining dims
+   * @param poles grid points where the poles start
+   */
+  void collectPoles_Boundary_rec(grid_iterator& index, std::vector<size_t>& dim_list,
+                                 size_t dim_rem, PoleList& poles) {
+    if (dim_rem == 0) {
+      poles.add(index);
+    } else {
+      level_t current_level;
+      index_t current_index;
+
+      index.get(dim_list[dim_rem - 1], current_level, current_index);
+
+      if (current_level > 0) {
+        collectPoles_Boundary_rec(index, dim_list, dim_rem - 1, poles);
+
+        if (!index.hint()) {
+          index.leftChild(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collectPoles_Boundary_rec(index, dim_list, dim_rem, poles);
+          }
+
+          index.stepRight(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collectPoles_Boundary_rec(index, dim_list, dim_rem, poles);
+          }
+
+          index.up(dim_list[dim_rem - 1]);
+        }
+      } else {
+        collectPoles_Boundary_rec(index, dim_list, dim_rem - 1, poles);
+
+        index.resetToRightLevelZero(dim_list[dim_rem - 1]);
+        collectPoles_Boundary_rec(index, dim_list, dim_rem - 1, poles);
+
+        if (!index.hint()) {
+          index.resetToLevelOne(dim_list[dim_rem - 1]);
+
+          if (!storage.isInvalidSequenceNumber(index.seq())) {
+            collectPoles_Boundary_rec(index, dim_list, dim_rem, poles);
+          }
+        }
+
+        index.resetToLeftLevelZero(dim_list[dim_rem - 1]);
+      }
+    }
+  }
+
   /**
    * Descends on all dimensions beside dim_sweep. Class functor for dim_sweep.
    * Boundaries are not regarded
@@ -26,7 +26,8 @@ HashGridStorage::HashGridStorage(size_t dimension)
       algoDims(),
       boundingBox(new BoundingBox(dimension)),
       stretching(nullptr),
-      bUseStretching(false) {
+      bUseStretching(false),
+      modificationCount(0) {
   for (size_t i = 0; i < dimension; i++) {
     algoDims.push_back(i);
   }
@@ -40,7 +41,8 @@ HashGridStorage::HashGridStorage(BoundingBox& creationBoundingBox)
       algoDims(),
       boundingBox(new BoundingBox(creationBoundingBox)),
       stretching(nullptr),
-      bUseStretching(false) {
+      bUseStretching(false),
+      modificationCount(0) {
   // this look like a bug, creationBoundingBox not used
   for (size_t i = 0; i < dimension; i++) {
     algoDims.push_back(i);
@@ -55,7 +57,8 @@ HashGridStorage::HashGridStorage(Stretching& creationStretching)
       algoDims(),
       boundingBox(nullptr),
       stretching(new Stretching(creationStretching)),
-      bUseStretching(true) {
+      bUseStretching(true),
+      modificationCount(0) {
   // this look like a bug, creationBoundingBox not used
   for (size_t i = 0; i < dimension; i++) {
     algoDims.push_back(i);
@@ -67,7 +70,8 @@ HashGridStorage::HashGridStorage(std::string& istr)
       dimension(0lu),
       list(),
       map(),
-      algoDims() {
+      algoDims(),
+      modificationCount(0) {
   std::istringstream istream;
   istream.str(istr);
 
@@ -83,7 +87,8 @@ HashGridStorage::HashGridStorage(std::istream& istream)
       dimension(0lu),
       list(),
       map(),
-      algoDims() {
+      algoDims(),
+      modificationCount(0) {
   parseGridDescription(istream);
 
   for (size_t i = 0; i < dimension; i++) {
@@ -99,7 +104,8 @@ HashGridStorage::HashGridStorage(HashGridStorage& copyFrom)
       algoDims(copyFrom.algoDims),
       boundingBox(copyFrom.bUseStretching ? nullptr : new BoundingBox(*copyFrom.boundingBox)),
       stretching(copyFrom.bUseStretching ? new Stretching(*copyFrom.stretching) : nullptr),
-      bUseStretching(copyFrom.bUseStretching) {
+      bUseStretching(copyFrom.bUseStretching),
+      modificationCount(0) {
   // copy gridpoints
   for (size_t i = 0; i < copyFrom.getSize(); i++) {
     this->insert(copyFrom[i]);
@@ -153,6 +159,7 @@ void HashGridStorage::clear() {
   map.clear();
   // remove all list entries
   list.clear();
+  modificationCount++;
 }
 
 std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoints) {
@@ -197,6 +204,7 @@ std::vector<size_t> HashGridStorage::deletePoints(std::list<size_t>& removePoint
   // reset the whole grid's leaf property in order
   // to guarantee a consistent grid
   recalcLeafProperty();
+  modificationCount++;
 
   // return indices of "surviver"
   return remainingPoints;
@@ -207,6 +215,7 @@ void HashGridStorage::unserializeNoAlgoDims(std::string& istr) {
   istream.str(istr);
 
   parseGridDescription(istream);
+  modificationCount++;
 
   //    for (size_t i = 0; i < DIM; i++)
   //    {
@@ -285,9 +294,12 @@ size_t HashGridStorage::getNumberOfInnerPoints() const {
 
 size_t HashGridStorage::getDimension() const { return dimension; }
 
+size_t HashGridStorage::getModificationCount() const { return modificationCount; }
+
 size_t HashGridStorage::insert(const point_type& index) {
   point_pointer insert = new HashGridPoint(index);
   list.push_back(insert);
+  modificationCount++;
   return (map[insert] = list.size() - 1);
 }
 
@@ -332,6 +344,7 @@ void HashGridStorage::update(point_type& index, size_t pos) {
     point_pointer insert = new HashGridPoint(index);
     list[pos] = insert;
     map[insert] = pos;
+    modificationCount++;
   }
 }
 
@@ -340,6 +353,7 @@ void HashGridStorage::deleteLast() {
   map.erase(del);
   list.pop_back();
   delete del;
+  modificationCount++;
 }
 
 void HashGridStorage::setAlgorithmicDimensions(std::vector<size_t> newAlgoDims) {
@@ -417,6 +431,7 @@ void HashGridStorage::setBoundingBox(BoundingBox& boundingBox) {
 
   bUseStretching = false;
   this->boundingBox = new BoundingBox(boundingBox);
+  modificationCount++;
 }
 
 void HashGridStorage::setStretching(Stretching& stretching) {
@@ -428,6 +443,7 @@ void HashGridStorage::setStretching(Stretching& stretching) {
 
   bUseStretching = true;
   this->stretching = new Stretching(stretching);
+  modificationCount++;
 }
 
 void HashGridStorage::getLevelIndexArraysForEval(DataMatrix& level, DataMatrix& index) {
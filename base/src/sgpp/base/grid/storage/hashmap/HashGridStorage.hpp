@@ -196,6 +196,17 @@ class HashGridStorage {
    */
   size_t getDimension() const;
 
+  /**
+   * Returns a counter that is incremented whenever grid points are inserted, updated or deleted
+   * and whenever the bounding box or the stretching is replaced, such that data structures
+   * derived from the grid can detect changes cheaply.
+   * Modifications of grid points via operator[] or getPoint() and of the bounding box via
+   * getBoundingBox() are not counted.
+   *
+   * @return the number of modifications of the grid
+   */
+  size_t getModificationCount() const;
+
   /**
    * gets the index number for given gridpoint by its sequence number
    *
@@ -534,6 +545,9 @@ class HashGridStorage {
   /// Flag to check if stretching or boundingBox used
   bool bUseStretching;
 
+  /// number of modifications of the grid points or the bounding box
+  size_t modificationCount;
+
   /**
    * Parses the gird's information (grid points, dimensions, bounding box) from a string stream
    *
@@ -551,6 +565,7 @@ void inline HashGridStorage::destroy(point_pointer index) { delete index; }
 
 unsigned int inline HashGridStorage::store(point_pointer index) {
   list.push_back(index);
+  modificationCount++;
   return static_cast<unsigned int>(map[index] = static_cast<unsigned int>(list.size() - 1));
 }
 
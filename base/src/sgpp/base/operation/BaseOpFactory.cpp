@@ -112,6 +112,7 @@
 #include <sgpp/base/operation/hash/OperationEvalPolyBoundary.hpp>
 #include <sgpp/base/operation/hash/OperationEvalPrewavelet.hpp>
 
+#include <sgpp/base/operation/hash/OperationMultipleEvalFixedDimension.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinear.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearBoundary.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinearStretched.hpp>
@@ -466,7 +467,9 @@ base::OperationEval* createOperationEval(base::Grid& grid) {
 
 base::OperationMultipleEval* createOperationMultipleEval(base::Grid& grid,
                                                          base::DataMatrix& dataset) {
-  if (grid.getType() == base::GridType::Linear) {
+  if (base::OperationMultipleEvalFixedDimension::isSupported(grid)) {
+    return new base::OperationMultipleEvalFixedDimension(grid, dataset);
+  } else if (grid.getType() == base::GridType::Linear) {
     return new base::OperationMultipleEvalLinear(grid, dataset);
   } else if (grid.getType() == base::GridType::LinearL0Boundary ||
              grid.getType() == base::GridType::LinearBoundary) {
@@ -113,6 +113,8 @@ base::OperationMatrix* createOperationIdentity(base::Grid& grid);
 base::OperationEval* createOperationEval(base::Grid& grid);
 /**
  * Factory method, returning an OperationMultipleEval for the grid at hand.
+ * For linear and modified linear grids with a small dimensionality, an operation with
+ * compile-time specialized kernels is returned (see OperationMultipleEvalFixedDimension).
  * Note: object has to be freed after use.
  *
  * @param grid Grid which is to be used
@@ -28,35 +28,8 @@ double OperationEvalModLinear::eval(const DataVector& alpha,
   GetAffectedBasisFunctions <
   LinearModifiedBasis<unsigned int, unsigned int> > ga(storage);
 
-  /* Scale point to bounding box */
-
-  // Initialize a copy of point
-  DataVector point_bb = DataVector(point.getSize());
-  point_bb.copyFrom(point);
-
-  // Get bounding box
-  BoundingBox* bb = storage.getBoundingBox();
-  size_t dim = bb->getDimension();
-
-  if (bb != NULL) {
-    for (size_t d = 0; d < dim; ++d) {
-      BoundingBox1D dimbb = bb->getBoundary(d);
-
-      if (dimbb.leftBoundary == 0.0 && dimbb.rightBoundary == 1.0) {
-        continue;
-      }
-
-      if (!(dimbb.leftBoundary <= point[d] &&
-            point[d] <= dimbb.rightBoundary)) {
-        return 0.0;
-      }
-
-      point_bb[d] = (point[d] - dimbb.leftBoundary) / (dimbb.rightBoundary -
-                    dimbb.leftBoundary);
-    }
-  }
-
-  ga(base, point_bb, vec);
+  // GetAffectedBasisFunctions scales the point to the bounding box
+  ga(base, point, vec);
 
   double result = 0.0;
 
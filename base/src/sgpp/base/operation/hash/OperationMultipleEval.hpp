@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <sgpp/base/algorithm/EvaluationMatrixCache.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/not_implemented_exception.hpp>
@@ -29,6 +30,8 @@ class OperationMultipleEval {
   Grid& grid;
   DataMatrix& dataset;
   bool isPrepared;
+  /// cached evaluation matrix, used by the kernels based on AlgorithmDGEMV
+  EvaluationMatrixCache matrixCache;
 
  public:
   /**
@@ -101,6 +104,45 @@ class OperationMultipleEval {
     throw sgpp::base::not_implemented_exception();
   }
 
+  /**
+   * Multiplication of @f$B^T@f$ with several coefficient vectors at once, e.g. the surpluses of
+   * multiple functions on the same grid.
+   * The default implementation applies mult() to each column, kernels may override it to evaluate
+   * the basis functions only once for all columns.
+   *
+   * @param alphas the coefficient vectors, one column per function
+   * @param result the results, one row per data point and one column per function
+   */
+  virtual void multMultiple(DataMatrix& alphas, DataMatrix& result) {
+    DataVector alpha(alphas.getNrows());
+    DataVector column(result.getNrows());
+
+    for (size_t j = 0; j < alphas.getNcols(); j++) {
+      alphas.getColumn(j, alpha);
+      this->mult(alpha, column);
+      result.setColumn(j, column);
+    }
+  }
+
+  /**
+   * Multiplication of @f$B@f$ with several vectors at once.
+   * The default implementation applies multTranspose() to each column, kernels may override it
+   * to evaluate the basis functions only once for all columns.
+   *
+   * @param sources the vectors, one row per data point and one column per vector
+   * @param result the results, one row per grid point and one column per vector
+   */
+  virtual void multTransposeMultiple(DataMatrix& sources, DataMatrix& result) {
+    DataVector source(sources.getNrows());
+    DataVector column(result.getNrows());
+
+    for (size_t j = 0; j < sources.getNcols(); j++) {
+      sources.getColumn(j, source);
+      this->multTranspose(source, column);
+      result.setColumn(j, column);
+    }
+  }
+
   /**
    * Evaluate multiple datapoints with the specified grid
    *
@@ -109,15 +151,44 @@ class OperationMultipleEval {
    */
   void eval(DataVector& alpha, DataVector& result) { this->mult(alpha, result); }
 
+  /**
+   * Enables caching of the sparse matrix @f$B@f$. The kernels based on AlgorithmDGEMV then
+   * evaluate the basis functions at the data points only once and perform all further calls of
+   * mult() and multTranspose() as sparse matrix vector products, which pays off if the operation
+   * is applied many times to the same grid and dataset, e.g., in an iterative solver.
+   * The cached matrix is rebuilt automatically if the grid changes. If the values of the dataset
+   * are changed in place, prepare() has to be called. Kernels that do not support caching ignore
+   * this setting.
+   *
+   * @param memoryBudget maximum number of bytes the cached matrix may occupy, if it is larger, the
+   * basis functions are evaluated in every call as without caching
+   * @param singlePrecision store the matrix entries in single precision
+   */
+  void enableMatrixCaching(size_t memoryBudget = EvaluationMatrixCache::defaultMemoryBudget,
+                           bool singlePrecision = false) {
+    matrixCache.enable(memoryBudget, singlePrecision);
+  }
+
+  /**
+   * Disables caching of the sparse matrix @f$B@f$ and frees the cached matrix.
+   */
+  void disableMatrixCaching() { matrixCache.disable(); }
+
+  /**
+   * @return the cache of the sparse matrix @f$B@f$
+   */
+  const EvaluationMatrixCache& getMatrixCache() const { return matrixCache; }
+
   /**
    * Used for kernel-specific setup like special data structures that are defined from the current
    * state of
    * the grid. This function is by default called with each "mult()", "multTranspose()" or
    * evaluation operation
    * and can be ignored from an external perspective.
-   * This is not overridden by every kernel.
+   * This is not overridden by every kernel. The default implementation discards the cached matrix
+   * @f$B@f$ (see enableMatrixCaching()).
    */
-  virtual void prepare() {}
+  virtual void prepare() { matrixCache.invalidate(); }
 
   virtual double getDuration() = 0;
 
@@ -0,0 +1,144 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultipleEvaluationFixedDimension.hpp>
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalFixedDimension.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
+#include <sgpp/base/operation/hash/common/basis/LinearModifiedBasis.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+namespace {
+
+/**
+ * Maps the runtime dimensionality to the kernel instantiated for DIM, DIM + 1, ...
+ */
+template <class BASIS, size_t DIM>
+struct FixedDimensionDispatcher {
+  static void mult(GridStorage& storage, DataVector& source, DataMatrix& x, DataVector& result,
+                   bool transposed) {
+    if (storage.getDimension() == DIM) {
+      AlgorithmMultipleEvaluationFixedDimension<BASIS, DIM> op;
+      BASIS basis;
+
+      if (transposed) {
+        op.mult_transpose(storage, basis, source, x, result);
+      } else {
+        op.mult(storage, basis, source, x, result);
+      }
+    } else {
+      FixedDimensionDispatcher<BASIS, DIM + 1>::mult(storage, source, x, result, transposed);
+    }
+  }
+};
+
+template <class BASIS>
+struct FixedDimensionDispatcher<BASIS, OperationMultipleEvalFixedDimension::MAX_DIMENSION + 1> {
+  static void mult(GridStorage&, DataVector&, DataMatrix&, DataVector&, bool) {
+    throw operation_exception(
+        "OperationMultipleEvalFixedDimension: no kernel for this dimensionality");
+  }
+};
+
+template <class BASIS>
+void multFixedDimension(GridStorage& storage, DataVector& source, DataMatrix& x,
+                        DataVector& result, bool transposed) {
+  FixedDimensionDispatcher<BASIS, OperationMultipleEvalFixedDimension::MIN_DIMENSION>::mult(
+      storage, source, x, result, transposed);
+}
+
+}  // namespace
+
+OperationMultipleEvalFixedDimension::OperationMultipleEvalFixedDimension(Grid& grid,
+                                                                         DataMatrix& dataset)
+    : OperationMultipleEval(grid, dataset), storage(grid.getStorage()) {
+  if (!isSupported(grid)) {
+    throw factory_exception(
+        "OperationMultipleEvalFixedDimension: grid type or dimensionality not supported");
+  }
+}
+
+void OperationMultipleEvalFixedDimension::mult(DataVector& alpha, DataVector& result) {
+  // a cached matrix is cheaper to apply than any evaluation of the basis functions, without one
+  // (disabled or over budget) the fixed dimension kernel is used
+  if (useMatrixCache()) {
+    matrixCache.mult(alpha, result);
+  } else if (grid.getType() == GridType::Linear) {
+    multFixedDimension<SLinearBase>(storage, alpha, dataset, result, false);
+  } else {
+    multFixedDimension<SLinearModifiedBase>(storage, alpha, dataset, result, false);
+  }
+}
+
+void OperationMultipleEvalFixedDimension::multTranspose(DataVector& source, DataVector& result) {
+  if (useMatrixCache()) {
+    matrixCache.multTranspose(source, result);
+  } else if (grid.getType() == GridType::Linear) {
+    multFixedDimension<SLinearBase>(storage, source, dataset, result, true);
+  } else {
+    multFixedDimension<SLinearModifiedBase>(storage, source, dataset, result, true);
+  }
+}
+
+void OperationMultipleEvalFixedDimension::multMultiple(DataMatrix& alphas, DataMatrix& result) {
+  // all columns share the basis evaluations, this pays off more than the fixed dimension
+  if (grid.getType() == GridType::Linear) {
+    AlgorithmDGEMV<SLinearBase> op;
+    SLinearBase basis;
+    op.mult_multiple(storage, basis, alphas, dataset, result);
+  } else {
+    AlgorithmDGEMV<SLinearModifiedBase> op;
+    SLinearModifiedBase basis;
+    op.mult_multiple(storage, basis, alphas, dataset, result);
+  }
+}
+
+void OperationMultipleEvalFixedDimension::multTransposeMultiple(DataMatrix& sources,
+                                                                DataMatrix& result) {
+  if (grid.getType() == GridType::Linear) {
+    AlgorithmDGEMV<SLinearBase> op;
+    SLinearBase basis;
+    op.mult_transposed_multiple(storage, basis, sources, dataset, result);
+  } else {
+    AlgorithmDGEMV<SLinearModifiedBase> op;
+    SLinearModifiedBase basis;
+    op.mult_transposed_multiple(storage, basis, sources, dataset, result);
+  }
+}
+
+double OperationMultipleEvalFixedDimension::getDuration() { return 0.0; }
+
+std::string OperationMultipleEvalFixedDimension::getImplementationName() {
+  return "FIXED_DIMENSION";
+}
+
+bool OperationMultipleEvalFixedDimension::useMatrixCache() {
+  if (grid.getType() == GridType::Linear) {
+    AlgorithmDGEMV<SLinearBase> op;
+    SLinearBase basis;
+    return op.use_cache(storage, basis, dataset, matrixCache);
+  } else {
+    AlgorithmDGEMV<SLinearModifiedBase> op;
+    SLinearModifiedBase basis;
+    return op.use_cache(storage, basis, dataset, matrixCache);
+  }
+}
+
+bool OperationMultipleEvalFixedDimension::isSupported(Grid& grid) {
+  const size_t dim = grid.getDimension();
+  return ((grid.getType() == GridType::Linear) || (grid.getType() == GridType::ModLinear)) &&
+         (dim >= MIN_DIMENSION) && (dim <= MAX_DIMENSION);
+}
+
+}  // namespace base
+}  // namespace sgpp
@@ -0,0 +1,75 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef OPERATIONMULTIPLEEVALFIXEDDIMENSION_HPP
+#define OPERATIONMULTIPLEEVALFIXEDDIMENSION_HPP
+
+#include <sgpp/base/grid/GridStorage.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <string>
+
+namespace sgpp {
+namespace base {
+
+/**
+ * OperationMultipleEval for grids with linear or modified linear basis functions (no boundary),
+ * whose kernels are instantiated for every dimensionality between MIN_DIMENSION and
+ * MAX_DIMENSION (see AlgorithmMultipleEvaluationFixedDimension).
+ * op_factory::createOperationMultipleEval selects this operation automatically if
+ * isSupported() holds, otherwise the runtime-dimension operations are used.
+ */
+class OperationMultipleEvalFixedDimension : public OperationMultipleEval {
+ public:
+  /// smallest dimensionality with a specialized kernel
+  static const size_t MIN_DIMENSION = 2;
+  /// largest dimensionality with a specialized kernel
+  static const size_t MAX_DIMENSION = 12;
+
+  /**
+   * Constructor
+   *
+   * @param grid grid of type Linear or ModLinear with MIN_DIMENSION <= d <= MAX_DIMENSION
+   * @param dataset the dataset that should be evaluated
+   */
+  OperationMultipleEvalFixedDimension(Grid& grid, DataMatrix& dataset);
+
+  /**
+   * Destructor
+   */
+  ~OperationMultipleEvalFixedDimension() override {}
+
+  void mult(DataVector& alpha, DataVector& result) override;
+  void multTranspose(DataVector& source, DataVector& result) override;
+  void multMultiple(DataMatrix& alphas, DataMatrix& result) override;
+  void multTransposeMultiple(DataMatrix& sources, DataMatrix& result) override;
+
+  double getDuration() override;
+
+  std::string getImplementationName() override;
+
+  /**
+   * @param grid grid to check
+   * @return whether a specialized kernel exists for the type and dimensionality of the grid
+   */
+  static bool isSupported(Grid& grid);
+
+ protected:
+  /// reference to the grid's GridStorage object
+  GridStorage& storage;
+
+  /**
+   * @return true if caching is enabled and the cached matrix for the grid and the dataset is
+   * available (it is built if necessary)
+   */
+  bool useMatrixCache();
+};
+
+}  // namespace base
+}  // namespace sgpp
+
+#endif /* OPERATIONMULTIPLEEVALFIXEDDIMENSION_HPP */
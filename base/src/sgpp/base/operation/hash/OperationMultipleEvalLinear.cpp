@@ -3,6 +3,7 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
+#include <sgpp/base/algorithm/AlgorithmDGEMV.hpp>
 #include <sgpp/base/algorithm/AlgorithmMultipleEvaluation.hpp>
 #include <sgpp/base/operation/hash/OperationMultipleEvalLinear.hpp>
 #include <sgpp/base/operation/hash/common/basis/LinearBasis.hpp>
@@ -13,19 +14,49 @@ namespace sgpp {
 namespace base {
 
 void OperationMultipleEvalLinear::mult(DataVector& alpha, DataVector& result) {
-  AlgorithmMultipleEvaluation<SLinearBase> op;
   LinearBasis<unsigned int, unsigned int> base;
 
+  // apply the cached matrix if available, otherwise (disabled or over budget) fall back to
+  // AlgorithmMultipleEvaluation, which is faster than AlgorithmDGEMV
+  AlgorithmDGEMV<SLinearBase> cacheOp;
+
+  if (cacheOp.use_cache(storage, base, this->dataset, matrixCache)) {
+    matrixCache.mult(alpha, result);
+    return;
+  }
+
+  AlgorithmMultipleEvaluation<SLinearBase> op;
   op.mult(storage, base, alpha, this->dataset, result);
 }
 
 void OperationMultipleEvalLinear::multTranspose(DataVector& alpha, DataVector& result) {
-  AlgorithmMultipleEvaluation<SLinearBase> op;
   LinearBasis<unsigned int, unsigned int> base;
 
+  AlgorithmDGEMV<SLinearBase> cacheOp;
+
+  if (cacheOp.use_cache(storage, base, this->dataset, matrixCache)) {
+    matrixCache.multTranspose(alpha, result);
+    return;
+  }
+
+  AlgorithmMultipleEvaluation<SLinearBase> op;
   op.mult_transpose(storage, base, alpha, this->dataset, result);
 }
 
+void OperationMultipleEvalLinear::multMultiple(DataMatrix& alphas, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  op.mult_multiple(storage, base, alphas, this->dataset, result);
+}
+
+void OperationMultipleEvalLinear::multTransposeMultiple(DataMatrix& sources, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearBase> op;
+  LinearBasis<unsigned int, unsigned int> base;
+
+  op.mult_transposed_multiple(storage, base, sources, this->dataset, result);
+}
+
 double OperationMultipleEvalLinear::getDuration() { return 0.0; }
 
 }  // namespace base
@@ -35,6 +35,8 @@ class OperationMultipleEvalLinear : public OperationMultipleEval {
 
   void mult(DataVector& alpha, DataVector& result) override;
   void multTranspose(DataVector& source, DataVector& result) override;
+  void multMultiple(DataMatrix& alphas, DataMatrix& result) override;
+  void multTransposeMultiple(DataMatrix& sources, DataMatrix& result) override;
 
   double getDuration() override;
 
@@ -16,14 +16,14 @@ void OperationMultipleEvalLinearBoundary::mult(DataVector& alpha, DataVector& re
   AlgorithmDGEMV<SLinearBoundaryBase> op;
   LinearBoundaryBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->dataset, result, matrixCache);
 }
 
 void OperationMultipleEvalLinearBoundary::multTranspose(DataVector& source, DataVector& result) {
   AlgorithmDGEMV<SLinearBoundaryBase> op;
   LinearBoundaryBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  op.mult_transposed(storage, base, source, this->dataset, result, matrixCache);
 }
 
 double OperationMultipleEvalLinearBoundary::getDuration() { return 0.0; }
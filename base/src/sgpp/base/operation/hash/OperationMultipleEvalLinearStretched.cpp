@@ -16,14 +16,14 @@ void OperationMultipleEvalLinearStretched::mult(DataVector& alpha, DataVector& r
   AlgorithmDGEMV<SLinearStretchedBase> op;
   LinearStretchedBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->dataset, result, matrixCache);
 }
 
 void OperationMultipleEvalLinearStretched::multTranspose(DataVector& source, DataVector& result) {
   AlgorithmDGEMV<SLinearStretchedBase> op;
   LinearStretchedBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  op.mult_transposed(storage, base, source, this->dataset, result, matrixCache);
 }
 
 double OperationMultipleEvalLinearStretched::getDuration() { return 0.0; }
@@ -16,7 +16,7 @@ void OperationMultipleEvalLinearStretchedBoundary::mult(DataVector& alpha, DataV
   AlgorithmDGEMV<SLinearStretchedBoundaryBase> op;
   LinearStretchedBoundaryBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->dataset, result, matrixCache);
 }
 
 void OperationMultipleEvalLinearStretchedBoundary::multTranspose(DataVector& source,
@@ -24,7 +24,7 @@ void OperationMultipleEvalLinearStretchedBoundary::multTranspose(DataVector& sou
   AlgorithmDGEMV<SLinearStretchedBoundaryBase> op;
   LinearStretchedBoundaryBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  op.mult_transposed(storage, base, source, this->dataset, result, matrixCache);
 }
 
 double OperationMultipleEvalLinearStretchedBoundary::getDuration() { return 0.0; }
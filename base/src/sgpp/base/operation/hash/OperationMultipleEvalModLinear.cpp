@@ -17,14 +17,28 @@ void OperationMultipleEvalModLinear::mult(DataVector& alpha, DataVector& result)
   AlgorithmDGEMV<SLinearModifiedBase> op;
   LinearModifiedBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->dataset, result, matrixCache);
 }
 
 void OperationMultipleEvalModLinear::multTranspose(DataVector& source, DataVector& result) {
   AlgorithmDGEMV<SLinearModifiedBase> op;
   LinearModifiedBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  op.mult_transposed(storage, base, source, this->dataset, result, matrixCache);
+}
+
+void OperationMultipleEvalModLinear::multMultiple(DataMatrix& alphas, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearModifiedBase> op;
+  LinearModifiedBasis<unsigned int, unsigned int> base;
+
+  op.mult_multiple(storage, base, alphas, this->dataset, result);
+}
+
+void OperationMultipleEvalModLinear::multTransposeMultiple(DataMatrix& sources, DataMatrix& result) {
+  AlgorithmDGEMV<SLinearModifiedBase> op;
+  LinearModifiedBasis<unsigned int, unsigned int> base;
+
+  op.mult_transposed_multiple(storage, base, sources, this->dataset, result);
 }
 
 double OperationMultipleEvalModLinear::getDuration() { return 0.0; }
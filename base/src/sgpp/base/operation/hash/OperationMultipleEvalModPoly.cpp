@@ -15,13 +15,13 @@ namespace base {
 void OperationMultipleEvalModPoly::mult(DataVector& alpha, DataVector& result) {
   AlgorithmDGEMV<SPolyModifiedBase> op;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->dataset, result, matrixCache);
 }
 
 void OperationMultipleEvalModPoly::multTranspose(DataVector& source, DataVector& result) {
   AlgorithmDGEMV<SPolyModifiedBase> op;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  op.mult_transposed(storage, base, source, this->dataset, result, matrixCache);
 }
 
 double OperationMultipleEvalModPoly::getDuration() { return 0.0; }
@@ -17,14 +17,14 @@ void OperationMultipleEvalPeriodic::mult(DataVector& alpha, DataVector& result)
   AlgorithmDGEMV<SLinearPeriodicBasis> op;
   LinearPeriodicBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->dataset, result, matrixCache);
 }
 
 void OperationMultipleEvalPeriodic::multTranspose(DataVector& source, DataVector& result) {
   AlgorithmDGEMV<SLinearPeriodicBasis> op;
   LinearPeriodicBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  op.mult_transposed(storage, base, source, this->dataset, result, matrixCache);
 }
 
 double OperationMultipleEvalPeriodic::getDuration() { return 0.0; }
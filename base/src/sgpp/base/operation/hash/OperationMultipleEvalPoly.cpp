@@ -16,13 +16,13 @@ namespace base {
 void OperationMultipleEvalPoly::mult(DataVector& alpha, DataVector& result) {
   AlgorithmDGEMV<SPolyBase> op;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->dataset, result, matrixCache);
 }
 
 void OperationMultipleEvalPoly::multTranspose(DataVector& source, DataVector& result) {
   AlgorithmDGEMV<SPolyBase> op;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  op.mult_transposed(storage, base, source, this->dataset, result, matrixCache);
 }
 
 double OperationMultipleEvalPoly::getDuration() { return 0.0; }
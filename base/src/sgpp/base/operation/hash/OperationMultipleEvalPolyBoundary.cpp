@@ -13,13 +13,13 @@ namespace base {
 void OperationMultipleEvalPolyBoundary::mult(DataVector& alpha, DataVector& result) {
   AlgorithmDGEMV<SPolyBoundaryBase> op;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->dataset, result, matrixCache);
 }
 
 void OperationMultipleEvalPolyBoundary::multTranspose(DataVector& source, DataVector& result) {
   AlgorithmDGEMV<SPolyBoundaryBase> op;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  op.mult_transposed(storage, base, source, this->dataset, result, matrixCache);
 }
 
 double OperationMultipleEvalPolyBoundary::getDuration() { return 0.0; }
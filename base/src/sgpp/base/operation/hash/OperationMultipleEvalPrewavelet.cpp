@@ -18,14 +18,14 @@ void OperationMultipleEvalPrewavelet::mult(DataVector& alpha, DataVector& result
   AlgorithmDGEMV<SPrewaveletBase> op;
   PrewaveletBasis<unsigned int, unsigned int> base;
 
-  op.mult(storage, base, alpha, this->dataset, result);
+  op.mult(storage, base, alpha, this->dataset, result, matrixCache);
 }
 
 void OperationMultipleEvalPrewavelet::multTranspose(DataVector& source, DataVector& result) {
   AlgorithmDGEMV<SPrewaveletBase> op;
   PrewaveletBasis<unsigned int, unsigned int> base;
 
-  op.mult_transposed(storage, base, source, this->dataset, result);
+  op.mult_transposed(storage, base, source, this->dataset, result, matrixCache);
 }
 
 double OperationMultipleEvalPrewavelet::getDuration() { return 0.0; }
@@ -24,6 +24,8 @@ void OperationStencilHierarchisationLinear::doHierarchisation(
   StencilHierarchisationLinear func(this->storage, surplusStencil,
                                     neighborStencil, weightStencil);
   sweep<StencilHierarchisationLinear> s(func, storage);
+  // the functor appends to the stencils, so the poles have to be visited in order
+  s.setParallelPoles(false);
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
@@ -39,6 +41,8 @@ void OperationStencilHierarchisationLinear::doDehierarchisation(
   StencilDehierarchisationLinear func(this->storage, surplusStencil,
                                       neighborStencil, weightStencil);
   sweep<StencilDehierarchisationLinear> s(func, storage);
+  // the functor appends to the stencils, so the poles have to be visited in order
+  s.setParallelPoles(false);
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
@@ -24,6 +24,8 @@ void OperationStencilHierarchisationModLinear::doHierarchisation(
   StencilHierarchisationModLinear func(this->storage, surplusStencil,
                                        neighborStencil, weightStencil);
   sweep<StencilHierarchisationModLinear> s(func, storage);
+  // the functor appends to the stencils, so the poles have to be visited in order
+  s.setParallelPoles(false);
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
@@ -39,6 +41,8 @@ void OperationStencilHierarchisationModLinear::doDehierarchisation(
   StencilDehierarchisationModLinear func(this->storage, surplusStencil,
                                          neighborStencil, weightStencil);
   sweep<StencilDehierarchisationModLinear> s(func, storage);
+  // the functor appends to the stencils, so the poles have to be visited in order
+  s.setParallelPoles(false);
 
   // Execute hierarchisation in every dimension of the grid
   for (size_t i = 0; i < this->storage.getDimension(); i++) {
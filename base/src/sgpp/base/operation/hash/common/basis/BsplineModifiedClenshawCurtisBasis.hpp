@@ -15,9 +15,6 @@
 #include <cmath>
 #include <vector>
 #include <algorithm>
-#ifdef _OPENMP
-#include <omp.h>
-#endif
 
 namespace sgpp {
 namespace base {
@@ -40,27 +37,22 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    *                      (if it's even, degree - 1 is used)
    */
   explicit BsplineModifiedClenshawCurtisBasis(size_t degree)
-      : degree(degree),
-        xi(std::vector<double>(degree + 2, 0.0)),
-        clenshawCurtisTable(ClenshawCurtisTable::getInstance()) {
+      : degree(degree), clenshawCurtisTable(ClenshawCurtisTable::getInstance()) {
     if (degree < 1) {
       this->degree = 1;
     } else if (degree % 2 == 0) {
       this->degree = degree - 1;
     }
-#ifdef _OPENMP
-    omp_init_nest_lock(&xiLock);
-#endif
+
+    // the quadrature rule of getIntegral() only depends on the degree
+    GaussLegendreQuadRule1D::getInstance().getLevelPointsAndWeightsNormalized(
+        (this->degree + 1) / 2, coordinates, weights);
   }
 
   /**
    * Destructor.
    */
-  ~BsplineModifiedClenshawCurtisBasis() override {
-#ifdef _OPENMP
-    omp_destroy_nest_lock(&xiLock);
-#endif
-  }
+  ~BsplineModifiedClenshawCurtisBasis() override {}
 
   /**
    * @param l     level of the grid point
@@ -96,20 +88,17 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
 
     const IT hInv = static_cast<IT>(1) << l;
     double res = 0.0;
-#ifdef _OPENMP
-    omp_set_nest_lock(&xiLock);
-#endif
+    double* xi = getKnotBuffer();
+
     if (i == 1) {
-      res = modifiedBSpline(l, hInv, x, degree);
+      res = modifiedBSpline(l, hInv, x, degree, xi);
     } else if (i == hInv - 1) {
-      res = modifiedBSpline(l, hInv, 1.0 - x, degree);
+      res = modifiedBSpline(l, hInv, 1.0 - x, degree, xi);
     } else {
-      constructKnots(l, i, hInv);
-      res = nonUniformBSpline(x, degree, 0);
+      constructKnots(l, i, hInv, xi);
+      res = nonUniformBSpline(x, degree, 0, xi);
     }
-#ifdef _OPENMP
-    omp_unset_nest_lock(&xiLock);
-#endif
+
     return res;
   }
 
@@ -128,20 +117,17 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
     const IT hInv = static_cast<IT>(1) << l;
     double res = 0.0;
 
-#ifdef _OPENMP
-    omp_set_nest_lock(&xiLock);
-#endif
+    double* xi = getKnotBuffer();
+
     if (i == 1) {
-      res = modifiedBSplineDx(l, hInv, x, degree);
+      res = modifiedBSplineDx(l, hInv, x, degree, xi);
     } else if (i == hInv - 1) {
-      res = -modifiedBSplineDx(l, hInv, 1.0 - x, degree);
+      res = -modifiedBSplineDx(l, hInv, 1.0 - x, degree, xi);
     } else {
-      constructKnots(l, i, hInv);
-      res = nonUniformBSplineDx(x, degree, 0);
+      constructKnots(l, i, hInv, xi);
+      res = nonUniformBSplineDx(x, degree, 0, xi);
     }
-#ifdef _OPENMP
-    omp_unset_nest_lock(&xiLock);
-#endif
+
     return res;
   }
 
@@ -160,20 +146,17 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
     const IT hInv = static_cast<IT>(1) << l;
     double res = 0.0;
 
-#ifdef _OPENMP
-    omp_set_nest_lock(&xiLock);
-#endif
+    double* xi = getKnotBuffer();
+
     if (i == 1) {
-      res = modifiedBSplineDxDx(l, hInv, x, degree);
+      res = modifiedBSplineDxDx(l, hInv, x, degree, xi);
     } else if (i == hInv - 1) {
-      res = modifiedBSplineDxDx(l, hInv, 1.0 - x, degree);
+      res = modifiedBSplineDxDx(l, hInv, 1.0 - x, degree, xi);
     } else {
-      constructKnots(l, i, hInv);
-      res = nonUniformBSplineDxDx(x, degree, 0);
+      constructKnots(l, i, hInv, xi);
+      res = nonUniformBSplineDxDx(x, degree, 0, xi);
     }
-#ifdef _OPENMP
-    omp_unset_nest_lock(&xiLock);
-#endif
+
     return res;
   }
 
@@ -196,20 +179,10 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
     size_t erster_abschnitt = std::max(0, -static_cast<int>(i - (degree + 1) / 2));
     size_t letzter_abschnitt = std::min(degree, hInv + (degree + 1) / 2 - i - 1);
     size_t quadLevel = (degree + 1) / 2;
-#ifdef _OPENMP
-    omp_set_nest_lock(&xiLock);
-#endif
-    if (!integrationInitialized) {
-      sgpp::base::GaussLegendreQuadRule1D gauss;
-      gauss.getLevelPointsAndWeightsNormalized(quadLevel, coordinates, weights);
-      integrationInitialized = true;
-    }
-    constructKnots(l, i, hInv);
+    // eval() uses the knot buffer of the thread, so the knots are kept separately here
+    std::vector<double> xi(degree + 2);
+    constructKnots(l, i, hInv, xi.data());
     for (size_t j = erster_abschnitt; j <= letzter_abschnitt; j++) {
-      // function eval changes the knots if i == 1 or i == hInv - 1; we have to reconstruct them
-      if (i == 1 || i == hInv - 1) {
-        constructKnots(l, i, hInv);
-      }
       double left = std::max(0.0, xi[j]);
       double right = std::min(1.0, xi[j + 1]);
       double h = right - left;
@@ -220,26 +193,30 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
       }
       res += h * temp_res;
     }
-#ifdef _OPENMP
-    omp_unset_nest_lock(&xiLock);
-#endif
     return res;
   }
 
  protected:
   /// degree of the B-spline
   size_t degree;
-  /// temporary helper vector of fixed size p+2 containing B-spline knots
-  std::vector<double> xi;
   /// reference to the Clenshaw-Curtis cache table
   ClenshawCurtisTable& clenshawCurtisTable;
-
-#ifdef _OPENMP
-  omp_nest_lock_t xiLock;
-#endif
+  /// Gauss-Legendre points of getIntegral()
   DataVector coordinates;
+  /// Gauss-Legendre weights of getIntegral()
   DataVector weights;
-  bool integrationInitialized = false;
+
+  /**
+   * The knots are constructed for every evaluation, so each thread has its own buffer and the
+   * basis can be evaluated concurrently without locking.
+   *
+   * @return      buffer of size p+2 for the B-spline knots of the calling thread
+   */
+  inline double* getKnotBuffer() const {
+    static thread_local std::vector<double> xi;
+    xi.resize(degree + 2);
+    return xi.data();
+  }
 
   /**
    * @param l     level of the grid point
@@ -286,8 +263,9 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param l     level of basis function
    * @param i     index of basis function
    * @param hInv  2^l
+   * @param xi    buffer of size p+2 for the knots
    */
-  inline void constructKnots(LT l, IT i, IT hInv) {
+  inline void constructKnots(LT l, IT i, IT hInv, double* xi) const {
     const IT degreePlusOneHalved = static_cast<IT>(degree + 1) / 2;
 
     for (IT k = 0; k < degree + 2; k++) {
@@ -306,8 +284,9 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param l     level of basis function
    * @param ni    negative index -i of basis function
    * @param hInv  2^l
+   * @param xi    buffer of size p+2 for the knots
    */
-  inline void constructKnotsNegativeIndex(LT l, IT ni, IT hInv) {
+  inline void constructKnotsNegativeIndex(LT l, IT ni, IT hInv, double* xi) const {
     const IT degreePlusOneHalved = static_cast<IT>(degree + 1) / 2;
 
     for (IT k = 0; k < degree + 2; k++) {
@@ -323,10 +302,11 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @param p     B-spline degree
    * @param k     index of B-spline in the knot sequence
+   * @param xi    knot sequence
    * @return      value of non-uniform B-spline with knots
    *              \f$\{\xi_k, ... \xi_{k+p+1}\}\f$
    */
-  inline double nonUniformBSpline(double x, size_t p, size_t k) const {
+  inline double nonUniformBSpline(double x, size_t p, size_t k, const double* xi) const {
     /*if (p == 0) {
      // characteristic function of [xi[k], xi[k+1])
      return (((x >= xi[k]) && (x < xi[k + 1])) ? 1.0 : 0.0);
@@ -925,9 +905,9 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
        }*/
 
       default:
-        return (x - xi[k]) / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k) +
+        return (x - xi[k]) / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k, xi) +
                (xi[k + p + 1] - x) / (xi[k + p + 1] - xi[k + 1]) *
-                   nonUniformBSpline(x, p - 1, k + 1);
+                   nonUniformBSpline(x, p - 1, k + 1, xi);
     }
   }
 
@@ -935,10 +915,11 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @param p     B-spline degree
    * @param k     index of B-spline in the knot sequence
+   * @param xi    knot sequence
    * @return      value of derivative of non-uniform B-spline with knots
    *              \f$\{\xi_k, ... \xi_{k+p+1}\}\f$
    */
-  inline double nonUniformBSplineDx(double x, size_t p, size_t k) const {
+  inline double nonUniformBSplineDx(double x, size_t p, size_t k, const double* xi) const {
     /*if (p == 0) {
      return 0.0;
      } else if ((x < xi[k]) || (x >= xi[k + p + 1])) {
@@ -3101,8 +3082,8 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
       default:
         const double pDbl = static_cast<double>(p);
 
-        return pDbl / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k) -
-               pDbl / (xi[k + p + 1] - xi[k + 1]) * nonUniformBSpline(x, p - 1, k + 1);
+        return pDbl / (xi[k + p] - xi[k]) * nonUniformBSpline(x, p - 1, k, xi) -
+               pDbl / (xi[k + p + 1] - xi[k + 1]) * nonUniformBSpline(x, p - 1, k + 1, xi);
     }
   }
 
@@ -3110,10 +3091,11 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param x     evaluation point
    * @param p     B-spline degree
    * @param k     index of B-spline in the knot sequence
+   * @param xi    knot sequence
    * @return      value of 2nd derivative of non-uniform B-spline
    *              with knots \f$\{\xi_k, ... \xi_{k+p+1}\}\f$
    */
-  inline double nonUniformBSplineDxDx(double x, size_t p, size_t k) const {
+  inline double nonUniformBSplineDxDx(double x, size_t p, size_t k, const double* xi) const {
     /*if (p <= 1) {
      return 0.0;
      } else if ((x < xi[k]) || (x >= xi[k + p + 1])) {
@@ -7464,9 +7446,9 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
         const double alphaKp1Pm1 = (pDbl - 1.0) / (xi[k + p] - xi[k + 1]);
         const double alphaKp2Pm1 = (pDbl - 1.0) / (xi[k + p + 1] - xi[k + 2]);
 
-        return alphaKP * alphaKPm1 * nonUniformBSpline(x, p - 2, k) -
-               (alphaKP + alphaKp1P) * alphaKp1Pm1 * nonUniformBSpline(x, p - 2, k + 1) +
-               alphaKp1P * alphaKp2Pm1 * nonUniformBSpline(x, p - 2, k + 2);
+        return alphaKP * alphaKPm1 * nonUniformBSpline(x, p - 2, k, xi) -
+               (alphaKP + alphaKp1P) * alphaKp1Pm1 * nonUniformBSpline(x, p - 2, k + 1, xi) +
+               alphaKp1P * alphaKp2Pm1 * nonUniformBSpline(x, p - 2, k + 2, xi);
     }
   }
 
@@ -7475,21 +7457,22 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param hInv  2^l
    * @param x     evaluation point
    * @param p     B-spline degree
+   * @param xi    buffer of size p+2 for the knots
    * @return      value of modified
    *              Clenshaw-Curtis B-spline (e.g. index == 1)
    */
-  inline double modifiedBSpline(LT l, IT hInv, double x, size_t p) {
+  inline double modifiedBSpline(LT l, IT hInv, double x, size_t p, double* xi) const {
     double y = 0.0;
-    constructKnots(l, 1, hInv);
-    y += 1.0 * nonUniformBSpline(x, degree, 0);
-    constructKnots(l, 0, hInv);
-    y += 2.0 * nonUniformBSpline(x, degree, 0);
+    constructKnots(l, 1, hInv, xi);
+    y += 1.0 * nonUniformBSpline(x, degree, 0, xi);
+    constructKnots(l, 0, hInv, xi);
+    y += 2.0 * nonUniformBSpline(x, degree, 0, xi);
 
     // the upper summation bound is defined to be ceil((p + 1) / 2.0),
     // which is the same as (p + 2) / 2 written in C
     for (IT k = 2; k <= (p + 2) / 2; k++) {
-      constructKnotsNegativeIndex(l, k - 1, hInv);
-      y += static_cast<double>(k + 1) * nonUniformBSpline(x, degree, 0);
+      constructKnotsNegativeIndex(l, k - 1, hInv, xi);
+      y += static_cast<double>(k + 1) * nonUniformBSpline(x, degree, 0, xi);
     }
 
     return y;
@@ -7500,21 +7483,22 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param hInv  2^l
    * @param x     evaluation point
    * @param p     B-spline degree
+   * @param xi    buffer of size p+2 for the knots
    * @return      value of derivative of modified
    *              Clenshaw-Curtis B-spline (e.g. index == 1)
    */
-  inline double modifiedBSplineDx(LT l, IT hInv, double x, size_t p) {
+  inline double modifiedBSplineDx(LT l, IT hInv, double x, size_t p, double* xi) const {
     double y = 0.0;
-    constructKnots(l, 1, hInv);
-    y += 1.0 * nonUniformBSplineDx(x, degree, 0);
-    constructKnots(l, 0, hInv);
-    y += 2.0 * nonUniformBSplineDx(x, degree, 0);
+    constructKnots(l, 1, hInv, xi);
+    y += 1.0 * nonUniformBSplineDx(x, degree, 0, xi);
+    constructKnots(l, 0, hInv, xi);
+    y += 2.0 * nonUniformBSplineDx(x, degree, 0, xi);
 
     // the upper summation bound is defined to be ceil((p + 1) / 2.0),
     // which is the same as (p + 2) / 2 written in C
     for (IT k = 2; k <= (p + 2) / 2; k++) {
-      constructKnotsNegativeIndex(l, k - 1, hInv);
-      y += static_cast<double>(k + 1) * nonUniformBSplineDx(x, degree, 0);
+      constructKnotsNegativeIndex(l, k - 1, hInv, xi);
+      y += static_cast<double>(k + 1) * nonUniformBSplineDx(x, degree, 0, xi);
     }
 
     return y;
@@ -7525,21 +7509,22 @@ class BsplineModifiedClenshawCurtisBasis : public Basis<LT, IT> {
    * @param hInv  2^l
    * @param x     evaluation point
    * @param p     B-spline degree
+   * @param xi    buffer of size p+2 for the knots
    * @return      value of 2nd derivative of modified
    *              Clenshaw-Curtis B-spline (e.g. index == 1)
    */
-  inline double modifiedBSplineDxDx(LT l, IT hInv, double x, size_t p) {
+  inline double modifiedBSplineDxDx(LT l, IT hInv, double x, size_t p, double* xi) const {
     double y = 0.0;
-    constructKnots(l, 1, hInv);
-    y += 1.0 * nonUniformBSplineDxDx(x, degree, 0);
-    constructKnots(l, 0, hInv);
-    y += 2.0 * nonUniformBSplineDxDx(x, degree, 0);
+    constructKnots(l, 1, hInv, xi);
+    y += 1.0 * nonUniformBSplineDxDx(x, degree, 0, xi);
+    constructKnots(l, 0, hInv, xi);
+    y += 2.0 * nonUniformBSplineDxDx(x, degree, 0, xi);
 
     // the upper summation bound is defined to be ceil((p + 1) / 2.0),
     // which is the same as (p + 2) / 2 written in C
     for (IT k = 2; k <= (p + 2) / 2; k++) {
-      constructKnotsNegativeIndex(l, k - 1, hInv);
-      y += static_cast<double>(k + 1) * nonUniformBSplineDxDx(x, degree, 0);
+      constructKnotsNegativeIndex(l, k - 1, hInv, xi);
+      y += static_cast<double>(k + 1) * nonUniformBSplineDxDx(x, degree, 0, xi);
     }
 
     return y;
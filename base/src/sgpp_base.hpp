@@ -43,7 +43,10 @@
 #include <sgpp/base/algorithm/AlgorithmEvaluation.hpp>
 #include <sgpp/base/algorithm/AlgorithmEvaluationTransposed.hpp>
 #include <sgpp/base/algorithm/AlgorithmMultipleEvaluation.hpp>
+#include <sgpp/base/algorithm/AlgorithmMultipleEvaluationFixedDimension.hpp>
+#include <sgpp/base/algorithm/EvaluationMatrixCache.hpp>
 #include <sgpp/base/algorithm/GetAffectedBasisFunctions.hpp>
+#include <sgpp/base/algorithm/ScatterTransposed.hpp>
 #include <sgpp/base/application/ScreenOutput.hpp>
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
@@ -7,6 +7,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/common/BoundingBox.hpp>
 #include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashGenerator.hpp>
 #include <sgpp/base/grid/generation/hashmap/HashRefinement.hpp>
@@ -17,6 +18,7 @@
 #include <string>
 #include <vector>
 
+using sgpp::base::BoundingBox;
 using sgpp::base::DataVector;
 using sgpp::base::HashGenerator;
 using sgpp::base::HashGridPoint;
@@ -194,6 +196,40 @@ BOOST_AUTO_TEST_CASE(testSeq) {
   BOOST_CHECK(s.isInvalidSequenceNumber(seq));
 }
 
+BOOST_AUTO_TEST_CASE(testModificationCount) {
+  HashGridStorage s(2);
+  HashGenerator g;
+  HashRefinement r;
+
+  size_t count = s.getModificationCount();
+  g.regular(s, 2);
+  BOOST_CHECK_GT(s.getModificationCount(), count);
+
+  // read-only accesses do not count
+  count = s.getModificationCount();
+  s.recalcLeafProperty();
+  s.serialize();
+  BOOST_CHECK_EQUAL(s.getModificationCount(), count);
+
+  DataVector alpha(s.getSize(), 1.0);
+  SurplusRefinementFunctor functor(alpha, 1);
+  r.free_refine(s, functor);
+  BOOST_CHECK_GT(s.getModificationCount(), count);
+
+  count = s.getModificationCount();
+  s.deleteLast();
+  BOOST_CHECK_GT(s.getModificationCount(), count);
+
+  count = s.getModificationCount();
+  BoundingBox boundingBox(2);
+  s.setBoundingBox(boundingBox);
+  BOOST_CHECK_GT(s.getModificationCount(), count);
+
+  count = s.getModificationCount();
+  s.clear();
+  BOOST_CHECK_GT(s.getModificationCount(), count);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE(TestHashGridStorageWithT)
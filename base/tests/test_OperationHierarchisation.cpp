@@ -11,6 +11,11 @@
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <memory>
 #include <vector>
 
 using sgpp::base::DataVector;
@@ -20,6 +25,7 @@ using sgpp::base::GridGenerator;
 using sgpp::base::GridStorage;
 using sgpp::base::OperationEval;
 using sgpp::base::OperationHierarchisation;
+using sgpp::base::OperationStencilHierarchisation;
 using sgpp::base::Stretching;
 using sgpp::base::Stretching1D;
 
@@ -89,6 +95,79 @@ double parabolaBoundary(DataVector& input) {
   return result;
 }
 
+/**
+ * Runs (de)hierarchisation with the given number of threads and appends the resulting
+ * coefficients and stencils to the output vectors.
+ */
+void computeStencils(Grid& grid, int numThreads, std::vector<DataVector>& coefficients,
+                     std::vector<OperationStencilHierarchisation::IndexStencil>& indexStencils,
+                     std::vector<OperationStencilHierarchisation::WeightStencil>& weightStencils) {
+#ifdef _OPENMP
+  omp_set_num_threads(numThreads);
+#endif
+  GridStorage& gridStore = grid.getStorage();
+  DataVector coords(gridStore.getDimension());
+  DataVector alpha(gridStore.getSize());
+
+  for (size_t n = 0; n < gridStore.getSize(); n++) {
+    gridStore.getCoordinates(gridStore[n], coords);
+    alpha[n] = parabola(coords);
+  }
+
+  std::unique_ptr<OperationHierarchisation> op(
+      sgpp::op_factory::createOperationHierarchisation(grid));
+  OperationStencilHierarchisation& stencilOp = dynamic_cast<OperationStencilHierarchisation&>(*op);
+
+  stencilOp.doHierarchisation(alpha);
+  coefficients.push_back(alpha);
+  indexStencils.push_back(stencilOp.getSurplusStencil());
+  indexStencils.push_back(stencilOp.getNeighborStencil());
+  weightStencils.push_back(stencilOp.getWeightStencil());
+
+  stencilOp.doDehierarchisation(alpha);
+  coefficients.push_back(alpha);
+  indexStencils.push_back(stencilOp.getSurplusStencil());
+  indexStencils.push_back(stencilOp.getNeighborStencil());
+  weightStencils.push_back(stencilOp.getWeightStencil());
+}
+
+void testStencilsMultipleThreads(Grid& grid) {
+  grid.getGenerator().regular(5);
+
+  int maxThreads = 1;
+#ifdef _OPENMP
+  maxThreads = omp_get_max_threads();
+#endif
+
+  std::vector<DataVector> serialCoefficients, parallelCoefficients;
+  std::vector<OperationStencilHierarchisation::IndexStencil> serialIndices, parallelIndices;
+  std::vector<OperationStencilHierarchisation::WeightStencil> serialWeights, parallelWeights;
+  computeStencils(grid, 1, serialCoefficients, serialIndices, serialWeights);
+  computeStencils(grid, 4, parallelCoefficients, parallelIndices, parallelWeights);
+
+#ifdef _OPENMP
+  omp_set_num_threads(maxThreads);
+#endif
+
+  for (size_t k = 0; k < serialCoefficients.size(); k++) {
+    BOOST_CHECK_EQUAL_COLLECTIONS(
+        serialCoefficients[k].getPointer(),
+        serialCoefficients[k].getPointer() + serialCoefficients[k].getSize(),
+        parallelCoefficients[k].getPointer(),
+        parallelCoefficients[k].getPointer() + parallelCoefficients[k].getSize());
+  }
+
+  for (size_t k = 0; k < serialIndices.size(); k++) {
+    BOOST_CHECK_EQUAL_COLLECTIONS(serialIndices[k].begin(), serialIndices[k].end(),
+                                  parallelIndices[k].begin(), parallelIndices[k].end());
+  }
+
+  for (size_t k = 0; k < serialWeights.size(); k++) {
+    BOOST_CHECK_EQUAL_COLLECTIONS(serialWeights[k].begin(), serialWeights[k].end(),
+                                  parallelWeights[k].begin(), parallelWeights[k].end());
+  }
+}
+
 BOOST_AUTO_TEST_SUITE(testHierarchization)
 
 BOOST_AUTO_TEST_CASE(testHierarchisationLinear) {
@@ -307,4 +386,14 @@ BOOST_AUTO_TEST_CASE(testHierarchisationStretchedTruncatedBoundary3D) {
   testHierarchisationDehierarchisation(*grid, level, &parabolaBoundary, 1e-12, false);
 }
 
+BOOST_AUTO_TEST_CASE(testStencilHierarchisationLinearThreads) {
+  std::unique_ptr<Grid> grid(Grid::createLinearGridStencil(3));
+  testStencilsMultipleThreads(*grid);
+}
+
+BOOST_AUTO_TEST_CASE(testStencilHierarchisationModLinearThreads) {
+  std::unique_ptr<Grid> grid(Grid::createModLinearGridStencil(3));
+  testStencilsMultipleThreads(*grid);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
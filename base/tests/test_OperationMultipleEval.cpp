@@ -9,8 +9,21 @@
 #include <sgpp/base/datatypes/DataMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/functors/SurplusRefinementFunctor.hpp>
 // #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationEval.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalFixedDimension.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalLinear.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEvalModLinear.hpp>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <memory>
+#include <random>
+#include <vector>
 
 using sgpp::base::BoundingBox1D;
 using sgpp::base::DataMatrix;
@@ -18,6 +31,7 @@ using sgpp::base::DataVector;
 using sgpp::base::Grid;
 using sgpp::base::GridStorage;
 using sgpp::base::OperationMultipleEval;
+using sgpp::base::SurplusRefinementFunctor;
 
 BOOST_AUTO_TEST_SUITE(TestOperationMultipleEval)
 
@@ -78,4 +92,381 @@ BOOST_AUTO_TEST_CASE(testOperationMultipleEval) {
   BOOST_CHECK_CLOSE(result[2], result_ref[2], 1e-7);
 }
 
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalFixedDimension) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  const size_t numberDataPoints = 50;
+
+  for (size_t dim : {2, 3, 5, 12}) {
+    DataMatrix dataset(numberDataPoints, dim);
+
+    for (size_t i = 0; i < dataset.getSize(); i++) {
+      dataset[i] = distribution(generator);
+    }
+
+    // points on the upper border of the domain take a special path in the descent
+    dataset.set(0, 0, 1.0);
+
+    for (bool modified : {false, true}) {
+      std::unique_ptr<Grid> grid(modified ? Grid::createModLinearGrid(dim)
+                                          : Grid::createLinearGrid(dim));
+      grid->getGenerator().regular(3);
+      const size_t N = grid->getSize();
+
+      std::unique_ptr<OperationMultipleEval> reference;
+
+      if (modified) {
+        reference.reset(new sgpp::base::OperationMultipleEvalModLinear(*grid, dataset));
+      } else {
+        reference.reset(new sgpp::base::OperationMultipleEvalLinear(*grid, dataset));
+      }
+
+      std::unique_ptr<OperationMultipleEval> op(
+          sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+      BOOST_CHECK_EQUAL(op->getImplementationName(), "FIXED_DIMENSION");
+
+      DataVector alpha(N);
+
+      for (size_t i = 0; i < N; i++) {
+        alpha[i] = distribution(generator);
+      }
+
+      DataVector result(numberDataPoints);
+      DataVector resultReference(numberDataPoints);
+      op->mult(alpha, result);
+      reference->mult(alpha, resultReference);
+
+      for (size_t i = 0; i < numberDataPoints; i++) {
+        BOOST_CHECK_SMALL(result[i] - resultReference[i], 1e-12);
+      }
+
+      DataVector resultTransposed(N);
+      DataVector resultTransposedReference(N);
+      op->multTranspose(result, resultTransposed);
+      reference->multTranspose(result, resultTransposedReference);
+
+      for (size_t i = 0; i < N; i++) {
+        BOOST_CHECK_SMALL(resultTransposed[i] - resultTransposedReference[i], 1e-10);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalMultiple) {
+  std::mt19937 generator(4321);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  const size_t numberDataPoints = 40;
+  const size_t numberColumns = 3;
+
+  for (size_t dim : {1, 3}) {
+    // the unit cube and the box [-1, 3]^d, for which some of the data points lie outside of it
+    for (bool unitCube : {true, false}) {
+      DataMatrix dataset(numberDataPoints, dim);
+
+      for (size_t i = 0; i < dataset.getSize(); i++) {
+        dataset[i] = unitCube ? distribution(generator) : 5.0 * distribution(generator) - 1.5;
+      }
+
+      for (bool modified : {false, true}) {
+        std::unique_ptr<Grid> grid(modified ? Grid::createModLinearGrid(dim)
+                                            : Grid::createLinearGrid(dim));
+        grid->getGenerator().regular(4);
+        const size_t N = grid->getSize();
+
+        if (!unitCube) {
+          for (size_t d = 0; d < dim; d++) {
+            grid->getBoundingBox().setBoundary(d, BoundingBox1D(-1.0, 3.0));
+          }
+        }
+
+        std::unique_ptr<OperationMultipleEval> op(
+            sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+        DataMatrix alphas(N, numberColumns);
+
+        for (size_t i = 0; i < alphas.getSize(); i++) {
+          alphas[i] = distribution(generator);
+        }
+
+        // all columns at once must match the columns one by one
+        DataMatrix results(numberDataPoints, numberColumns);
+        op->multMultiple(alphas, results);
+        DataMatrix resultsTransposed(N, numberColumns);
+        op->multTransposeMultiple(results, resultsTransposed);
+
+        DataVector alpha(N);
+        DataVector result(numberDataPoints);
+        DataVector resultTransposed(N);
+
+        for (size_t j = 0; j < numberColumns; j++) {
+          alphas.getColumn(j, alpha);
+          op->mult(alpha, result);
+          op->multTranspose(result, resultTransposed);
+
+          for (size_t i = 0; i < numberDataPoints; i++) {
+            BOOST_CHECK_SMALL(results.get(i, j) - result[i], 1e-12);
+          }
+
+          for (size_t i = 0; i < N; i++) {
+            BOOST_CHECK_SMALL(resultsTransposed.get(i, j) - resultTransposed[i], 1e-10);
+          }
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalMatrixCaching) {
+  std::mt19937 generator(1234);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  const size_t dim = 3;
+  const size_t numberDataPoints = 100;
+
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t i = 0; i < dataset.getSize(); i++) {
+    dataset[i] = distribution(generator);
+  }
+
+  for (bool modified : {false, true}) {
+    std::unique_ptr<Grid> grid(modified ? Grid::createModLinearGrid(dim)
+                                        : Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(3);
+
+    std::unique_ptr<OperationMultipleEval> reference(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    std::unique_ptr<OperationMultipleEval> cached(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    std::unique_ptr<OperationMultipleEval> cachedSP(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+    cached->enableMatrixCaching();
+    cachedSP->enableMatrixCaching(sgpp::base::EvaluationMatrixCache::defaultMemoryBudget, true);
+
+    // the second pass refines the grid, the cached matrix has to be rebuilt
+    for (size_t pass = 0; pass < 2; pass++) {
+      if (pass == 1) {
+        DataVector surpluses(grid->getSize(), 1.0);
+        SurplusRefinementFunctor functor(surpluses, 3);
+        grid->getGenerator().refine(functor);
+      }
+
+      const size_t N = grid->getSize();
+      DataVector alpha(N);
+
+      for (size_t i = 0; i < N; i++) {
+        alpha[i] = distribution(generator);
+      }
+
+      DataVector result(numberDataPoints), resultCached(numberDataPoints),
+          resultCachedSP(numberDataPoints);
+      DataVector resultTransposed(N), resultTransposedCached(N), resultTransposedCachedSP(N);
+
+      reference->mult(alpha, result);
+      reference->multTranspose(result, resultTransposed);
+
+      // repeated calls use the cached matrix
+      for (size_t repetition = 0; repetition < 2; repetition++) {
+        cached->mult(alpha, resultCached);
+        cached->multTranspose(result, resultTransposedCached);
+        cachedSP->mult(alpha, resultCachedSP);
+        cachedSP->multTranspose(result, resultTransposedCachedSP);
+
+        BOOST_CHECK(cached->getMatrixCache().isBuilt());
+
+        for (size_t i = 0; i < numberDataPoints; i++) {
+          BOOST_CHECK_SMALL(resultCached[i] - result[i], 1e-12);
+          BOOST_CHECK_SMALL(resultCachedSP[i] - result[i], 1e-5);
+        }
+
+        for (size_t i = 0; i < N; i++) {
+          BOOST_CHECK_SMALL(resultTransposedCached[i] - resultTransposed[i], 1e-10);
+          BOOST_CHECK_SMALL(resultTransposedCachedSP[i] - resultTransposed[i], 1e-4);
+        }
+      }
+    }
+
+    // a matrix exceeding the memory budget is not cached, the kernel evaluates as without caching
+    cached->enableMatrixCaching(1024);
+    DataVector alpha(grid->getSize(), 1.0);
+    DataVector result(numberDataPoints), resultCached(numberDataPoints);
+    DataVector resultTransposed(grid->getSize()), resultTransposedCached(grid->getSize());
+    reference->mult(alpha, result);
+    reference->multTranspose(result, resultTransposed);
+    cached->mult(alpha, resultCached);
+    cached->multTranspose(result, resultTransposedCached);
+    BOOST_CHECK(!cached->getMatrixCache().isBuilt());
+    BOOST_CHECK(cached->getMatrixCache().exceedsMemoryBudget());
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      BOOST_CHECK_SMALL(resultCached[i] - result[i], 1e-12);
+    }
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      BOOST_CHECK_SMALL(resultTransposedCached[i] - resultTransposed[i], 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalMatrixCachingBoundingBox) {
+  std::mt19937 generator(2345);
+  const size_t dim = 3;
+  const size_t numberDataPoints = 200;
+  const double left[dim] = {3.0, -2.0, 0.0};
+  const double right[dim] = {5.0, 2.0, 0.5};
+
+  // some data points lie outside of the bounding box
+  DataMatrix dataset(numberDataPoints, dim);
+
+  for (size_t d = 0; d < dim; d++) {
+    const double margin = 0.1 * (right[d] - left[d]);
+    std::uniform_real_distribution<double> distribution(left[d] - margin, right[d] + margin);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      dataset.set(i, d, distribution(generator));
+    }
+  }
+
+  for (bool modified : {false, true}) {
+    std::unique_ptr<Grid> grid(modified ? Grid::createModLinearGrid(dim)
+                                        : Grid::createLinearGrid(dim));
+    grid->getGenerator().regular(3);
+
+    for (size_t d = 0; d < dim; d++) {
+      grid->getBoundingBox().setBoundary(d, BoundingBox1D(left[d], right[d]));
+    }
+
+    const size_t N = grid->getSize();
+    DataVector alpha(N);
+    std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+    for (size_t i = 0; i < N; i++) {
+      alpha[i] = distribution(generator);
+    }
+
+    // reference: point-wise evaluation, which is zero outside of the bounding box
+    std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
+    DataVector reference(numberDataPoints);
+    DataVector point(dim);
+
+    for (size_t i = 0; i < numberDataPoints; i++) {
+      dataset.getRow(i, point);
+      reference[i] = opEval->eval(alpha, point);
+    }
+
+    // the fixed dimension kernel and the runtime dimension kernel
+    std::vector<std::unique_ptr<OperationMultipleEval>> ops;
+    ops.emplace_back(new sgpp::base::OperationMultipleEvalFixedDimension(*grid, dataset));
+
+    if (modified) {
+      ops.emplace_back(new sgpp::base::OperationMultipleEvalModLinear(*grid, dataset));
+    } else {
+      ops.emplace_back(new sgpp::base::OperationMultipleEvalLinear(*grid, dataset));
+    }
+
+    for (std::unique_ptr<OperationMultipleEval>& op : ops) {
+      DataVector result(numberDataPoints), resultCached(numberDataPoints);
+      DataVector resultTransposed(N), resultTransposedCached(N);
+
+      op->mult(alpha, result);
+      op->multTranspose(reference, resultTransposed);
+      op->enableMatrixCaching();
+      op->mult(alpha, resultCached);
+      op->multTranspose(reference, resultTransposedCached);
+      BOOST_CHECK(op->getMatrixCache().isBuilt());
+      op->disableMatrixCaching();
+
+      for (size_t i = 0; i < numberDataPoints; i++) {
+        BOOST_CHECK_SMALL(result[i] - reference[i], 1e-12);
+        BOOST_CHECK_SMALL(resultCached[i] - reference[i], 1e-12);
+      }
+
+      for (size_t i = 0; i < N; i++) {
+        BOOST_CHECK_SMALL(resultTransposedCached[i] - resultTransposed[i], 1e-10);
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOperationMultipleEvalTransposedThreads) {
+  std::mt19937 generator(2345);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  const size_t numberDataPoints = 300;
+  const size_t numberColumns = 2;
+
+#ifdef _OPENMP
+  int oldNumThreads = omp_get_max_threads();
+  omp_set_num_threads(4);
+#endif
+
+  // the factory chooses AlgorithmMultipleEvaluation (1D linear), the fixed dimension kernel
+  // (3D linear and modified linear) and AlgorithmDGEMV (linear boundary)
+  std::vector<std::unique_ptr<Grid>> grids;
+  grids.emplace_back(Grid::createLinearGrid(1));
+  grids.emplace_back(Grid::createLinearGrid(3));
+  grids.emplace_back(Grid::createModLinearGrid(3));
+  grids.emplace_back(Grid::createLinearBoundaryGrid(2));
+
+  for (std::unique_ptr<Grid>& grid : grids) {
+    const size_t dim = grid->getDimension();
+    grid->getGenerator().regular(4);
+    const size_t N = grid->getSize();
+
+    DataMatrix dataset(numberDataPoints, dim);
+
+    for (size_t i = 0; i < dataset.getSize(); i++) {
+      dataset[i] = distribution(generator);
+    }
+
+    DataMatrix sources(numberDataPoints, numberColumns);
+
+    for (size_t i = 0; i < sources.getSize(); i++) {
+      sources[i] = distribution(generator);
+    }
+
+    // naive transposed evaluation, one basis function at a time
+    DataMatrix reference(N, numberColumns, 0.0);
+    std::unique_ptr<sgpp::base::OperationEval> opEval(sgpp::op_factory::createOperationEval(*grid));
+    DataVector unit(N, 0.0);
+    DataVector point(dim);
+
+    for (size_t j = 0; j < N; j++) {
+      unit[j] = 1.0;
+
+      for (size_t i = 0; i < numberDataPoints; i++) {
+        dataset.getRow(i, point);
+        double value = opEval->eval(unit, point);
+
+        for (size_t k = 0; k < numberColumns; k++) {
+          reference.set(j, k, reference.get(j, k) + value * sources.get(i, k));
+        }
+      }
+
+      unit[j] = 0.0;
+    }
+
+    std::unique_ptr<OperationMultipleEval> op(
+        sgpp::op_factory::createOperationMultipleEval(*grid, dataset));
+
+    DataVector source(numberDataPoints);
+    DataVector result(N);
+    sources.getColumn(0, source);
+    op->multTranspose(source, result);
+
+    DataMatrix results(N, numberColumns);
+    op->multTransposeMultiple(sources, results);
+
+    for (size_t j = 0; j < N; j++) {
+      BOOST_CHECK_SMALL(result[j] - reference.get(j, 0), 1e-10);
+
+      for (size_t k = 0; k < numberColumns; k++) {
+        BOOST_CHECK_SMALL(results.get(j, k) - reference.get(j, k), 1e-10);
+      }
+    }
+  }
+
+#ifdef _OPENMP
+  omp_set_num_threads(oldNumThreads);
+#endif
+}
+
 BOOST_AUTO_TEST_SUITE_END()
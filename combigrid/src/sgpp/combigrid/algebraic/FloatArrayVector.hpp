@@ -146,6 +146,74 @@ class FloatArrayVector {
     }
   }
 
+  /**
+   * Adds factor * other to this vector without creating a temporary vector.
+   */
+  void addScaled(double const &factor, FloatArrayVector const &other) {
+    ensureMinimumSize(other.size());
+
+    size_t otherSize = other.size();
+    for (size_t i = 0; i < otherSize; ++i) {
+      values[i].addScaled(factor, other.values[i]);
+    }
+
+    for (size_t i = otherSize; i < size(); ++i) {
+      values[i].addScaled(factor, other.values.back());
+    }
+  }
+
+  /**
+   * Adds factors[0] * others[0] + ... + factors[n-1] * others[n-1]. Each component is summed up
+   * with compensated summation, the loop over the components is the inner loop so that it can be
+   * vectorized.
+   */
+  void addScaled(double const *factors, FloatArrayVector const *others, size_t n) {
+    for (size_t k = 0; k < n; ++k) {
+      ensureMinimumSize(others[k].size());
+    }
+
+    size_t numValues = size();
+    std::vector<double> sum(numValues);
+    std::vector<double> c(numValues, 0.0);
+
+    for (size_t j = 0; j < numValues; ++j) {
+      sum[j] = values[j].value();
+    }
+
+    auto addCompensated = [&sum, &c](size_t j, double x) {
+      double y = x - c[j];
+      double t = sum[j] + y;
+      c[j] = (t - sum[j]) - y;
+      sum[j] = t;
+    };
+
+    for (size_t k = 0; k < n; ++k) {
+      double factor = factors[k];
+      auto const &otherValues = others[k].values;
+
+      if (otherValues.empty()) {
+        continue;
+      }
+
+      size_t otherSize = std::min(otherValues.size(), numValues);
+
+      for (size_t j = 0; j < otherSize; ++j) {
+        addCompensated(j, factor * otherValues[j].value());
+      }
+
+      // shorter vectors are extended by their last value, see ensureMinimumSize()
+      double last = factor * otherValues[otherSize - 1].value();
+
+      for (size_t j = otherSize; j < numValues; ++j) {
+        addCompensated(j, last);
+      }
+    }
+
+    for (size_t j = 0; j < numValues; ++j) {
+      values[j] = sum[j] - c[j];
+    }
+  }
+
   double norm() const {
     double result = 0.0;
 
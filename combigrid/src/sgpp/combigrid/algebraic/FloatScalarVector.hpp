@@ -6,6 +6,7 @@
 #ifndef COMBIGRID_SRC_SGPP_COMBIGRID_ALGEBRAIC_FLOATSCALARVECTOR_HPP_
 #define COMBIGRID_SRC_SGPP_COMBIGRID_ALGEBRAIC_FLOATSCALARVECTOR_HPP_
 
+#include <sgpp/combigrid/numeric/KahanAdder.hpp>
 #include <sgpp/combigrid/storage/tree/TreeStorage.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -65,6 +66,21 @@ class FloatScalarVector {
 
   void scalarMult(double const &factor) { val *= factor; }
 
+  void addScaled(double const &factor, FloatScalarVector const &other) {
+    val += factor * other.val;
+  }
+
+  /**
+   * Adds factors[0] * others[0] + ... + factors[n-1] * others[n-1]. The sum is computed with
+   * vectorized compensated summation.
+   */
+  void addScaled(double const *factors, FloatScalarVector const *others, size_t n) {
+    KahanAdder adder;
+    adder.add(val);
+    adder.addGenerated(n, [factors, others](size_t i) { return factors[i] * others[i].val; });
+    val = adder.value();
+  }
+
   double norm() const { return std::fabs(val); }
 
   static FloatScalarVector zero() { return FloatScalarVector(0.0); }
@@ -156,6 +156,25 @@ void FloatTensorVector::scalarMult(const double& factor) {
   }
 }
 
+void FloatTensorVector::addScaled(const double& factor, const FloatTensorVector& other) {
+  ensureDim(other.d);
+  auto it = other.values->getStoredDataIterator();
+  for (; it->isValid(); it->moveToNext()) {
+    MultiIndex index = it->getMultiIndex();
+    for (size_t i = index.size(); i < values->getNumDimensions(); ++i) {
+      index.push_back(0);
+    }
+    values->get(index).addScaled(factor, it->value());
+  }
+}
+
+void FloatTensorVector::addScaled(const double* factors, const FloatTensorVector* others,
+                                  size_t n) {
+  for (size_t i = 0; i < n; ++i) {
+    addScaled(factors[i], others[i]);
+  }
+}
+
 double FloatTensorVector::norm() const {
   double sum = 0.0;
   for (auto it = values->getStoredDataIterator(); it->isValid(); it->moveToNext()) {
@@ -67,6 +67,10 @@ class FloatTensorVector {
 
   void scalarMult(double const &factor);
 
+  void addScaled(double const &factor, FloatTensorVector const &other);
+
+  void addScaled(double const *factors, FloatTensorVector const *others, size_t n);
+
   double norm() const;
 
   static FloatTensorVector zero() { return FloatTensorVector(FloatScalarVector(0.0)); }
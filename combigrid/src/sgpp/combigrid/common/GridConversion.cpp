@@ -7,6 +7,8 @@
 #include <sgpp/combigrid/common/GridConversion.hpp>
 
 #include <numeric>
+#include <utility>
+#include <vector>
 
 namespace sgpp {
 namespace combigrid {
@@ -33,16 +35,13 @@ void convertCombigridToHierarchicalSparseGrid(std::shared_ptr<TreeStorage<uint8_
 
   while (it->isValid()) {
     MultiIndex currentLevel = it->getMultiIndex();
-    std::cout << it->getMultiIndex()[0] << " ";
 
     // now iterate over index
     MultiIndex multiBounds(d);
     for (size_t i = 0; i < d; ++i) {
       // there are 2^l elements in the level, subtract 1 because the bound is inclusive
       multiBounds[i] = 1 << currentLevel[i];
-      std::cout << multiBounds[i] << " ";
     }
-    std::cout << "\n";
     MultiIndexIterator indexIt(multiBounds);
 
     while (indexIt.isValid()) {
@@ -71,8 +70,6 @@ void convertexpUniformBoundaryCombigridToHierarchicalSparseGrid(
   size_t d = levelStructure->getNumDimensions();
 
   auto it = levelStructure->getStoredDataIterator();
-  base::HashGridPoint::level_type sglevel(0);
-  base::HashGridPoint::index_type sgindex(0);
   base::HashGridPoint point(d);
 
   // this checks if level (1,...,1) exists. due to the different point generation on level 0 and 1
@@ -94,51 +91,52 @@ void convertexpUniformBoundaryCombigridToHierarchicalSparseGrid(
   //        << std::endl;
   //  }
 
+  // (level, index) pairs of the points that are new in a one-dimensional combigrid level,
+  // computed once per level
+  std::vector<std::vector<std::pair<base::HashGridPoint::level_type,
+                                    base::HashGridPoint::index_type>>> newPoints1D;
+
   it = levelStructure->getStoredDataIterator();
   while (it->isValid()) {
     MultiIndex currentLevel = it->getMultiIndex();
 
-    // now iterate over index
+    // only iterate over the points that are new in each dimension instead of all 2^l+1 points
     MultiIndex multiBounds(d);
     for (size_t i = 0; i < d; ++i) {
-      // there are 2^l+1 elements in the level
-      multiBounds[i] = (1 << currentLevel[i]) + 1;
-    }
-    MultiIndexIterator indexIt(multiBounds);
-    while (indexIt.isValid()) {
-      MultiIndex index = indexIt.getMultiIndex();
-      bool isValidPoint = true;
-      for (size_t i = 0; i < d; ++i) {
-        if (currentLevel[i] == 0) {
+      while (newPoints1D.size() <= currentLevel[i]) {
+        size_t l = newPoints1D.size();
+        newPoints1D.emplace_back();
+        auto& points = newPoints1D.back();
+
+        if (l == 0) {
           // point 0.5
-          sglevel = static_cast<base::HashGridPoint::level_type>(1);
-          sgindex = static_cast<base::HashGridPoint::index_type>(1);
-        } else if (currentLevel[i] == 1) {
+          points.emplace_back(1, 1);
+        } else if (l == 1) {
           // points 0, 0.5, 1
-          if (index[i] == 0) {
-            sglevel = static_cast<base::HashGridPoint::level_type>(0);
-            sgindex = static_cast<base::HashGridPoint::index_type>(0);
-          } else if (index[i] == 1) {
-            sglevel = static_cast<base::HashGridPoint::level_type>(1);
-            sgindex = static_cast<base::HashGridPoint::index_type>(1);
-          } else if (index[i] == 2) {
-            sglevel = static_cast<base::HashGridPoint::level_type>(0);
-            sgindex = static_cast<base::HashGridPoint::index_type>(1);
-          }
-        } else if (index[i] % 2 == 1) {
-          sglevel = static_cast<base::HashGridPoint::level_type>(currentLevel[i]);
-          sgindex = static_cast<base::HashGridPoint::index_type>(index[i]);
+          points.emplace_back(0, 0);
+          points.emplace_back(1, 1);
+          points.emplace_back(0, 1);
         } else {
-          isValidPoint = false;
-          break;
+          for (size_t index = 1; index < (static_cast<size_t>(1) << l); index += 2) {
+            points.emplace_back(static_cast<base::HashGridPoint::level_type>(l),
+                                static_cast<base::HashGridPoint::index_type>(index));
+          }
         }
-        point.push(i, sglevel, sgindex);
       }
-      if (isValidPoint) {
-        point.rehash();
-        if (!storage.isContaining(point)) {
-          storage.insert(point);
-        }
+
+      multiBounds[i] = newPoints1D[currentLevel[i]].size();
+    }
+
+    MultiIndexIterator indexIt(multiBounds);
+    while (indexIt.isValid()) {
+      for (size_t i = 0; i < d; ++i) {
+        auto const& levelIndex = newPoints1D[currentLevel[i]][indexIt.indexAt(i)];
+        point.push(i, levelIndex.first, levelIndex.second);
+      }
+
+      point.rehash();
+      if (!storage.isContaining(point)) {
+        storage.insert(point);
       }
       indexIt.moveToNext();
     }
@@ -206,16 +204,17 @@ std::shared_ptr<TreeStorage<uint8_t>> completeStorageLevels(base::HashGridStorag
 sgpp::base::DataMatrix convertLevelStructureToGridPoints(
     std::shared_ptr<sgpp::combigrid::TreeStorage<uint8_t>> const& levelStructure,
     size_t numDimensions) {
-  sgpp::base::DataMatrix gridpointMatrix(0, numDimensions);
   sgpp::base::GridStorage gridStorage(numDimensions);
   convertexpUniformBoundaryCombigridToHierarchicalSparseGrid(levelStructure, gridStorage);
-  for (size_t q = 0; q < gridStorage.getSize(); q++) {
-    auto point = gridStorage.getPoint(q);
-    sgpp::base::DataVector row;
-    for (size_t d = 0; d < gridStorage.getDimension(); d++) {
-      row.push_back(point.getStandardCoordinate(d));
+  size_t numPoints = gridStorage.getSize();
+  sgpp::base::DataMatrix gridpointMatrix(numPoints, numDimensions);
+
+#pragma omp parallel for schedule(static)
+  for (int q = 0; q < static_cast<int>(numPoints); q++) {
+    sgpp::base::GridPoint& point = gridStorage.getPoint(q);
+    for (size_t d = 0; d < numDimensions; d++) {
+      gridpointMatrix.set(q, d, point.getStandardCoordinate(d));
     }
-    gridpointMatrix.appendRow(row);
   }
   return gridpointMatrix;
 }
@@ -224,14 +223,15 @@ sgpp::base::DataVector calculateInterpolationCoefficientsForConvertedExpUniformB
     std::shared_ptr<sgpp::base::Grid>& grid, sgpp::base::GridStorage& gridStorage,
     std::shared_ptr<sgpp::combigrid::CombigridMultiOperation>& combigridInterpolationOperation,
     std::shared_ptr<sgpp::combigrid::TreeStorage<uint8_t>> const& levelStructure) {
-  sgpp::base::DataMatrix interpolParams(gridStorage.getDimension(), gridStorage.getSize());
-  for (size_t i = 0; i < gridStorage.getSize(); i++) {
+  size_t numDimensions = gridStorage.getDimension();
+  sgpp::base::DataMatrix interpolParams(numDimensions, gridStorage.getSize());
+
+#pragma omp parallel for schedule(static)
+  for (int i = 0; i < static_cast<int>(gridStorage.getSize()); i++) {
     sgpp::base::GridPoint& gp = gridStorage.getPoint(i);
-    sgpp::base::DataVector p(gridStorage.getDimension(), 0.0);
-    for (size_t j = 0; j < gridStorage.getDimension(); j++) {
-      p[j] = gp.getStandardCoordinate(j);
+    for (size_t j = 0; j < numDimensions; j++) {
+      interpolParams.set(j, i, gp.getStandardCoordinate(j));
     }
-    interpolParams.setColumn(i, p);
   }
 
   // obtain function values from combigrid surrogate
@@ -35,6 +35,21 @@ namespace combigrid {
 
 typedef std::vector<size_t> MultiIndex;
 
+/**
+ * Helper class used internally as a hash function for MultiIndex objects, e.g. as keys of unordered
+ * containers.
+ */
+class MultiIndexHash {
+ public:
+  size_t operator()(MultiIndex const& index) const {
+    size_t result = 0;
+    for (size_t i = 0; i < index.size(); ++i) {
+      result ^= index[i] + 0x9e3779b9 + (result << 6) + (result >> 2);
+    }
+    return result;
+  }
+};
+
 /**
  * Returns a constant function with the given value. If no value is specified, the
  * default-constructed value is taken. The template-parameter In corresponding to the input
@@ -12,5 +12,14 @@ sgpp::combigrid::AbstractInfiniteFunctionBasis1D::AbstractInfiniteFunctionBasis1
 
 sgpp::combigrid::AbstractInfiniteFunctionBasis1D::~AbstractInfiniteFunctionBasis1D() {}
 
+void AbstractInfiniteFunctionBasis1D::evaluateUpTo(size_t maxBasisIndex, double xValue,
+                                                   base::DataVector& values) {
+  values.resize(maxBasisIndex + 1);
+
+  for (size_t i = 0; i <= maxBasisIndex; ++i) {
+    values[i] = evaluate(i, xValue);
+  }
+}
+
 } /* namespace combigrid */
 } /* namespace sgpp */
@@ -5,6 +5,8 @@
 
 #pragma once
 
+#include <sgpp/base/datatypes/DataVector.hpp>
+
 #include <cstddef>
 
 namespace sgpp {
@@ -16,6 +18,13 @@ class AbstractInfiniteFunctionBasis1D {
   virtual ~AbstractInfiniteFunctionBasis1D();
 
   virtual double evaluate(size_t basisIndex, double xValue) = 0;
+
+  /**
+   * Evaluates all basis functions with index 0, ..., maxBasisIndex at xValue and stores the
+   * results in values (which is resized to maxBasisIndex + 1). The default implementation calls
+   * evaluate() for every index, subclasses may override it to use a recurrence relation.
+   */
+  virtual void evaluateUpTo(size_t maxBasisIndex, double xValue, base::DataVector& values);
 };
 
 } /* namespace combigrid */
@@ -15,5 +15,15 @@ double MonomialFunctionBasis1D::evaluate(size_t basisIndex, double xValue) {
   return pow(xValue, basisIndex);
 }
 
+void MonomialFunctionBasis1D::evaluateUpTo(size_t maxBasisIndex, double xValue,
+                                           base::DataVector& values) {
+  values.resize(maxBasisIndex + 1);
+  values[0] = 1.0;
+
+  for (size_t i = 1; i <= maxBasisIndex; ++i) {
+    values[i] = values[i - 1] * xValue;
+  }
+}
+
 } /* namespace combigrid */
 } /* namespace sgpp */
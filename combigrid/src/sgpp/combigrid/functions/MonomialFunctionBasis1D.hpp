@@ -15,6 +15,7 @@ class MonomialFunctionBasis1D : public AbstractInfiniteFunctionBasis1D {
   ~MonomialFunctionBasis1D();
 
   virtual double evaluate(size_t basisIndex, double xValue);
+  void evaluateUpTo(size_t maxBasisIndex, double xValue, base::DataVector& values) override;
 };
 
 } /* namespace combigrid */
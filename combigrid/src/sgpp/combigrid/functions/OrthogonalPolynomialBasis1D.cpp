@@ -25,6 +25,7 @@
 #include <BoundedLognormalRandomVariable.hpp>
 #endif
 
+#include <cmath>
 #include <iostream>
 #include <string>
 
@@ -203,6 +204,53 @@ double OrthogonalPolynomialBasis1D::evaluate(size_t basisIndex, double xValue) {
 #endif
 }
 
+void OrthogonalPolynomialBasis1D::evaluateUpTo(size_t maxBasisIndex, double xValue,
+                                               base::DataVector& values) {
+#ifdef USE_DAKOTA
+  double x = normalizeInput(xValue);
+
+  switch (config.polyParameters.type_) {
+    case OrthogonalPolynomialBasisType::LEGENDRE: {
+      // P_{n+1}(x) = ((2n + 1) x P_n(x) - n P_{n-1}(x)) / (n + 1), normalized by sqrt(2n + 1)
+      values.resize(maxBasisIndex + 1);
+      double previous = 0.0;
+      double current = 1.0;
+
+      for (size_t n = 0; n <= maxBasisIndex; ++n) {
+        double dn = static_cast<double>(n);
+        values[n] = std::sqrt(2.0 * dn + 1.0) * current;
+        double next = ((2.0 * dn + 1.0) * x * current - dn * previous) / (dn + 1.0);
+        previous = current;
+        current = next;
+      }
+
+      return;
+    }
+    case OrthogonalPolynomialBasisType::HERMITE:
+    case OrthogonalPolynomialBasisType::BOUNDED_NORMAL: {
+      // orthonormal probabilists' Hermite polynomials
+      // h_{n+1}(x) = (x h_n(x) - sqrt(n) h_{n-1}(x)) / sqrt(n + 1)
+      values.resize(maxBasisIndex + 1);
+      values[0] = 1.0;
+
+      if (maxBasisIndex > 0) {
+        values[1] = x;
+      }
+
+      for (size_t n = 1; n < maxBasisIndex; ++n) {
+        double dn = static_cast<double>(n);
+        values[n + 1] = (x * values[n] - std::sqrt(dn) * values[n - 1]) / std::sqrt(dn + 1.0);
+      }
+
+      return;
+    }
+    default:
+      break;
+  }
+#endif
+  AbstractInfiniteFunctionBasis1D::evaluateUpTo(maxBasisIndex, xValue, values);
+}
+
 double OrthogonalPolynomialBasis1D::pdf(double xValue) {
 #ifdef USE_DAKOTA
   return rv->pdf(xValue);
@@ -74,6 +74,13 @@ class OrthogonalPolynomialBasis1D : public AbstractInfiniteFunctionBasis1D {
   virtual ~OrthogonalPolynomialBasis1D();
 
   double evaluate(size_t basisIndex, double xValue) override;
+
+  /**
+   * For Legendre and Hermite polynomials, the orthonormal polynomials up to maxBasisIndex are
+   * computed at once by their three-term recurrence relation. For all other types, the values
+   * are computed one by one.
+   */
+  void evaluateUpTo(size_t maxBasisIndex, double xValue, base::DataVector& values) override;
   double pdf(double xValue);
   double mean();
   double variance();
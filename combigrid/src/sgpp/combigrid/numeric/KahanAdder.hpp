@@ -7,17 +7,24 @@
 #define KAHANADDER_HPP_
 #include <sgpp/globaldef.hpp>
 
+#include <cstddef>
+
 namespace sgpp {
 namespace combigrid {
 
 /**
  * Kahan adder (a numerically more precise method to add many numbers).
+ * Besides adding one number at a time, many numbers can be added at once. Then, the numbers are
+ * distributed over numLanes independent compensated sums that are merged at the end. This removes
+ * the dependency between consecutive additions, so that the compiler can vectorize the loop.
  */
 class KahanAdder {
   double sum = 0.0;
   double c = 0.0;
 
  public:
+  static const size_t numLanes = 4;
+
   void add(double x) {
     // taken from Wikipedia, Kahan summation algorithm
     double y = x - c;
@@ -26,6 +33,48 @@ class KahanAdder {
     sum = t;
   }
 
+  /**
+   * Adds values[0], ..., values[n-1].
+   */
+  void add(double const *values, size_t n) {
+    addGenerated(n, [values](size_t i) { return values[i]; });
+  }
+
+  /**
+   * Adds the products a[0] * b[0], ..., a[n-1] * b[n-1].
+   */
+  void addProducts(double const *a, double const *b, size_t n) {
+    addGenerated(n, [a, b](size_t i) { return a[i] * b[i]; });
+  }
+
+  /**
+   * Adds value(0), ..., value(n-1), where value is a function object that should be inlineable.
+   */
+  template <typename Function>
+  void addGenerated(size_t n, Function value) {
+    double laneSum[numLanes] = {};
+    double laneC[numLanes] = {};
+    size_t i = 0;
+
+    for (; i + numLanes <= n; i += numLanes) {
+      for (size_t l = 0; l < numLanes; ++l) {
+        double y = value(i + l) - laneC[l];
+        double t = laneSum[l] + y;
+        laneC[l] = (t - laneSum[l]) - y;
+        laneSum[l] = t;
+      }
+    }
+
+    for (size_t l = 0; l < numLanes; ++l) {
+      add(laneSum[l]);
+      add(-laneC[l]);
+    }
+
+    for (; i < n; ++i) {
+      add(value(i));
+    }
+  }
+
   double value() const { return sum; }
 };
 
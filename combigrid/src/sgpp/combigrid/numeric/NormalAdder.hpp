@@ -7,6 +7,8 @@
 #define NORMALADDER_HPP_
 #include <sgpp/globaldef.hpp>
 
+#include <cstddef>
+
 namespace sgpp {
 namespace combigrid {
 
@@ -19,6 +21,25 @@ class NormalAdder {
  public:
   void add(double x) { sum += x; }
 
+  void add(double const *values, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+      sum += values[i];
+    }
+  }
+
+  void addProducts(double const *a, double const *b, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+      sum += a[i] * b[i];
+    }
+  }
+
+  template <typename Function>
+  void addGenerated(size_t n, Function value) {
+    for (size_t i = 0; i < n; ++i) {
+      sum += value(i);
+    }
+  }
+
   double value() const { return sum; }
 };
 
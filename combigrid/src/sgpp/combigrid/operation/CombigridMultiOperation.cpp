@@ -163,6 +163,10 @@ std::shared_ptr<AbstractCombigridStorage> CombigridMultiOperation::getStorage()
   return impl->storage;
 }
 
+void CombigridMultiOperation::invalidateStorageCache() {
+  impl->fullGridEval->invalidateStorageCache();
+}
+
 std::vector<std::shared_ptr<AbstractPointHierarchy>>
 CombigridMultiOperation::getPointHierarchies() {
   return impl->pointHierarchies;
@@ -125,6 +125,13 @@ class CombigridMultiOperation {
    */
   std::shared_ptr<AbstractCombigridStorage> getStorage();
 
+  /**
+   * Discards the function values the full grid evaluator keeps between evaluations. Changes by
+   * the set() or deserialize() methods of the storage are detected automatically, so this only
+   * has to be called if the stored values are changed by other means.
+   */
+  void invalidateStorageCache();
+
   /**
    * @return the point hierarchies containing the grid points in each direction
    */
@@ -129,8 +129,11 @@ std::shared_ptr<AbstractCombigridStorage> CombigridOperation::getStorage() { ret
 
 void CombigridOperation::setStorage(std::shared_ptr<AbstractCombigridStorage> storage) {
   impl->storage = storage;
+  invalidateStorageCache();
 }
 
+void CombigridOperation::invalidateStorageCache() { impl->fullGridEval->invalidateStorageCache(); }
+
 std::vector<std::shared_ptr<AbstractPointHierarchy>> CombigridOperation::getPointHierarchies() {
   return impl->pointHierarchies;
 }
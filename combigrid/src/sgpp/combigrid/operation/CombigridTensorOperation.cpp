@@ -147,6 +147,10 @@ CombigridTensorOperation::getDifferences() {
   return impl->combiEval->differences();
 }
 
+double CombigridTensorOperation::getDifferenceNorm(MultiIndex const &level) {
+  return impl->combiEval->getDifferenceNorm(level);
+}
+
 size_t CombigridTensorOperation::numStoredFunctionValues() {
   return impl->storage->getNumEntries();
 }
@@ -116,6 +116,12 @@ class CombigridTensorOperation {
    */
   std::shared_ptr<AbstractMultiStorage<FloatTensorVector>> getDifferences();
 
+  /**
+   * @return the norm of the difference (Delta) of the given level. Levels whose norm is nan or
+   * +-inf are stored in getDifferences(), but are not included in the result.
+   */
+  double getDifferenceNorm(MultiIndex const &level);
+
   /**
    * @return the number of function values that have been computed via this CombigridTensorOperation
    * during its lifetime. For a nested grid, this number matches numGridPoints() if only one
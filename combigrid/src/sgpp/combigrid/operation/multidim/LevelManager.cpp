@@ -407,44 +407,40 @@ void LevelManager::addLevelsAdaptiveParallel(size_t maxNumPoints, size_t numThre
 
   combiEval->setMutex(managerMutex);
 
+  // The idle callback is called whenever a thread finds no more function evaluations to do. It
+  // then starts the level with the highest priority, even if its predecessors are still being
+  // computed, so that all threads are kept busy. The priorities of waiting levels are updated
+  // whenever a level is completed (see predecessorsCompleted()).
   auto threadPool = std::make_shared<ThreadPool>(
       numThreads,
       ThreadPool::IdleCallback([&currentPointBound, maxNumPoints, this](ThreadPool &tp) {
         CGLOG_SURROUND(PtrGuard guard(managerMutex));
-        if (queue.empty()) {
-          std::cout << "Error: queue is empty\n";
+
+        // If no level can be started, the threads terminate. This does not affect started levels:
+        // the callback is only called if there are no more tasks waiting, and the running tasks
+        // are finished before the threads terminate.
+        if (queue.empty() || currentPointBound + queue.top().maxNewPoints > maxNumPoints) {
+          tp.triggerTermination();
           CGLOG("leave guard(*managerMutex)");
           return;
         }
 
-        // print current queue
-        //        queue.print();
-
         QueueEntry entry = queue.top();
-
         currentPointBound += entry.maxNewPoints;
 
-        if (currentPointBound > maxNumPoints) {
-          tp.triggerTermination();
-          CGLOG("leave guard(*managerMutex)");
-          return;
-        }
-
         CGLOG("before beforeComputation()");
         /*
-         * Must be placed after the triggerTermination() in the if clause since after the pop()
-         * operation, the corresponding handle in the LevelInfo must be set to nullptr in order to
-         * avoid accessing a handle to a popped element. Invalidating the handle is done by
-         * beforeComputation().
+         * After the pop() operation, the corresponding handle in the LevelInfo must be set to
+         * nullptr in order to avoid accessing a handle to a popped element. Invalidating the handle
+         * is done by beforeComputation().
          */
-        queue.pop();  // TODO(rehmemk)
+        queue.pop();
 
         beforeComputation(entry.level);
         CGLOG("before getLevelTasks()");
         auto tasks = combiEval->getLevelTasks(entry.level, ThreadPool::Task([this, entry]() {
                                                 // the mutex will be locked when this callback is
                                                 // called
-                                                // PtrGuard guard(this->managerMutex);
                                                 afterComputation(entry.level);
                                               }));
         CGLOG("before addTasks()");
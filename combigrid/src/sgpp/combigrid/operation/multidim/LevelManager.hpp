@@ -325,7 +325,11 @@ class LevelManager {
   virtual void addLevelsAdaptive(size_t maxNumPoints);
 
   /**
-   * Does the same as addLevelsAdaptive(), but with parallel function evaluations.
+   * Does the same as addLevelsAdaptive(), but with parallel function evaluations. Each function
+   * evaluation is a separate task. Whenever a thread runs out of tasks, the level with the highest
+   * priority is started, even if its predecessors are not completed yet. When the point bound is
+   * reached or no level is left to start, the levels that are already started are completed and
+   * the function returns.
    */
   virtual void addLevelsAdaptiveParallel(size_t maxNumPoints, size_t numThreads);
 
@@ -90,6 +90,8 @@ class AbstractFullGridEvaluationStrategy : public AbstractFullGridEvaluator<V> {
    */
   void setParameters(std::vector<V> const &params) { summationStrategy->setParameters(params); }
 
+  void invalidateStorageCache() override { summationStrategy->invalidateStorageCache(); }
+
   std::vector<std::shared_ptr<AbstractLinearEvaluator<V>>> getEvaluatorPrototypes() {
     return evaluatorPrototypes;
   }
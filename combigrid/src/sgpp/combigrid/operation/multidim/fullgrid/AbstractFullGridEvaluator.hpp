@@ -84,6 +84,13 @@ class AbstractFullGridEvaluator {
    */
   std::shared_ptr<AbstractCombigridStorage> getStorage() { return storage; }
 
+  /**
+   * Discards function values that were read from the storage and kept for later evaluations.
+   * Changes by AbstractCombigridStorage::set() or deserialize() are detected automatically, so this
+   * only has to be called if the stored values are changed by other means.
+   */
+  virtual void invalidateStorageCache() {}
+
   /**
    * Sets the parameters for the evaluators. Each dimension in which the evaluator does not need a
    * parameter is skipped.
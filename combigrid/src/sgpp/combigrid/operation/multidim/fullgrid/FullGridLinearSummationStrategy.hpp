@@ -15,6 +15,7 @@
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 
 #include <iostream>
+#include <map>
 #include <vector>
 
 namespace sgpp {
@@ -36,7 +37,8 @@ class FullGridLinearSummationStrategy : public AbstractFullGridSummationStrategy
       std::shared_ptr<AbstractCombigridStorage> storage,
       std::vector<std::shared_ptr<AbstractLinearEvaluator<V>>> evaluatorPrototypes,
       std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies)
-      : AbstractFullGridSummationStrategy<V>(storage, evaluatorPrototypes, pointHierarchies) {}
+      : AbstractFullGridSummationStrategy<V>(storage, evaluatorPrototypes, pointHierarchies),
+        tensorsVersion(0) {}
 
   ~FullGridLinearSummationStrategy() {}
 
@@ -91,62 +93,121 @@ class FullGridLinearSummationStrategy : public AbstractFullGridSummationStrategy
       }
     }
 
-    // for efficient computation, the products over the first i evaluator coefficients are stored
-    // for all i up to n-1.
-    // This way, we only have to multiply them with the values for the changing indices at each
-    // iteration step.
-    // init partial products
-    this->partialProducts[0] = V::one();
-    for (size_t d = 1; d < numDimensions; ++d) {
-      V value = this->partialProducts[d - 1];
-      value.componentwiseMult(this->basisValues[d - 1][0]);
-      this->partialProducts[d] = value;
+    // the function values of the level are contracted with the basis values dimension by
+    // dimension (sum factorization), starting with the last dimension
+    std::vector<double> const &values = getTensor(level, multiBounds, orderingConfiguration);
+
+    if (values.empty()) {  // should not happen
+      return V::zero();
+    }
+
+    std::vector<size_t> strides(numDimensions, 1);
+    for (size_t d = lastDim; d > 0; --d) {
+      strides[d - 1] = strides[d] * multiBounds[d];
+    }
+
+    accumulators.resize(numDimensions);
+    temporaries.resize(numDimensions);
+
+    CGLOG("FullGridTensorEvaluator::eval(): start contraction");
+    return contract(0, 0, values, multiBounds, strides);
+  }
+
+  /**
+   * Removes the stored function value tensors. This is only needed if the storage is replaced,
+   * changes of the stored values are detected by getTensor().
+   */
+  void invalidateStorageCache() override {
+    tensors.clear();
+
+    if (this->storage) {
+      tensorsVersion = this->storage->getVersion();
+    }
+  }
+
+ protected:
+  /**
+   * Function values of each evaluated level as a dense tensor in the traversal order of
+   * MultiIndexIterator, i.e. the last dimension is varying fastest. The tensors are reused by
+   * later evaluations as long as the version of the storage does not change.
+   */
+  std::map<MultiIndex, std::vector<double>> tensors;
+
+  /**
+   * Version of the storage the tensors were read from, see AbstractCombigridStorage::getVersion().
+   */
+  size_t tensorsVersion;
+
+  /**
+   * Intermediate results of the sum factorization, one per dimension.
+   */
+  std::vector<V> accumulators;
+  std::vector<V> temporaries;
+
+  /**
+   * Returns the dense tensor of the function values of the given level, the values are read
+   * from the storage on the first call and again after stored values have been replaced.
+   */
+  std::vector<double> const &getTensor(MultiIndex const &level, MultiIndex const &multiBounds,
+                                       std::vector<bool> const &orderingConfiguration) {
+    if (this->storage->getVersion() != tensorsVersion) {
+      invalidateStorageCache();
+    }
+
+    auto tensorIter = tensors.find(level);
+
+    if (tensorIter != tensors.end()) {
+      return tensorIter->second;
     }
 
     CGLOG("FullGridTensorEvaluator::eval(): create storage iterator");
+    std::vector<double> values;
+    size_t numValues = 1;
 
-    // start iteration
-    MultiIndexIterator it(multiBounds);
+    for (size_t d = 0; d < multiBounds.size(); ++d) {
+      numValues *= multiBounds[d];
+    }
+
+    values.reserve(numValues);
 
+    MultiIndexIterator it(multiBounds);
     auto funcIter = this->storage->getGuidedIterator(level, it, orderingConfiguration);
-    V sum = V::zero();
-    CGLOG("FullGridTensorEvaluator::eval(): start loop");
 
-    if (!funcIter->isValid()) {  // should not happen
-      return sum;
+    if (funcIter->isValid()) {
+      do {
+        values.push_back(funcIter->value());
+      } while (funcIter->moveToNext() >= 0);
     }
 
-    while (true) {
-      CGLOG("FullGridTensorEvaluator::eval(): in loop");
-      // get function value and partial product and multiply them together with the last basis
-      // coefficient, then add the resulting value to the total sum
-      double value = funcIter->value();
-      //      std::cout << std::defaultfloat << value << " ";
-      V vec = this->partialProducts[lastDim];
-      vec.componentwiseMult(this->basisValues[lastDim][it.indexAt(lastDim)]);
-      vec.scalarMult(value);
-      sum.add(vec);
-
-      // increment iterator
-      int h = funcIter->moveToNext();
-
-      CGLOG("FullGridTensorEvaluator::eval(): moveToNext() == " << h);
-
-      // check if not only the last dimension index changed
-      if (h != 0) {
-        if (h < 0) {
-          break;  // all indices have been traversed, stop iteration and return sum
-        } else {
-          // more than the last index have changed, thus update partialProducts
-          for (size_t d = lastDim - h; d < lastDim; ++d) {
-            auto pp = this->partialProducts[d];  // TODO(holzmudd): could probably be optimized...
-            pp.componentwiseMult(this->basisValues[d][it.indexAt(d)]);
-            this->partialProducts[d + 1] = pp;
-          }
-        }
+    return tensors.emplace(level, std::move(values)).first->second;
+  }
+
+  /**
+   * Sums up the part of the tensor that starts at offset over the dimensions d, ..., n-1 with the
+   * basis values as weights.
+   * Summation of the form \f$\sum_{i_d} basis_d(i_d) \cdot \ldots \cdot \sum_{i_{n-1}}
+   * basis_{n-1}(i_{n-1}) \alpha_{(\ldots, i_d, \ldots, i_{n-1})} \f$
+   */
+  V const &contract(size_t d, size_t offset, std::vector<double> const &values,
+                    MultiIndex const &multiBounds, std::vector<size_t> const &strides) {
+    V &sum = accumulators[d];
+    auto const &basis = this->basisValues[d];
+    sum = V::zero();
+
+    if (d + 1 == multiBounds.size()) {
+      sum.addScaled(values.data() + offset, basis.data(), multiBounds[d]);
+    } else {
+      V &term = temporaries[d];
+
+      for (size_t i = 0; i < multiBounds[d]; ++i) {
+        V const &inner = contract(d + 1, offset + i * strides[d], values, multiBounds, strides);
+        // multiply from the left, the product is not commutative for FloatTensorVector
+        term = basis[i];
+        term.componentwiseMult(inner);
+        sum.add(term);
       }
     }
-    //    std::cout << "\n";
+
     return sum;
   }
 };
@@ -10,6 +10,7 @@
 #include <sgpp/combigrid/common/MultiIndexIterator.hpp>
 #include <sgpp/combigrid/definitions.hpp>
 #include <sgpp/combigrid/grid/hierarchy/AbstractPointHierarchy.hpp>
+#include <sgpp/combigrid/numeric/KahanAdder.hpp>
 #include <sgpp/combigrid/operation/multidim/fullgrid/AbstractFullGridSummationStrategy.hpp>
 #include <sgpp/combigrid/storage/AbstractCombigridStorage.hpp>
 #include <sgpp/combigrid/threading/PtrGuard.hpp>
@@ -29,15 +30,13 @@ class FullGridQuadraticSummationStrategy : public AbstractFullGridSummationStrat
    */
 
   double dotMult(std::vector<double> const &vector1, std::vector<double> const &vector2) {
-    double result(0.0);
+    KahanAdder result;
     if (vector1.size() == vector2.size()) {
-      for (size_t i = 0; i < vector1.size(); i++) {
-        result += vector1[i] * vector2[i];
-      }
+      result.addProducts(vector1.data(), vector2.data(), vector1.size());
     } else {
       std::cerr << "dotMult for vectors of different size is undefined. returning 0" << std::endl;
     }
-    return result;
+    return result.value();
   }
 
  public:
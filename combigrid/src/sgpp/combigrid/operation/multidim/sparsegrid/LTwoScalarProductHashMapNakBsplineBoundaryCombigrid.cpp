@@ -4,14 +4,12 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/combigrid/operation/multidim/sparsegrid/LTwoScalarProductHashMapNakBsplineBoundaryCombigrid.hpp>
-#include <sgpp/combigrid/threading/ThreadPool.hpp>
 
 #ifdef _OPENMP
 #include <omp.h>
 #endif
 
 #include <algorithm>
-#include <map>
 #include <vector>
 
 namespace sgpp {
@@ -179,8 +177,6 @@ double LTwoScalarProductHashMapNakBsplineBoundaryCombigrid::calculateScalarProdu
 
 void LTwoScalarProductHashMapNakBsplineBoundaryCombigrid::mult(sgpp::base::DataVector& alpha,
                                                                sgpp::base::DataVector& result) {
-  size_t count = 0;
-
   if ((degree != 1) && (degree != 3) && (degree != 5)) {
     std::cerr << "OperationMatrixLTwoDotNakBsplineBoundary: only B spline degrees 1, 3 and 5 are "
                  "supported."
@@ -197,140 +193,110 @@ void LTwoScalarProductHashMapNakBsplineBoundaryCombigrid::mult(sgpp::base::DataV
     throw sgpp::base::data_exception("Dimensions do not match!");
   }
 
-  //  size_t lastNumAdditionalPoints = 0;
-  size_t quadOrder = degree + 1 + numAdditionalPoints;
-  base::DataVector coordinates, weights;
+  const size_t initialQuadOrder = degree + 1 + numAdditionalPoints;
   base::GaussLegendreQuadRule1D gauss;
 
   result.setAll(0.0);
 
-  // ToDo (rehmemk) This parallelization is slower than serial execution. The criticals below are
-  // way too big, find out what really causes parallelization problems. While the complete
-  // calculateScalarProduct routine is marked critical this is not parallel at all
-  // #pragma omp parallel for schedule(static)
-  for (size_t i = 0; i < gridSize; i++) {
-    //    std::cout << "OMP uses " << omp_get_num_threads() << " thread(s)" << std::endl;
-    for (size_t j = i; j < gridSize; j++) {
-      double temp_ij = 1;
-
-      for (size_t d = 0; d < gridDim; d++) {
-        count++;
-
-        const base::level_t lid = storage[i].getLevel(d);
-        const base::level_t ljd = storage[j].getLevel(d);
-        const base::index_t iid = storage[i].getIndex(d);
-        const base::index_t ijd = storage[j].getIndex(d);
-
-        // setting the segments of the support according to the degree, level and index of the nak
-        // B-splines
-        const size_t pp1h = (degree + 1) >> 1;  //  =|_(p+1)/2_|
-        const double pp1hDbl = static_cast<double>(pp1h);
-        const sgpp::base::index_t hInvik = 1 << lid;  // = 2^lid
-        const sgpp::base::index_t hInvjk = 1 << ljd;
-        const double hik = 1.0 / static_cast<double>(hInvik);
-        const double hjk = 1.0 / static_cast<double>(hInvjk);
-        double offseti_left = (static_cast<double>(iid) - pp1hDbl) * hik;
-        double offseti_right = (static_cast<double>(iid) + pp1hDbl) * hik;
-        double offsetj_left = (static_cast<double>(ijd) - pp1hDbl) * hjk;
-        double offsetj_right = (static_cast<double>(ijd) + pp1hDbl) * hjk;
-
-        if (degree == 3) {
-          if (iid == 3) offseti_left -= hik;
-          if (iid == hInvik - 3) offseti_right += hik;
-          if (ijd == 3) offsetj_left -= hjk;
-          if (ijd == hInvjk - 3) offsetj_right += hjk;
-        } else if (degree == 5) {
-          //          if ((iid == 3) || (iid == 5)) offseti_left -= 2 * hik;
-          //          if ((iid == hInvik - 3) || (iid == hInvik - 5)) offseti_right += 2 * hik;
-          //          if ((ijd == 3) || (ijd == 5)) offsetj_left -= 2 * hjk;
-          //          if ((ijd == hInvjk - 3) || (ijd == hInvjk - 5)) offsetj_right += 2 * hjk;
-          if (iid == 5) offseti_left -= 2 * hik;
-          if ((iid == hInvik - 3) || (iid == hInvik - 5)) offseti_right += 2 * hik;
-          if (ijd == 5) offsetj_left -= 2 * hjk;
-          if ((ijd == hInvjk - 3) || (ijd == hInvjk - 5)) offsetj_right += 2 * hjk;
-          //          std::cout << "hInvjk: " << hInvjk << std::endl;
-        }
-        if (std::max(offseti_left, offsetj_left) >= std::min(offseti_right, offsetj_right)) {
-          // B spline supports do not not overlap:
-          temp_ij = 0.0;
-          break;
-        } else {
+  // the 1D scalar products are shared between the threads via the concurrent hash map, each
+  // thread accumulates the symmetric updates of result in a private vector
+#pragma omp parallel
+  {
+    base::DataVector privateResult(result.getSize(), 0.0);
+    base::DataVector coordinates, weights;
+
+    // rows with small i have the most entries, hence the dynamic schedule
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < gridSize; i++) {
+      for (size_t j = i; j < gridSize; j++) {
+        double temp_ij = 1;
+
+        for (size_t d = 0; d < gridDim; d++) {
+          const base::level_t lid = storage[i].getLevel(d);
+          const base::level_t ljd = storage[j].getLevel(d);
+          const base::index_t iid = storage[i].getIndex(d);
+          const base::index_t ijd = storage[j].getIndex(d);
+
+          // setting the segments of the support according to the degree, level and index of the
+          // nak B-splines
+          const size_t pp1h = (degree + 1) >> 1;  //  =|_(p+1)/2_|
+          const double pp1hDbl = static_cast<double>(pp1h);
+          const sgpp::base::index_t hInvik = 1 << lid;  // = 2^lid
+          const sgpp::base::index_t hInvjk = 1 << ljd;
+          const double hik = 1.0 / static_cast<double>(hInvik);
+          const double hjk = 1.0 / static_cast<double>(hInvjk);
+          double offseti_left = (static_cast<double>(iid) - pp1hDbl) * hik;
+          double offseti_right = (static_cast<double>(iid) + pp1hDbl) * hik;
+          double offsetj_left = (static_cast<double>(ijd) - pp1hDbl) * hjk;
+          double offsetj_right = (static_cast<double>(ijd) + pp1hDbl) * hjk;
+
+          if (degree == 3) {
+            if (iid == 3) offseti_left -= hik;
+            if (iid == hInvik - 3) offseti_right += hik;
+            if (ijd == 3) offsetj_left -= hjk;
+            if (ijd == hInvjk - 3) offsetj_right += hjk;
+          } else if (degree == 5) {
+            if (iid == 5) offseti_left -= 2 * hik;
+            if ((iid == hInvik - 3) || (iid == hInvik - 5)) offseti_right += 2 * hik;
+            if (ijd == 5) offsetj_left -= 2 * hjk;
+            if ((ijd == hInvjk - 3) || (ijd == hInvjk - 5)) offsetj_right += 2 * hjk;
+          }
+          if (std::max(offseti_left, offsetj_left) >= std::min(offseti_right, offsetj_right)) {
+            // B spline supports do not not overlap:
+            temp_ij = 0.0;
+            break;
+          }
+
           // if (level-Index) is already in the hash map use it
           // else calculate 1D integral int bi bj f dx and save it in the hash map
-          double temp_res = 0.0;
-
-          std::map<MultiIndex, double>::iterator it;
           MultiIndex hashMI = hashLevelIndex(lid, iid, ljd, ijd, d);
-
-          // #pragma omp critical
-          //          {
-          it = innerProducts.find(hashMI);
-          //          }
-          if (it != innerProducts.end()) {
-            temp_res = it->second;
-          } else {
-            // #pragma omp critical
-            //            {
+          double temp_res = innerProducts.getOrCompute(hashMI, [&]() {
+            size_t quadOrder = initialQuadOrder;
             gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
-            temp_res =
+            double res =
                 calculateScalarProduct(lid, iid, ljd, ijd, coordinates, weights, basis, d,
                                        offseti_left, offsetj_left, hInvik, hInvjk, hik, hjk, pp1h);
             double width = bounds[2 * d + 1] - bounds[2 * d];
-            temp_res *= width;
-            //            }
-            // ToDo (rehmemk) now for every B spline the numAdditionalPoints is reseted. Use
-            // previous numAdditionalPoints (but not simply numAdditionalPoints =
-            // lastNumAdditionalPoints, that didn't work)
-            numAdditionalPoints = 10;  // lastNumAdditionalPoints;
+            res *= width;
 
             if (isCustomWeightFunction) {
+              // increase the quadrature order until the scalar product converges
+              size_t additionalPoints = 10;
               double tol = 1e-14;
               double err = 1e14;
 
               while (err > tol) {
-                //                lastNumAdditionalPoints = numAdditionalPoints;
-                numAdditionalPoints += incrementQuadraturePoints;
-                quadOrder = degree + 1 + numAdditionalPoints;
-                // This leads to problems with the simple OMP parallelization if the abort
-                // criterion is too close to 500
+                additionalPoints += incrementQuadraturePoints;
+                quadOrder = degree + 1 + additionalPoints;
                 if (quadOrder > 480) {
                   break;
                 }
-                double finer_temp_res = 1e+14;
-                // #pragma omp critical
-                //                {
                 gauss.getLevelPointsAndWeightsNormalized(quadOrder, coordinates, weights);
-                finer_temp_res = calculateScalarProduct(lid, iid, ljd, ijd, coordinates, weights,
-                                                        basis, d, offseti_left, offsetj_left,
-                                                        hInvik, hInvjk, hik, hjk, pp1h);
-                finer_temp_res *= width;
-                //                }
-                err = fabs(temp_res - finer_temp_res);
-                temp_res = finer_temp_res;
+                double finer_res = calculateScalarProduct(lid, iid, ljd, ijd, coordinates, weights,
+                                                          basis, d, offseti_left, offsetj_left,
+                                                          hInvik, hInvjk, hik, hjk, pp1h);
+                finer_res *= width;
+                err = fabs(res - finer_res);
+                res = finer_res;
               }
             }
-            // must this be synchronized for OMP?
-            innerProducts[hashMI] = temp_res;
-          }
 
-          // #pragma omp atomic
+            return res;
+          });
+
           temp_ij *= temp_res;
         }
-      }
 
-      if (temp_ij < 0) {
-      }
-      // #pragma omp atomic
-      result[i] += temp_ij * alpha[j];
-      if (i != j) {
-        // #pragma omp atomic
-        result[j] += temp_ij * alpha[i];
+        privateResult[i] += temp_ij * alpha[j];
+        if (i != j) {
+          privateResult[j] += temp_ij * alpha[i];
+        }
       }
     }
-  }
 
-  // std::cout << "map size: " << innerProducts.size() << std::endl;
-  //  std::cout << "LTwoScalarProduct numAddP: " << numAdditionalPoints << std::endl;
+#pragma omp critical
+    { result.add(privateResult); }
+  }
 }
 }  // namespace combigrid
 }  // namespace sgpp
@@ -13,10 +13,10 @@
 #include <sgpp/combigrid/GeneralFunction.hpp>
 #include <sgpp/combigrid/definitions.hpp>
 #include <sgpp/combigrid/functions/WeightFunctionsCollection.hpp>
+#include <sgpp/combigrid/threading/ConcurrentHashMap.hpp>
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
-#include <map>
 #include <vector>
 
 namespace sgpp {
@@ -117,8 +117,8 @@ class LTwoScalarProductHashMapNakBsplineBoundaryCombigrid {
   // the increase of numAdditionalPoints in every step
   size_t incrementQuadraturePoints;
   // HashMap containing the scalar products of the 1D B spline basis functions. Access via combined
-  // MultiIndex of the level-index pair of the two splines
-  std::map<MultiIndex, double> innerProducts;
+  // MultiIndex of the level-index pair of the two splines. Can be filled by multiple threads.
+  ConcurrentHashMap<MultiIndex, double, MultiIndexHash> innerProducts;
 };
 }  // namespace combigrid
 }  // namespace sgpp
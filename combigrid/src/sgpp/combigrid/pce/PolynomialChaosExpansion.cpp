@@ -20,6 +20,7 @@
 #include <pecos_data_types.hpp>
 #endif
 
+#include <cmath>
 #include <vector>
 
 namespace sgpp {
@@ -27,7 +28,7 @@ namespace combigrid {
 
 PolynomialChaosExpansion::PolynomialChaosExpansion(
     sgpp::combigrid::CombigridSurrogateModelConfiguration& config)
-    : CombigridSurrogateModel(config), basisFunctions(0), computedSobolIndicesFlag(false) {
+    : CombigridSurrogateModel(config), basisFunctions(0) {
   if (config.basisFunctions.size() == 0 && config.basisFunction) {
     for (size_t idim = 0; idim < numDims; idim++) {
       basisFunctions.push_back(config.basisFunction);
@@ -48,122 +49,71 @@ PolynomialChaosExpansion::PolynomialChaosExpansion(
 PolynomialChaosExpansion::~PolynomialChaosExpansion() {}
 
 double PolynomialChaosExpansion::eval(sgpp::base::DataVector& x) {
-  double ans = 0.0;
-  for (auto it = expansionCoefficients.getValues()->getStoredDataIterator(); it->isValid();
-       it->moveToNext()) {
-    MultiIndex ix = it->getMultiIndex();
-    double coeff = it->value().value();
-
-    // evaluate tensor product
-    double poly = 1.0;
-    for (size_t k = 0; k < ix.size(); k++) {
-      poly *= basisFunctions[k]->evaluate(ix[k], x[k]);
-    }
-    ans += coeff * poly;
-  }
-  return ans;
+  return expansionEvaluator.eval(x);
 }
 
 void PolynomialChaosExpansion::eval(sgpp::base::DataMatrix& xs, sgpp::base::DataVector& res) {
-  size_t numSamples = xs.getNrows();
-  res.resize(numSamples);
-  res.setAll(0.0);
-  for (auto it = expansionCoefficients.getValues()->getStoredDataIterator(); it->isValid();
-       it->moveToNext()) {
-    MultiIndex ix = it->getMultiIndex();
-    double coeff = it->value().value();
-
-    for (size_t i = 0; i < numSamples; i++) {
-      // evaluate tensor product
-      double poly = 1.0;
-      for (size_t k = 0; k < ix.size(); k++) {
-        poly *= basisFunctions[k]->evaluate(ix[k], xs.get(i, k));
-      }
-
-      res[i] += coeff * poly;
-    }
-  }
+  expansionEvaluator.eval(xs, res);
 }
 
 double PolynomialChaosExpansion::mean() {
   return expansionCoefficients.get(MultiIndex(numDims, 0)).getValue();
 }
 
-double PolynomialChaosExpansion::variance() {
-  double var = 0.0;
-  auto it = expansionCoefficients.getValues()->getStoredDataIterator();
-  if (!it->isValid()) {
-    return 0.0;
-  }
-  it->moveToNext();  // ignore first entry (belonging to mean)
+double PolynomialChaosExpansion::variance() { return sobolIndices.sum(); }
 
-  for (; it->isValid(); it->moveToNext()) {
-    double coeff = it->value().value();
-    var += coeff * coeff;
-  }
-  return var;
-}
+void PolynomialChaosExpansion::updateSobolIndices() {
+  auto differences = combigridTensorOperation->getDifferences();
 
-void PolynomialChaosExpansion::computeComponentSobolIndices() {
-  // compute the component sobol indices
-  if (computedSobolIndicesFlag) {
-    return;
+  if (differences != processedDifferences) {
+    // new tensor operation or its levels have been cleared, start from scratch
+    processedDifferences = differences;
+    processedLevels.clear();
+    accumulatedCoefficients.clear();
+    size_t numSobolIndices = static_cast<size_t>(std::pow(2, numDims) - 1);
+    sobolIndices.resizeZero(numSobolIndices);
   }
 
-  size_t numSobolIndices = static_cast<size_t>(std::pow(2, numDims) - 1);
-  sobolIndices.resizeZero(numSobolIndices);
+  for (auto levelIt = differences->getStoredDataIterator(); levelIt->isValid();
+       levelIt->moveToNext()) {
+    if (!processedLevels.insert(levelIt->getMultiIndex()).second) {
+      continue;
+    }
 
-  // load index vectors
-  auto it_coeffs = expansionCoefficients.getValues()->getStoredDataIterator();
-  std::vector<MultiIndex> indexList;
-  for (; it_coeffs->isValid(); it_coeffs->moveToNext()) {
-    indexList.push_back(it_coeffs->getMultiIndex());
-  }
+    // like the combigrid evaluator, skip levels whose difference has no finite norm
+    double norm = combigridTensorOperation->getDifferenceNorm(levelIt->getMultiIndex());
+    if (std::isnan(norm) || std::isinf(norm)) {
+      continue;
+    }
 
-  for (size_t i = 0; i < numSobolIndices; i++) {
-    // loop over all the remaining basis functions
-    for (std::vector<MultiIndex>::iterator it_ixlist = indexList.begin();
-         it_ixlist != indexList.end();) {
-      MultiIndex multiIndex = *it_ixlist;
-
-      // check if all the current dimensions are set
-      bool dimsAreSet = true;
-      size_t idim = 0;
-      while (dimsAreSet && idim < numDims) {
-        // get kth bit from permuation mask
-        size_t isSet = ((i + 1) & (1 << idim)) >> idim;  // in {0, 1}
-        // check if the degree of the basis in the current dimension
-        // is > 0 if set and equal to 0 if not set
-        if (isSet == 0) {
-          dimsAreSet &= multiIndex[idim] == 0;
-        } else {
-          dimsAreSet &= multiIndex[idim] > 0;
+    FloatTensorVector const& delta = levelIt->value();
+
+    for (auto it = delta.getValues()->getStoredDataIterator(); it->isValid(); it->moveToNext()) {
+      MultiIndex multiIndex = it->getMultiIndex();
+
+      // the term contributes to the Sobol index of the dimensions with nonzero degree
+      size_t permutation = 0;
+      for (size_t idim = 0; idim < multiIndex.size(); idim++) {
+        if (multiIndex[idim] > 0) {
+          permutation |= static_cast<size_t>(1) << idim;
         }
-        idim++;
       }
 
-      // add the squared coefficient of the current term to the
-      // sobol index matrix if all dimensions are present
-      // in the current term
-      if (dimsAreSet) {
-        // load index and delete it from list since every term
-        // can just contribute to one sobol index
-        indexList.erase(it_ixlist);
-        double coefficient = expansionCoefficients.get(multiIndex).value();
-        sobolIndices[i] += coefficient * coefficient;
-      } else {
-        it_ixlist++;
+      if (permutation == 0) {
+        // the constant term belongs to the mean
+        continue;
       }
+
+      double& coefficient = accumulatedCoefficients[multiIndex];
+      double newCoefficient = coefficient + it->value().value();
+      sobolIndices[permutation - 1] += newCoefficient * newCoefficient - coefficient * coefficient;
+      coefficient = newCoefficient;
     }
   }
-
-  // update the computed flag
-  computedSobolIndicesFlag = true;
 }
 
 void PolynomialChaosExpansion::getComponentSobolIndices(
     sgpp::base::DataVector& componentSobolIndices, bool normalized) {
-  computeComponentSobolIndices();
   // copy sobol indices to output vector
   componentSobolIndices.resize(sobolIndices.getSize());
   componentSobolIndices.copyFrom(sobolIndices);
@@ -179,7 +129,6 @@ void PolynomialChaosExpansion::getComponentSobolIndices(
 
 void PolynomialChaosExpansion::getTotalSobolIndices(sgpp::base::DataVector& totalSobolIndices,
                                                     bool normalized) {
-  computeComponentSobolIndices();
   totalSobolIndices.resizeZero(numDims);
   for (size_t idim = 0; idim < numDims; idim++) {
     for (size_t iperm = 0; iperm < sobolIndices.getSize(); iperm++) {
@@ -224,7 +173,6 @@ void PolynomialChaosExpansion::updateConfig(
 
   if (config.levelStructure) {
     combigridTensorOperation->getLevelManager()->addLevelsFromStructure(config.levelStructure);
-    computedSobolIndicesFlag = false;
   }
 
   if (config.enableLevelManagerStatsCollection) {
@@ -232,6 +180,11 @@ void PolynomialChaosExpansion::updateConfig(
   }
 
   expansionCoefficients = combigridTensorOperation->getResult();
+  updateSobolIndices();
+  auto& basisFunctionsList = basisFunctions.getBasisFunctions();
+  expansionEvaluator = PolynomialExpansionEvaluator(
+      expansionCoefficients, std::vector<std::shared_ptr<AbstractInfiniteFunctionBasis1D>>(
+                                 basisFunctionsList.begin(), basisFunctionsList.end()));
 }
 
 size_t PolynomialChaosExpansion::numGridPoints() {
@@ -18,7 +18,10 @@
 #include <sgpp/combigrid/operation/CombigridOperation.hpp>
 #include <sgpp/combigrid/operation/CombigridTensorOperation.hpp>
 #include <sgpp/combigrid/pce/CombigridSurrogateModel.hpp>
+#include <sgpp/combigrid/pce/PolynomialExpansionEvaluator.hpp>
 
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace sgpp {
@@ -47,7 +50,14 @@ class PolynomialChaosExpansion : public CombigridSurrogateModel {
 
  private:
   bool updateStatus();
-  void computeComponentSobolIndices();
+
+  /**
+   * Updates the component Sobol indices with the differences (Delta values) of all levels that
+   * have been added to the tensor operation since the last call. The expansion coefficients are
+   * the sum of these differences, so the costs are proportional to the size of the new levels
+   * instead of the size of the whole expansion.
+   */
+  void updateSobolIndices();
 
 #ifdef USE_DAKOTA
   std::shared_ptr<Pecos::OrthogPolyApproximation> orthogPoly;
@@ -59,9 +69,15 @@ class PolynomialChaosExpansion : public CombigridSurrogateModel {
   // tensor operation
   std::shared_ptr<sgpp::combigrid::CombigridTensorOperation> combigridTensorOperation;
   sgpp::combigrid::FloatTensorVector expansionCoefficients;
+  sgpp::combigrid::PolynomialExpansionEvaluator expansionEvaluator;
 
   size_t currentNumGridPoints;
-  bool computedSobolIndicesFlag;
+
+  // state of the incremental Sobol index computation, see updateSobolIndices()
+  std::shared_ptr<AbstractMultiStorage<FloatTensorVector>> processedDifferences;
+  std::unordered_set<MultiIndex, MultiIndexHash> processedLevels;
+  std::unordered_map<MultiIndex, double, MultiIndexHash> accumulatedCoefficients;
+  // unnormalized component Sobol indices, i.e. the variances of the ANOVA components
   sgpp::base::DataVector sobolIndices;
 };
 
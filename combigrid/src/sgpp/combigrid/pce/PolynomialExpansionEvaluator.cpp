@@ -0,0 +1,147 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/combigrid/pce/PolynomialExpansionEvaluator.hpp>
+
+#include <algorithm>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+// definitions of the constants, they are ODR-used by std::min
+const size_t PolynomialExpansionEvaluator::blockSize;
+const size_t PolynomialExpansionEvaluator::chunkSize;
+
+PolynomialExpansionEvaluator::PolynomialExpansionEvaluator()
+    : numDims(0), numTerms(0), tableRows(0) {}
+
+PolynomialExpansionEvaluator::PolynomialExpansionEvaluator(
+    FloatTensorVector& coefficients,
+    std::vector<std::shared_ptr<AbstractInfiniteFunctionBasis1D>> const& basisFunctions)
+    : numDims(basisFunctions.size()),
+      numTerms(0),
+      basisFunctions(basisFunctions),
+      maxDegrees(basisFunctions.size(), 0),
+      dimOffsets(basisFunctions.size(), 0),
+      tableRows(0) {
+  std::vector<size_t> degrees;
+
+  for (auto it = coefficients.getValues()->getStoredDataIterator(); it->isValid();
+       it->moveToNext()) {
+    MultiIndex ix = it->getMultiIndex();
+    termCoefficients.push_back(it->value().value());
+
+    for (size_t k = 0; k < numDims; ++k) {
+      size_t degree = k < ix.size() ? ix[k] : 0;
+      degrees.push_back(degree);
+      maxDegrees[k] = std::max(maxDegrees[k], degree);
+    }
+
+    ++numTerms;
+  }
+
+  for (size_t k = 0; k < numDims; ++k) {
+    dimOffsets[k] = tableRows;
+    tableRows += maxDegrees[k] + 1;
+  }
+
+  termOffsets.resize(degrees.size());
+
+  for (size_t t = 0; t < numTerms; ++t) {
+    for (size_t k = 0; k < numDims; ++k) {
+      termOffsets[t * numDims + k] = dimOffsets[k] + degrees[t * numDims + k];
+    }
+  }
+}
+
+double PolynomialExpansionEvaluator::eval(base::DataVector const& x) {
+  base::DataMatrix xs(x.getPointer(), 1, x.getSize());
+  std::vector<double> table;
+  fillTable(xs, 0, 1, table);
+  double result = 0.0;
+  evalBlock(table.data(), 1, 0, 1, &result);
+  return result;
+}
+
+void PolynomialExpansionEvaluator::eval(base::DataMatrix const& xs, base::DataVector& res) {
+  size_t numSamples = xs.getNrows();
+  res.resize(numSamples);
+  std::vector<double> table;
+
+  for (size_t chunkStart = 0; chunkStart < numSamples; chunkStart += chunkSize) {
+    size_t numChunkSamples = std::min(chunkSize, numSamples - chunkStart);
+    // the basis functions are not necessarily thread-safe, so the table is filled sequentially
+    fillTable(xs, chunkStart, numChunkSamples, table);
+
+    int numBlocks = static_cast<int>((numChunkSamples + blockSize - 1) / blockSize);
+    double const* tableData = table.data();
+    double* resData = res.getPointer() + chunkStart;
+
+#pragma omp parallel for schedule(static)
+    for (int b = 0; b < numBlocks; ++b) {
+      size_t first = static_cast<size_t>(b) * blockSize;
+      size_t count = std::min(blockSize, numChunkSamples - first);
+      evalBlock(tableData, numChunkSamples, first, count, resData + first);
+    }
+  }
+}
+
+void PolynomialExpansionEvaluator::fillTable(base::DataMatrix const& xs, size_t first,
+                                             size_t numSamples, std::vector<double>& table) {
+  table.resize(tableRows * numSamples);
+  base::DataVector values;
+
+  for (size_t j = 0; j < numSamples; ++j) {
+    for (size_t k = 0; k < numDims; ++k) {
+      basisFunctions[k]->evaluateUpTo(maxDegrees[k], xs.get(first + j, k), values);
+
+      for (size_t degree = 0; degree <= maxDegrees[k]; ++degree) {
+        table[(dimOffsets[k] + degree) * numSamples + j] = values[degree];
+      }
+    }
+  }
+}
+
+void PolynomialExpansionEvaluator::evalBlock(double const* table, size_t numSamples,
+                                             size_t first, size_t count, double* result) {
+  double sum[blockSize];
+  double product[blockSize];
+
+  for (size_t j = 0; j < count; ++j) {
+    sum[j] = 0.0;
+  }
+
+  for (size_t t = 0; t < numTerms; ++t) {
+    double coefficient = termCoefficients[t];
+
+    for (size_t j = 0; j < count; ++j) {
+      product[j] = coefficient;
+    }
+
+    size_t const* offsets = &termOffsets[t * numDims];
+
+    for (size_t k = 0; k < numDims; ++k) {
+      double const* row = table + offsets[k] * numSamples + first;
+
+#pragma omp simd
+      for (size_t j = 0; j < count; ++j) {
+        product[j] *= row[j];
+      }
+    }
+
+#pragma omp simd
+    for (size_t j = 0; j < count; ++j) {
+      sum[j] += product[j];
+    }
+  }
+
+  for (size_t j = 0; j < count; ++j) {
+    result[j] = sum[j];
+  }
+}
+
+} /* namespace combigrid */
+} /* namespace sgpp */
@@ -0,0 +1,83 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/combigrid/algebraic/FloatTensorVector.hpp>
+#include <sgpp/combigrid/functions/AbstractInfiniteFunctionBasis1D.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Evaluates a polynomial expansion sum_k c_k prod_d phi^d_{k_d}(x_d), given by its coefficients
+ * c_k in a FloatTensorVector, at many points.
+ * The coefficients and multi-indices are copied into contiguous arrays once. For a block of
+ * samples, all one-dimensional basis values phi^d_0, ..., phi^d_{p_d} up to the maximum degree
+ * p_d that occurs in dimension d are tabulated first (see
+ * AbstractInfiniteFunctionBasis1D::evaluateUpTo()), such that the terms of the expansion only
+ * need table lookups. The loop over the samples of a block is the innermost loop, so that it can
+ * be vectorized, and the blocks are distributed over the OpenMP threads.
+ */
+class PolynomialExpansionEvaluator {
+ public:
+  PolynomialExpansionEvaluator();
+
+  /**
+   * @param coefficients expansion coefficients, indexed by the multi-indices of the basis degrees
+   * @param basisFunctions one basis per dimension
+   */
+  PolynomialExpansionEvaluator(
+      FloatTensorVector& coefficients,
+      std::vector<std::shared_ptr<AbstractInfiniteFunctionBasis1D>> const& basisFunctions);
+
+  double eval(base::DataVector const& x);
+
+  /**
+   * Evaluates the expansion at the rows of xs.
+   */
+  void eval(base::DataMatrix const& xs, base::DataVector& res);
+
+ private:
+  // number of samples that are processed together in the innermost loop
+  static const size_t blockSize = 64;
+  // number of samples whose basis values are tabulated at once
+  static const size_t chunkSize = 4096;
+
+  size_t numDims;
+  size_t numTerms;
+  std::vector<std::shared_ptr<AbstractInfiniteFunctionBasis1D>> basisFunctions;
+
+  std::vector<double> termCoefficients;
+  // offsets of the terms' basis values in the table, numTerms x numDims, row-major
+  std::vector<size_t> termOffsets;
+  std::vector<size_t> maxDegrees;
+  // start of the basis values of each dimension in the table
+  std::vector<size_t> dimOffsets;
+  size_t tableRows;
+
+  /**
+   * Tabulates the basis values at the rows first, ..., first + numSamples - 1 of xs. The value of
+   * the basis function belonging to table row r at the j-th sample is stored at
+   * table[r * numSamples + j].
+   */
+  void fillTable(base::DataMatrix const& xs, size_t first, size_t numSamples,
+                 std::vector<double>& table);
+
+  /**
+   * Sums up all terms of the expansion for the samples first, ..., first + count - 1 of a table
+   * with stride numSamples.
+   */
+  void evalBlock(double const* table, size_t numSamples, size_t first, size_t count,
+                 double* result);
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp */
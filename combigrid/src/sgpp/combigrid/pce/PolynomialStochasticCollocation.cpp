@@ -102,42 +102,12 @@ void PolynomialStochasticCollocation::initializeNormStrategies() {
 }
 
 double PolynomialStochasticCollocation::eval(sgpp::base::DataVector& x) {
-  double ans = 0.0;
-  for (auto it = expansionCoefficients.getValues()->getStoredDataIterator(); it->isValid();
-       it->moveToNext()) {
-    MultiIndex ix = it->getMultiIndex();
-    double coeff = it->value().value();
-
-    // evaluate tensor product
-    double poly = 1.0;
-    for (size_t k = 0; k < ix.size(); k++) {
-      poly *= legendreBasis->evaluate(ix[k], x[k]);
-    }
-    ans += coeff * poly;
-  }
-  return ans;
+  return expansionEvaluator.eval(x);
 }
 
 void PolynomialStochasticCollocation::eval(sgpp::base::DataMatrix& xs,
                                            sgpp::base::DataVector& res) {
-  size_t numSamples = xs.getNrows();
-  res.resize(numSamples);
-  res.setAll(0.0);
-  for (auto it = expansionCoefficients.getValues()->getStoredDataIterator(); it->isValid();
-       it->moveToNext()) {
-    MultiIndex ix = it->getMultiIndex();
-    double coeff = it->value().value();
-
-    for (size_t i = 0; i < numSamples; i++) {
-      // evaluate tensor product
-      double poly = 1.0;
-      for (size_t k = 0; k < ix.size(); k++) {
-        poly *= legendreBasis->evaluate(ix[k], xs.get(i, k));
-      }
-
-      res[i] += coeff * poly;
-    }
-  }
+  expansionEvaluator.eval(xs, res);
 }
 
 double PolynomialStochasticCollocation::computeMean() {
@@ -208,6 +178,9 @@ void PolynomialStochasticCollocation::updateConfig(
   }
 
   expansionCoefficients = combigridTensorOperation->getResult();
+  expansionEvaluator = PolynomialExpansionEvaluator(
+      expansionCoefficients,
+      std::vector<std::shared_ptr<AbstractInfiniteFunctionBasis1D>>(numDims, legendreBasis));
 }
 
 size_t PolynomialStochasticCollocation::numGridPoints() {
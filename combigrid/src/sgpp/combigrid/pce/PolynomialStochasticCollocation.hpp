@@ -16,6 +16,7 @@
 #include <sgpp/combigrid/operation/CombigridOperation.hpp>
 #include <sgpp/combigrid/operation/CombigridTensorOperation.hpp>
 #include <sgpp/combigrid/pce/CombigridSurrogateModel.hpp>
+#include <sgpp/combigrid/pce/PolynomialExpansionEvaluator.hpp>
 
 #include <sgpp/combigrid/algebraic/FirstMomentNormStrategy.hpp>
 #include <sgpp/combigrid/algebraic/VarianceNormStrategy.hpp>
@@ -65,6 +66,7 @@ class PolynomialStochasticCollocation : public CombigridSurrogateModel {
 
   // expansion coefficients
   sgpp::combigrid::FloatTensorVector expansionCoefficients;
+  sgpp::combigrid::PolynomialExpansionEvaluator expansionEvaluator;
 
   // mean and variance storage
   bool computedMeanFlag;
@@ -8,6 +8,8 @@
 namespace sgpp {
 namespace combigrid {
 
+AbstractCombigridStorage::AbstractCombigridStorage() : version(0) {}
+
 AbstractCombigridStorage::~AbstractCombigridStorage() {}
 
 } /* namespace combigrid */
@@ -26,6 +26,7 @@ namespace combigrid {
  */
 class AbstractCombigridStorage {
  public:
+  AbstractCombigridStorage();
   virtual ~AbstractCombigridStorage();
 
   /**
@@ -72,6 +73,22 @@ class AbstractCombigridStorage {
    * locked.
    */
   virtual void setMutex(std::shared_ptr<std::recursive_mutex> mutexPtr) = 0;
+
+  /**
+   * @return Returns a counter that is increased whenever stored values are replaced, e.g. by set()
+   * or deserialize(). Values that are computed on their first request do not change it. Objects
+   * that cache stored values can compare it to detect that their cache is outdated.
+   */
+  size_t getVersion() const { return version; }
+
+ protected:
+  /**
+   * Has to be called by subclasses whenever stored values are replaced.
+   */
+  void increaseVersion() { ++version; }
+
+ private:
+  size_t version;
 };
 
 } /* namespace combigrid */
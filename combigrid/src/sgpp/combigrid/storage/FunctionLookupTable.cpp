@@ -6,6 +6,8 @@
 #include <sgpp/combigrid/serialization/DefaultSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/FloatSerializationStrategy.hpp>
 #include <sgpp/combigrid/storage/FunctionLookupTable.hpp>
+#include <sgpp/combigrid/storage/FunctionValueCacheFile.hpp>
+#include <sgpp/combigrid/threading/ConcurrentHashMap.hpp>
 #include <sgpp/combigrid/utils/DataVectorHashing.hpp>
 #include <sgpp/combigrid/utils/Utils.hpp>
 
@@ -20,69 +22,54 @@ namespace combigrid {
  * Helper to realize the PIMPL pattern
  */
 struct FunctionLookupTableImpl {
-  std::shared_ptr<std::unordered_map<base::DataVector, double, DataVectorHash, DataVectorEqualTo>>
-      hashmap;
+  ConcurrentHashMap<base::DataVector, double, DataVectorHash, DataVectorEqualTo> hashmap;
   MultiFunction func;
-  std::recursive_mutex tableMutex;
+  std::shared_ptr<FunctionValueCacheFile> cacheFile;
 
-  explicit FunctionLookupTableImpl(MultiFunction func) : func(func), tableMutex() {
-    hashmap = std::make_shared<
-        std::unordered_map<base::DataVector, double, DataVectorHash, DataVectorEqualTo>>();
-  }
+  explicit FunctionLookupTableImpl(MultiFunction func) : hashmap(), func(func), cacheFile() {}
 };
 
 FunctionLookupTable::FunctionLookupTable(MultiFunction const& func)
     : impl(std::make_shared<FunctionLookupTableImpl>(func)) {}
 
 double FunctionLookupTable::operator()(const base::DataVector& x) {
-  auto it = impl->hashmap->find(x);
-  if (it == impl->hashmap->end()) {
-    auto y = impl->func(x);
-    addEntry(x, y);
-    return y;
-  }
+  return impl->hashmap.getOrCompute(x, [this, &x]() {
+    double y = impl->func(x);
 
-  return it->second;
+    if (impl->cacheFile) {
+      impl->cacheFile->addEntry(x, y);
+    }
+
+    return y;
+  });
 }
 
 double FunctionLookupTable::eval(const base::DataVector& x) { return (*this)(x); }
 
-double FunctionLookupTable::evalThreadsafe(const base::DataVector& x) {
-  impl->tableMutex.lock();
-  auto it = impl->hashmap->find(x);
-  if (it == impl->hashmap->end()) {
-    impl->tableMutex.unlock();
-    auto y = impl->func(x);
-    impl->tableMutex.lock();
-    addEntry(x, y);
-    impl->tableMutex.unlock();
-    return y;
-  }
+double FunctionLookupTable::evalThreadsafe(const base::DataVector& x) { return (*this)(x); }
 
-  std::lock_guard<std::recursive_mutex> guard(impl->tableMutex);
-  auto y = it->second;
-  impl->tableMutex.unlock();
-  return y;
-}
+void FunctionLookupTable::addEntry(const base::DataVector& x, double y) { impl->hashmap.set(x, y); }
 
-void FunctionLookupTable::addEntry(const base::DataVector& x, double y) { (*impl->hashmap)[x] = y; }
+size_t FunctionLookupTable::attachCacheFile(std::string const& filename) {
+  impl->cacheFile = std::make_shared<FunctionValueCacheFile>(
+      filename, [this](base::DataVector const& x, double y) { impl->hashmap.set(x, y); });
+  return impl->cacheFile->getNumInitialEntries();
+}
 
 std::string FunctionLookupTable::serialize() {
   FloatSerializationStrategy<double> strategy;
 
   std::vector<std::string> entries;
 
-  for (auto it = impl->hashmap->begin(); it != impl->hashmap->end(); ++it) {
+  impl->hashmap.forEach([&](base::DataVector const& vec, double value) {
     std::vector<std::string> vectorEntries;
 
-    auto& vec = it->first;
-
     for (size_t i = 0; i < vec.getSize(); ++i) {
       vectorEntries.push_back(strategy.serialize(vec[i]));
     }
 
-    entries.push_back(join(vectorEntries, ", ") + " -> " + strategy.serialize(it->second));
-  }
+    entries.push_back(join(vectorEntries, ", ") + " -> " + strategy.serialize(value));
+  });
 
   return join(entries, "\n");
 }
@@ -122,11 +109,10 @@ void FunctionLookupTable::deserialize(const std::string& value) {
 }
 
 bool FunctionLookupTable::containsEntry(const base::DataVector& x) {
-  auto it = impl->hashmap->find(x);
-  return it != impl->hashmap->end();
+  return impl->hashmap.contains(x);
 }
 
-size_t FunctionLookupTable::getNumEntries() const { return impl->hashmap->size(); }
+size_t FunctionLookupTable::getNumEntries() const { return impl->hashmap.size(); }
 
 MultiFunction FunctionLookupTable::toMultiFunction() const { return MultiFunction(*this); }
 
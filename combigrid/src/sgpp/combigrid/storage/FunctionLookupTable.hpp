@@ -11,7 +11,6 @@
 #include <sgpp/globaldef.hpp>
 
 #include <memory>
-#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -34,7 +33,7 @@ class FunctionLookupTable {
 
   /**
    * Evaluates the function at the point x. If the function has already been evaluated at this
-   * point, the stored result will be used.
+   * point, the stored result will be used. This method is thread-safe.
    */
   double operator()(base::DataVector const &x);
 
@@ -44,9 +43,9 @@ class FunctionLookupTable {
   double eval(base::DataVector const &x);
 
   /**
-   * Does the same as eval(), but uses a mutex whenever the hashtable is accessed. Crucially, the
-   * mutex is not locked when evaluating the function, such that multiple function evaluations can
-   * be done in parallel.
+   * Does the same as eval(). The table itself can be accessed from multiple threads at the same
+   * time (see ConcurrentHashMap), and no lock is held while evaluating the function, such that
+   * multiple function evaluations can be done in parallel.
    */
   double evalThreadsafe(base::DataVector const &x);
 
@@ -62,6 +61,16 @@ class FunctionLookupTable {
    */
   void addEntry(base::DataVector const &x, double y);
 
+  /**
+   * Attaches a persistent cache file (see FunctionValueCacheFile). The values stored in the file
+   * are added to the table, and every value computed from now on is appended to the file. This
+   * way, a run can be resumed after a restart without reevaluating the function. Should not be
+   * called while the table is evaluated by other threads.
+   * @param filename Path of the cache file, it is created if it does not exist.
+   * @return the number of values read from the file.
+   */
+  size_t attachCacheFile(std::string const &filename);
+
   /**
    * Stores the stored values into a string.
    */
@@ -0,0 +1,206 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/combigrid/storage/FunctionValueCacheFile.hpp>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#include <share.h>
+#include <sys/stat.h>
+#else
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+namespace {
+
+// identifies the file type and the version of the format
+const char fileMagic[8] = {'S', 'G', 'C', 'G', 'V', 'A', 'L', '1'};
+
+uint64_t doubleToWord(double value) {
+  uint64_t word;
+  std::memcpy(&word, &value, sizeof(word));
+  return word;
+}
+
+double wordToDouble(uint64_t word) {
+  double value;
+  std::memcpy(&value, &word, sizeof(value));
+  return value;
+}
+
+}  // namespace
+
+FunctionValueCacheFile::FunctionValueCacheFile(
+    std::string const &filename,
+    std::function<void(base::DataVector const &, double)> const &callback)
+    : filename(filename), numInitialEntries(0) {
+  uint64_t fileSize = 0;
+  uint64_t validSize = scan(callback, numInitialEntries, fileSize);
+
+  if (validSize == 0) {
+    // new file or a crash before the header was written, there are no entries to lose
+    std::ofstream output(filename, std::ios::binary | std::ios::trunc);
+    output.write(fileMagic, sizeof(fileMagic));
+  } else if (validSize < fileSize) {
+    // the last entry has not been written completely, drop it
+    truncate(validSize);
+  }
+
+  file.open(filename, std::ios::binary | std::ios::app);
+
+  if (!file.is_open()) {
+    throw std::runtime_error("FunctionValueCacheFile: cannot open file " + filename);
+  }
+}
+
+size_t FunctionValueCacheFile::readEntries(
+    std::function<void(base::DataVector const &, double)> callback) {
+  std::lock_guard<std::mutex> guard(fileMutex);
+  size_t numEntries = 0;
+  uint64_t fileSize = 0;
+  scan(callback, numEntries, fileSize);
+  return numEntries;
+}
+
+void FunctionValueCacheFile::addEntry(base::DataVector const &key, double value) {
+  size_t keySize = key.getSize();
+  std::vector<uint64_t> record(keySize + 3);
+  record[0] = keySize;
+
+  for (size_t i = 0; i < keySize; ++i) {
+    record[i + 1] = doubleToWord(key[i]);
+  }
+
+  record[keySize + 1] = doubleToWord(value);
+  record[keySize + 2] = checksum(record.data(), keySize + 2);
+
+  std::lock_guard<std::mutex> guard(fileMutex);
+  file.write(reinterpret_cast<char const *>(record.data()),
+             static_cast<std::streamsize>(record.size() * sizeof(uint64_t)));
+  file.flush();
+
+  if (!file.good()) {
+    throw std::runtime_error("FunctionValueCacheFile::addEntry(): cannot write to file " +
+                             filename);
+  }
+}
+
+std::string const &FunctionValueCacheFile::getFilename() const { return filename; }
+
+size_t FunctionValueCacheFile::getNumInitialEntries() const { return numInitialEntries; }
+
+uint64_t FunctionValueCacheFile::checksum(uint64_t const *data, size_t numWords) {
+  uint64_t hash = 14695981039346656037ull;
+  unsigned char const *bytes = reinterpret_cast<unsigned char const *>(data);
+
+  for (size_t i = 0; i < numWords * sizeof(uint64_t); ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ull;
+  }
+
+  return hash;
+}
+
+uint64_t FunctionValueCacheFile::scan(
+    std::function<void(base::DataVector const &, double)> const &callback, size_t &numEntries,
+    uint64_t &fileSize) {
+  std::ifstream input(filename, std::ios::binary | std::ios::ate);
+
+  if (!input.is_open()) {
+    fileSize = 0;
+    return 0;
+  }
+
+  fileSize = static_cast<uint64_t>(input.tellg());
+  input.seekg(0);
+
+  char magic[sizeof(fileMagic)];
+
+  if (!input.read(magic, sizeof(magic))) {
+    // empty or truncated header, the file is rewritten
+    return 0;
+  }
+
+  if (std::memcmp(magic, fileMagic, sizeof(fileMagic)) != 0) {
+    throw std::runtime_error("FunctionValueCacheFile: " + filename + " is not a cache file");
+  }
+
+  uint64_t validSize = sizeof(fileMagic);
+  std::vector<uint64_t> record;
+  base::DataVector key;
+
+  while (true) {
+    uint64_t keySize;
+
+    if (!input.read(reinterpret_cast<char *>(&keySize), sizeof(keySize))) {
+      break;
+    }
+
+    // a corrupted size must not lead to a huge allocation
+    if (keySize > (static_cast<uint64_t>(1) << 20)) {
+      break;
+    }
+
+    record.resize(keySize + 3);
+    record[0] = keySize;
+
+    if (!input.read(reinterpret_cast<char *>(record.data() + 1),
+                    static_cast<std::streamsize>((keySize + 2) * sizeof(uint64_t)))) {
+      break;
+    }
+
+    if (checksum(record.data(), keySize + 2) != record[keySize + 2]) {
+      break;
+    }
+
+    key.resize(keySize);
+
+    for (size_t i = 0; i < keySize; ++i) {
+      key[i] = wordToDouble(record[i + 1]);
+    }
+
+    if (callback) {
+      callback(key, wordToDouble(record[keySize + 1]));
+    }
+
+    ++numEntries;
+    validSize += record.size() * sizeof(uint64_t);
+  }
+
+  return validSize;
+}
+
+void FunctionValueCacheFile::truncate(uint64_t size) {
+#ifdef _WIN32
+  int fd = -1;
+  bool success = (_sopen_s(&fd, filename.c_str(), _O_RDWR | _O_BINARY, _SH_DENYNO,
+                           _S_IREAD | _S_IWRITE) == 0);
+
+  if (success) {
+    success = (_chsize_s(fd, static_cast<__int64>(size)) == 0);
+    _close(fd);
+  }
+#else
+  bool success = (::truncate(filename.c_str(), static_cast<off_t>(size)) == 0);
+#endif
+
+  if (!success) {
+    throw std::runtime_error("FunctionValueCacheFile: cannot truncate file " + filename + ": " +
+                             std::strerror(errno));
+  }
+}
+
+}  // namespace combigrid
+}  // namespace sgpp
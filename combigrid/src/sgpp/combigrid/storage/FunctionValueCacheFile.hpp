@@ -0,0 +1,92 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Append-only binary file that persists function values across program runs, e.g. to resume a
+ * long adaptive run with expensive model evaluations after a restart.
+ * Each entry consists of a key (typically the evaluation point) and a value. Entries are written
+ * to the end of the file as soon as they are added and the stream is flushed to the operating
+ * system, so that at most the entry that was being written is lost if the program crashes. The
+ * file is not synchronized to the disk, so entries may still be lost if the operating system
+ * crashes. Every entry carries a checksum; when the file is opened, an incomplete or corrupted
+ * entry at the end of the file is discarded by truncating the file in place.
+ * The values are stored in the native binary representation, so the file can only be read on
+ * machines with the same byte order.
+ */
+class FunctionValueCacheFile {
+ public:
+  /**
+   * Opens the cache file. If it does not exist, an empty cache file is created.
+   * The file is read once; the stored entries are passed to the callback (if given) in the order
+   * they were added.
+   * @throws std::runtime_error if the file cannot be opened or is not a cache file.
+   */
+  explicit FunctionValueCacheFile(
+      std::string const &filename,
+      std::function<void(base::DataVector const &, double)> const &callback = nullptr);
+
+  /**
+   * Reads all entries stored in the file and passes them to the callback in the order they were
+   * added. If a key has been added multiple times, it is passed multiple times.
+   * @return the number of entries read.
+   */
+  size_t readEntries(std::function<void(base::DataVector const &, double)> callback);
+
+  /**
+   * Appends an entry to the file and flushes it to the operating system. This method is
+   * thread-safe.
+   */
+  void addEntry(base::DataVector const &key, double value);
+
+  std::string const &getFilename() const;
+
+  /**
+   * @return the number of valid entries the file contained when it was opened.
+   */
+  size_t getNumInitialEntries() const;
+
+ private:
+  std::string filename;
+  std::ofstream file;
+  std::mutex fileMutex;
+  size_t numInitialEntries;
+
+  /**
+   * Checksum of a number of 64 bit words (FNV-1a over the bytes).
+   */
+  static uint64_t checksum(uint64_t const *data, size_t numWords);
+
+  /**
+   * Reads the file from the start, calling the callback (if given) for every valid entry.
+   * @param callback called for every valid entry
+   * @param numEntries incremented for every valid entry
+   * @param fileSize set to the size of the file (zero if it does not exist)
+   * @return the file offset after the last valid entry.
+   */
+  uint64_t scan(std::function<void(base::DataVector const &, double)> const &callback,
+                size_t &numEntries, uint64_t &fileSize);
+
+  /**
+   * Shortens the file to the given size without rewriting its content.
+   */
+  void truncate(uint64_t size);
+};
+
+}  // namespace combigrid
+}  // namespace sgpp
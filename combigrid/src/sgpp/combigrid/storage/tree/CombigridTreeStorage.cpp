@@ -7,10 +7,12 @@
 
 #include <sgpp/combigrid/serialization/FloatSerializationStrategy.hpp>
 #include <sgpp/combigrid/serialization/TreeStorageSerializationStrategy.hpp>
+#include <sgpp/combigrid/storage/FunctionValueCacheFile.hpp>
 #include <sgpp/combigrid/threading/PtrGuard.hpp>
 
 #include <iostream>
 #include <mutex>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -48,7 +50,13 @@ class CombigridTreeStorageImpl {
         CGLOG("leave guard(this->mutexPtr) in CGStorage");
       }
 
-      return func(*coordinates);
+      double value = func(*coordinates);
+
+      if (cacheFile) {
+        cacheFile->addEntry(cacheKey(level, index), value);
+      }
+
+      return value;
     };
 
     auto outerLambda = [innerLambda, this](MultiIndex const &level) {
@@ -70,11 +78,27 @@ class CombigridTreeStorageImpl {
     }
   }
 
+  /**
+   * Key of a value in the cache file, consisting of the (reduced) level and the index.
+   */
+  base::DataVector cacheKey(MultiIndex const &level, MultiIndex const &index) {
+    size_t numDimensions = pointHierarchies.size();
+    base::DataVector key(2 * numDimensions);
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      key[d] = static_cast<double>(level[d]);
+      key[numDimensions + d] = static_cast<double>(index[d]);
+    }
+
+    return key;
+  }
+
   std::function<double(base::DataVector const &)> func;
   std::vector<std::shared_ptr<AbstractPointHierarchy>> pointHierarchies;
   std::shared_ptr<TreeStorage<std::shared_ptr<TreeStorage<double>>>> storage;
   std::shared_ptr<std::recursive_mutex> mutexPtr;
   bool exploitNesting;
+  std::shared_ptr<FunctionValueCacheFile> cacheFile;
 };
 
 CombigridTreeStorage::CombigridTreeStorage(
@@ -174,6 +198,7 @@ void CombigridTreeStorage::deserialize(const std::string &str) {
   impl->storage = outerSerializationStrategy.deserialize(str);
 
   impl->setFunctions();
+  increaseVersion();
 }
 
 void CombigridTreeStorage::set(const MultiIndex &level, const MultiIndex &index, double value) {
@@ -185,6 +210,7 @@ void CombigridTreeStorage::set(const MultiIndex &level, const MultiIndex &index,
     }
   }
   impl->storage->get(reducedLevel)->set(index, value);
+  increaseVersion();
 }
 
 double CombigridTreeStorage::get(MultiIndex const &level, MultiIndex const &index) {
@@ -198,6 +224,31 @@ double CombigridTreeStorage::get(MultiIndex const &level, MultiIndex const &inde
   return impl->storage->get(reducedLevel)->get(index);
 }
 
+size_t CombigridTreeStorage::attachCacheFile(std::string const &filename) {
+  size_t numDimensions = impl->pointHierarchies.size();
+
+  impl->cacheFile = std::make_shared<FunctionValueCacheFile>(filename, [this, numDimensions](
+      base::DataVector const &key, double value) {
+    if (key.getSize() != 2 * numDimensions) {
+      throw std::runtime_error(
+          "CombigridTreeStorage::attachCacheFile(): the cache file belongs to a storage of "
+          "different dimension");
+    }
+
+    MultiIndex level(numDimensions), index(numDimensions);
+
+    for (size_t d = 0; d < numDimensions; ++d) {
+      level[d] = static_cast<size_t>(key[d]);
+      index[d] = static_cast<size_t>(key[numDimensions + d]);
+    }
+
+    impl->storage->get(level)->set(index, value);
+  });
+
+  increaseVersion();
+  return impl->cacheFile->getNumInitialEntries();
+}
+
 void CombigridTreeStorage::setMutex(std::shared_ptr<std::recursive_mutex> mutexPtr) {
   impl->mutexPtr = mutexPtr;
 }
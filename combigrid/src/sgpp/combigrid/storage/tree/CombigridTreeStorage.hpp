@@ -68,6 +68,17 @@ class CombigridTreeStorage : public AbstractCombigridStorage {
   virtual std::string serialize();
   virtual void deserialize(std::string const &str);
 
+  /**
+   * Attaches a persistent cache file (see FunctionValueCacheFile). The values stored in the file
+   * are put into the storage, and every function value computed from now on is appended to the
+   * file. This way, an adaptive run can be resumed after a restart without reevaluating the
+   * function. The values are identified by level and index, so the file has to be used with the
+   * same point hierarchies.
+   * @param filename Path of the cache file, it is created if it does not exist.
+   * @return the number of values read from the file.
+   */
+  size_t attachCacheFile(std::string const &filename);
+
   virtual void set(MultiIndex const &level, MultiIndex const &index, double value);
   double get(MultiIndex const &level, MultiIndex const &index) override;
   virtual void setMutex(std::shared_ptr<std::recursive_mutex> mutexPtr);
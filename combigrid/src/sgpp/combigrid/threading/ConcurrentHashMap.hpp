@@ -0,0 +1,156 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace combigrid {
+
+/**
+ * Hash map that can be read and written from multiple threads at the same time. The keys are
+ * distributed over a fixed number of shards by their hash value, each shard is an
+ * std::unordered_map with its own mutex. Threads only contend if they access keys of the same
+ * shard, and the mutex of a shard is only held for the lookup or insertion itself, never while a
+ * missing value is computed (see getOrCompute()).
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class ConcurrentHashMap {
+  struct Shard {
+    mutable std::mutex mutex;
+    std::unordered_map<Key, Value, Hash, KeyEqual> map;
+  };
+
+  Hash hash;
+  std::vector<Shard> shards;
+
+  Shard &getShard(Key const &key) {
+    size_t h = hash(key);
+    // the low bits of some hash functions are poorly distributed
+    h ^= h >> 16;
+    return shards[h % shards.size()];
+  }
+
+  Shard const &getShard(Key const &key) const {
+    return const_cast<ConcurrentHashMap *>(this)->getShard(key);
+  }
+
+ public:
+  /**
+   * @param numShards Number of independently locked parts of the map. Should be well above the
+   * number of threads accessing the map.
+   */
+  explicit ConcurrentHashMap(size_t numShards = 64)
+      : hash(), shards(numShards > 0 ? numShards : 1) {}
+
+  /**
+   * Looks up the value stored for the key.
+   * @return true iff a value is stored for the key. In this case, it is copied into value.
+   */
+  bool find(Key const &key, Value &value) const {
+    Shard const &shard = getShard(key);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    auto it = shard.map.find(key);
+
+    if (it == shard.map.end()) {
+      return false;
+    }
+
+    value = it->second;
+    return true;
+  }
+
+  /**
+   * @return true iff a value is stored for the key.
+   */
+  bool contains(Key const &key) const {
+    Shard const &shard = getShard(key);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    return shard.map.find(key) != shard.map.end();
+  }
+
+  /**
+   * Stores the value for the key, an existing value is overwritten.
+   */
+  void set(Key const &key, Value const &value) {
+    Shard &shard = getShard(key);
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    shard.map[key] = value;
+  }
+
+  /**
+   * Returns the value stored for the key. If there is none, it is computed by calling compute()
+   * without holding any lock, such that multiple values can be computed in parallel. If two
+   * threads compute the value for the same key at the same time, the value inserted first is kept
+   * and returned to both of them.
+   */
+  template <typename Function>
+  Value getOrCompute(Key const &key, Function compute) {
+    Shard &shard = getShard(key);
+
+    {
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      auto it = shard.map.find(key);
+
+      if (it != shard.map.end()) {
+        return it->second;
+      }
+    }
+
+    Value value = compute();
+
+    std::lock_guard<std::mutex> guard(shard.mutex);
+    return shard.map.emplace(key, std::move(value)).first->second;
+  }
+
+  /**
+   * @return the number of stored entries.
+   */
+  size_t size() const {
+    size_t result = 0;
+
+    for (Shard const &shard : shards) {
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      result += shard.map.size();
+    }
+
+    return result;
+  }
+
+  /**
+   * Removes all entries.
+   */
+  void clear() {
+    for (Shard &shard : shards) {
+      std::lock_guard<std::mutex> guard(shard.mutex);
+      shard.map.clear();
+    }
+  }
+
+  /**
+   * Calls func(key, value) for every stored entry. Each shard is locked while it is traversed, so
+   * func must not access the map itself.
+   */
+  template <typename Function>
+  void forEach(Function func) const {
+    for (Shard const &shard : shards) {
+      std::lock_guard<std::mutex> guard(shard.mutex);
+
+      for (auto const &entry : shard.map) {
+        func(entry.first, entry.second);
+      }
+    }
+  }
+};
+
+} /* namespace combigrid */
+} /* namespace sgpp */
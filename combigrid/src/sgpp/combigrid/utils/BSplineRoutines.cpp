@@ -11,6 +11,7 @@
 #include <sgpp/base/exception/application_exception.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <string>
 #include <vector>
@@ -109,7 +110,141 @@ std::vector<double> createNakKnots(std::vector<double> const& xValues, size_t co
   }
 }
 
-// ToDo (rehmemk) use unidirectional principle instead of global SLE solving to speed this up?!
+namespace {
+
+/**
+ * LU decomposition with partial pivoting, PA = LU. L (without its unit diagonal) and U are
+ * stored in A, the row permutation in pivots.
+ * @return false if the matrix is singular
+ */
+bool decomposeLU(sgpp::base::DataMatrix& A, std::vector<size_t>& pivots) {
+  size_t n = A.getNrows();
+  pivots.resize(n);
+
+  for (size_t i = 0; i < n; ++i) {
+    pivots[i] = i;
+  }
+
+  for (size_t k = 0; k < n; ++k) {
+    size_t pivotRow = k;
+
+    for (size_t i = k + 1; i < n; ++i) {
+      if (std::abs(A.get(i, k)) > std::abs(A.get(pivotRow, k))) {
+        pivotRow = i;
+      }
+    }
+
+    if (A.get(pivotRow, k) == 0.0) {
+      return false;
+    }
+
+    if (pivotRow != k) {
+      std::swap(pivots[k], pivots[pivotRow]);
+
+      for (size_t j = 0; j < n; ++j) {
+        double tmp = A.get(k, j);
+        A.set(k, j, A.get(pivotRow, j));
+        A.set(pivotRow, j, tmp);
+      }
+    }
+
+    for (size_t i = k + 1; i < n; ++i) {
+      double factor = A.get(i, k) / A.get(k, k);
+      A.set(i, k, factor);
+
+      for (size_t j = k + 1; j < n; ++j) {
+        A.set(i, j, A.get(i, j) - factor * A.get(k, j));
+      }
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+bool solveTensorProductSLE(std::vector<sgpp::base::DataMatrix> const& matrices1D,
+                           sgpp::base::DataVector const& b, sgpp::base::DataVector& x) {
+  size_t numDimensions = matrices1D.size();
+  size_t numPoints = b.getSize();
+  // number of fiber entries that are processed together
+  const size_t chunkSize = 64;
+
+  x = b;
+  sgpp::base::DataVector buffer(numPoints);
+  // number of points that belong to one index of the current dimension
+  size_t stride = numPoints;
+
+  for (size_t dim = 0; dim < numDimensions; ++dim) {
+    sgpp::base::DataMatrix LU(matrices1D[dim]);
+    std::vector<size_t> pivots;
+
+    if (!decomposeLU(LU, pivots)) {
+      return false;
+    }
+
+    size_t n = LU.getNrows();
+    stride /= n;
+    size_t blockSize = n * stride;
+    size_t numChunks = (stride + chunkSize - 1) / chunkSize;
+    int numTasks = static_cast<int>((numPoints / blockSize) * numChunks);
+    double const* in = x.getPointer();
+    double* out = buffer.getPointer();
+
+    // solve the systems for all fibers in this dimension, chunkSize fibers at once
+#pragma omp parallel for schedule(static)
+    for (int task = 0; task < numTasks; ++task) {
+      size_t block = static_cast<size_t>(task) / numChunks;
+      size_t first = (static_cast<size_t>(task) % numChunks) * chunkSize;
+      size_t count = std::min(chunkSize, stride - first);
+      double const* inBlock = in + block * blockSize + first;
+      double* outBlock = out + block * blockSize + first;
+
+      // forward substitution L y = P b
+      for (size_t i = 0; i < n; ++i) {
+        double* outRow = outBlock + i * stride;
+        double const* inRow = inBlock + pivots[i] * stride;
+
+        for (size_t s = 0; s < count; ++s) {
+          outRow[s] = inRow[s];
+        }
+
+        for (size_t j = 0; j < i; ++j) {
+          double factor = LU.get(i, j);
+          double const* outRowJ = outBlock + j * stride;
+
+          for (size_t s = 0; s < count; ++s) {
+            outRow[s] -= factor * outRowJ[s];
+          }
+        }
+      }
+
+      // backward substitution U x = y
+      for (size_t i = n; i-- > 0;) {
+        double* outRow = outBlock + i * stride;
+
+        for (size_t j = i + 1; j < n; ++j) {
+          double factor = LU.get(i, j);
+          double const* outRowJ = outBlock + j * stride;
+
+          for (size_t s = 0; s < count; ++s) {
+            outRow[s] -= factor * outRowJ[s];
+          }
+        }
+
+        double diagonal = LU.get(i, i);
+
+        for (size_t s = 0; s < count; ++s) {
+          outRow[s] /= diagonal;
+        }
+      }
+    }
+
+    x.swap(buffer);
+  }
+
+  return true;
+}
 
 sgpp::combigrid::GridFunction BSplineCoefficientGridFunction(
     sgpp::combigrid::MultiFunction func, sgpp::combigrid::CombiHierarchies::Collection grids,
@@ -137,15 +272,30 @@ sgpp::combigrid::GridFunction BSplineCoefficientGridFunction(
 
     std::vector<bool> orderingConfiguration;
 
-    sgpp::combigrid::CombiEvaluators::Collection evalCopy(numDimensions);
+    // the interpolation matrix is the Kronecker product of the one-dimensional interpolation
+    // matrices A_k(i, j) = (j-th basis function evaluated at the i-th grid point)
+    std::vector<sgpp::base::DataMatrix> matrices1D(numDimensions);
     for (size_t dim = 0; dim < numDimensions; ++dim) {
-      evalCopy[dim] = interpolEvaluators[dim]->cloneLinear();
-      bool needsSorted = evalCopy[dim]->needsOrderedPoints();
+      auto evalCopy = interpolEvaluators[dim]->cloneLinear();
+      bool needsSorted = evalCopy->needsOrderedPoints();
       auto gridPoints = grids[dim]->getPoints(level[dim], needsSorted);
       orderingConfiguration.push_back(needsSorted);
-      evalCopy[dim]->setGridPoints(gridPoints);
+      evalCopy->setGridPoints(gridPoints);
+
+      size_t n = numGridPointsVec[dim];
+      matrices1D[dim].resize(n, n);
+      sgpp::combigrid::MultiIndex pointIndex(numDimensions, 0);
+      for (size_t i = 0; i < n; ++i) {
+        pointIndex[dim] = i;
+        evalCopy->setParameter(
+            sgpp::combigrid::FloatScalarVector(grid->getGridPoint(pointIndex)[dim]));
+        auto basisValues1D = evalCopy->getBasisValues();
+        for (size_t j = 0; j < n; ++j) {
+          matrices1D[dim].set(i, j, basisValues1D[j].value());
+        }
+      }
     }
-    sgpp::base::DataMatrix A(numGridPoints, numGridPoints);
+
     sgpp::base::DataVector coefficients_sle(numGridPoints);
     sgpp::base::DataVector functionValues(numGridPoints);
 
@@ -155,41 +305,12 @@ sgpp::combigrid::GridFunction BSplineCoefficientGridFunction(
     auto funcIter = funcStorage->getGuidedIterator(level, it, orderingConfiguration);
 
     for (size_t ixEvalPoints = 0; funcIter->isValid(); ++ixEvalPoints, funcIter->moveToNext()) {
-      auto gridPoint = grid->getGridPoint(funcIter->getMultiIndex());
       functionValues[ixEvalPoints] = funcIter->value();
-
-      std::vector<std::vector<double>> basisValues;
-      for (size_t dim = 0; dim < numDimensions; ++dim) {
-        evalCopy[dim]->setParameter(sgpp::combigrid::FloatScalarVector(gridPoint[dim]));
-        auto basisValues1D = evalCopy[dim]->getBasisValues();
-        // basis values at gridPoint
-        std::vector<double> basisValues1D_vec(basisValues1D.size());
-        for (size_t i = 0; i < basisValues1D.size(); i++) {
-          basisValues1D_vec[i] = basisValues1D[i].value();
-        }
-        basisValues.push_back(basisValues1D_vec);
-      }
-
-      sgpp::combigrid::MultiIndexIterator innerIter(grid->numPoints());
-      for (size_t ixBasisFunctions = 0; innerIter.isValid();
-           ++ixBasisFunctions, innerIter.moveToNext()) {
-        double splineValue = 1.0;
-        auto innerIndex = innerIter.getMultiIndex();
-        for (size_t dim = 0; dim < numDimensions; ++dim) {
-          splineValue *= basisValues[dim][innerIndex[dim]];
-        }
-        A.set(ixEvalPoints, ixBasisFunctions, splineValue);
-      }
     }
 
-    sgpp::optimization::FullSLE sle(A);
-
-    sgpp::optimization::sle_solver::Auto solver;
-    sgpp::optimization::Printer::getInstance().setVerbosity(-1);
-    bool solved = solver.solve(sle, functionValues, coefficients_sle);
-
-    if (!solved) {
-      exit(-1);
+    if (!solveTensorProductSLE(matrices1D, functionValues, coefficients_sle)) {
+      throw sgpp::base::application_exception(
+          "BSplineRoutines::BSplineCoefficientGridFunction - interpolation matrix is singular.");
     }
 
     it.reset();
@@ -247,8 +368,21 @@ sgpp::combigrid::GridFunction BSplineTensorCoefficientGridFunction(
       orderingConfiguration.push_back(needsSorted);
       evalCopy[dim]->setGridPoints(gridPoints);
     }
-    sgpp::base::DataMatrix A(numGridPoints, numGridPoints);
-    A.setAll(0.0);
+    // the interpolation matrix is the Kronecker product of the one-dimensional matrices
+    // A_k(j, i) = (j-th basis function evaluated at the i-th grid point)
+    std::vector<sgpp::base::DataMatrix> matrices1D(numDimensions);
+    for (size_t dim = 0; dim < numDimensions; ++dim) {
+      size_t n = numGridPointsVec[dim];
+      auto basisValues = evalCopy[dim]->getBasisValues();
+      matrices1D[dim].resize(n, n);
+      for (size_t i = 0; i < n; ++i) {
+        for (size_t j = 0; j < n; ++j) {
+          auto iy = sgpp::combigrid::MultiIndex{getUniqueIndex(level[dim], j)};
+          matrices1D[dim].set(j, i, basisValues[i].get(iy).getValue());
+        }
+      }
+    }
+
     sgpp::base::DataVector coefficients_sle(numGridPoints);
     sgpp::base::DataVector functionValues(numGridPoints);
 
@@ -257,32 +391,11 @@ sgpp::combigrid::GridFunction BSplineTensorCoefficientGridFunction(
 
     auto funcIter = funcStorage->getGuidedIterator(level, it, orderingConfiguration);
 
-    // assemble interpolation matrix from tensors and rhs
     for (size_t ixEvalPoints = 0; funcIter->isValid(); ++ixEvalPoints, funcIter->moveToNext()) {
-      // assemble row ixEvalPoints of interpolation matrix
-      // load function values
       functionValues[ixEvalPoints] = funcIter->value();
-
-      // load basis evaluations per dimension from tensor
-      sgpp::combigrid::MultiIndex ix = funcIter->getMultiIndex();
-      sgpp::combigrid::MultiIndexIterator innerIter(grid->numPoints());
-      for (size_t ixBasisFunctions = 0; innerIter.isValid();
-           ++ixBasisFunctions, innerIter.moveToNext()) {
-        double splineValue = 1.0;
-        auto innerIndex = innerIter.getMultiIndex();
-        for (size_t idim = 0; idim < numDimensions; ++idim) {
-          auto iy = sgpp::combigrid::MultiIndex{getUniqueIndex(level[idim], innerIndex[idim])};
-          splineValue *= evalCopy[idim]->getBasisValues()[ix[idim]].get(iy).getValue();
-        }
-        A.set(ixBasisFunctions, ixEvalPoints, splineValue);
-      }
     }
 
-    sgpp::optimization::FullSLE sle(A);
-
-    sgpp::optimization::sle_solver::Auto solver;
-    sgpp::optimization::Printer::getInstance().setVerbosity(-1);
-    bool solved = solver.solve(sle, functionValues, coefficients_sle);
+    bool solved = solveTensorProductSLE(matrices1D, functionValues, coefficients_sle);
 
     if (!solved) {
       throw sgpp::base::application_exception(
@@ -70,6 +70,24 @@ std::vector<double> createNakKnots(std::vector<double> const& xValues, size_t co
  */
 size_t getUniqueIndex(size_t level, size_t index);
 
+/**
+ * Solves a linear system on a full grid whose matrix is the Kronecker product
+ * A = A_1 x ... x A_d of one-dimensional matrices, as it is the case for tensor product
+ * interpolation. Instead of assembling A, an LU decomposition of each A_k is computed and the
+ * one-dimensional systems are solved for all fibers of the grid in dimension k, one dimension
+ * after the other. This needs O(N * (n_1 + ... + n_d)) operations for N = n_1 * ... * n_d grid
+ * points instead of O(N^3).
+ * The entries of b and x are ordered like the multi-indices of a MultiIndexIterator, i.e. the
+ * last dimension is the fastest one.
+ *
+ * @param matrices1D the square matrices A_k
+ * @param b right hand side
+ * @param x solution
+ * @return whether all one-dimensional systems could be solved
+ */
+bool solveTensorProductSLE(std::vector<sgpp::base::DataMatrix> const& matrices1D,
+                           sgpp::base::DataVector const& b, sgpp::base::DataVector& x);
+
 /**
  * Creates the GridFunction that calculates the coefficients of the B-spline interpolation.
  * The coefficients for each B-Spline are saved in a TreeStorage encoded by a MultiIndex
@@ -24,6 +24,7 @@
 #include <sgpp/combigrid/utils/AnalyticModels.hpp>
 #include <sgpp/combigrid/utils/BSplineRoutines.hpp>
 #include <sgpp/optimization/sle/solver/Auto.hpp>
+#include <sgpp/optimization/sle/system/FullSLE.hpp>
 #include <sgpp/optimization/sle/system/HierarchisationSLE.hpp>
 
 #include <sgpp/globaldef.hpp>
@@ -32,6 +33,7 @@
 #include <cmath>
 #include <fstream>
 #include <iostream>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -277,6 +279,57 @@ double L2BsplineInterpolationError(size_t numDimensions, size_t degree,
   return L2Err;
 }
 
+BOOST_AUTO_TEST_CASE(testTensorProductSLE) {
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  std::vector<size_t> sizes{3, 1, 4, 5};
+  size_t numPoints = 60;
+
+  std::vector<sgpp::base::DataMatrix> matrices1D;
+  for (size_t n : sizes) {
+    sgpp::base::DataMatrix A(n, n);
+    for (size_t i = 0; i < n; i++) {
+      for (size_t j = 0; j < n; j++) {
+        A.set(i, j, distribution(generator) + (i == j ? 3.0 : 0.0));
+      }
+    }
+    matrices1D.push_back(A);
+  }
+
+  // assemble the Kronecker product
+  sgpp::base::DataMatrix A(numPoints, numPoints);
+  sgpp::combigrid::MultiIndex bounds(sizes.begin(), sizes.end());
+  sgpp::combigrid::MultiIndexIterator rowIt(bounds);
+  for (size_t row = 0; rowIt.isValid(); row++, rowIt.moveToNext()) {
+    sgpp::combigrid::MultiIndexIterator colIt(bounds);
+    for (size_t col = 0; colIt.isValid(); col++, colIt.moveToNext()) {
+      double value = 1.0;
+      for (size_t dim = 0; dim < sizes.size(); dim++) {
+        value *= matrices1D[dim].get(rowIt.indexAt(dim), colIt.indexAt(dim));
+      }
+      A.set(row, col, value);
+    }
+  }
+
+  sgpp::base::DataVector b(numPoints);
+  for (size_t i = 0; i < numPoints; i++) {
+    b[i] = distribution(generator);
+  }
+
+  sgpp::base::DataVector x;
+  BOOST_CHECK(solveTensorProductSLE(matrices1D, b, x));
+  BOOST_CHECK_EQUAL(x.getSize(), numPoints);
+
+  sgpp::optimization::FullSLE sle(A);
+  sgpp::optimization::sle_solver::Auto solver;
+  sgpp::base::DataVector xReference(numPoints);
+  BOOST_CHECK(solver.solve(sle, b, xReference));
+
+  for (size_t i = 0; i < numPoints; i++) {
+    BOOST_CHECK_SMALL(x[i] - xReference[i], 1e-10);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(testCorrespondingDegreeInterpolation) {
   std::cout
       << "Testing interpolation of x^d+y^d for B splines of degree d on level d, d in {1,3,5}."
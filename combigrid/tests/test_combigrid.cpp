@@ -28,7 +28,9 @@ using sgpp::base::DataVector;
 using sgpp::combigrid::AbstractMultiStorage;
 using sgpp::combigrid::FloatArrayVector;
 using sgpp::combigrid::CombigridMultiOperation;
+using sgpp::combigrid::CombigridOperation;
 using sgpp::combigrid::MultiFunction;
+using sgpp::combigrid::MultiIndex;
 using sgpp::combigrid::Stopwatch;
 using sgpp::combigrid::MCIntegrator;
 
@@ -313,4 +315,68 @@ BOOST_AUTO_TEST_CASE(testBsplinedeg3Interpolation) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(testMultiEvaluationConsistency) {
+  // a polynomial of low degree is interpolated exactly by the Clenshaw-Curtis interpolation
+  auto func = MultiFunction([](DataVector const &x) {
+    return 1.0 + x[0] * x[1] * x[1] - 2.0 * x[2] + 0.5 * x[0] * x[2];
+  });
+  const size_t d = 3;
+  const size_t q = 4;
+  auto ctInterpolator =
+      sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(d, func);
+  auto ctMultiInterpolator =
+      CombigridMultiOperation::createExpClenshawCurtisPolynomialInterpolation(d, func);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  std::vector<DataVector> params(50, DataVector(d));
+
+  for (auto &param : params) {
+    for (size_t i = 0; i < d; ++i) {
+      param[i] = distribution(generator);
+    }
+  }
+
+  // the second evaluation reuses the function values gathered by the first one
+  for (size_t repetition = 0; repetition < 2; ++repetition) {
+    DataVector result = ctMultiInterpolator->evaluate(q, params);
+    BOOST_CHECK_EQUAL(result.getSize(), params.size());
+
+    for (size_t i = 0; i < params.size(); ++i) {
+      BOOST_CHECK_SMALL(result[i] - func(params[i]), 1e-12);
+      BOOST_CHECK_SMALL(result[i] - ctInterpolator->evaluate(q, params[i]), 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testInvalidateStorageCache) {
+  // both polynomials are interpolated exactly
+  auto f = MultiFunction([](DataVector const &x) { return 1.0 + x[0] * x[1]; });
+  auto g = MultiFunction([](DataVector const &x) { return 2.0 - x[0] + x[1] * x[1]; });
+  const size_t d = 2;
+  const size_t q = 3;
+  auto fInterpolator = CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(d, f);
+  auto gInterpolator = CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(d, g);
+  DataVector param(d);
+  param[0] = 0.3;
+  param[1] = 0.8;
+  BOOST_CHECK_SMALL(fInterpolator->evaluate(q, param) - f(param), 1e-12);
+  BOOST_CHECK_SMALL(gInterpolator->evaluate(q, param) - g(param), 1e-12);
+
+  // replace the function values of f by those of g, the cached values are discarded
+  // automatically
+  fInterpolator->getStorage()->deserialize(gInterpolator->getStorage()->serialize());
+  BOOST_CHECK_SMALL(fInterpolator->evaluate(q, param) - g(param), 1e-12);
+
+  // changing a single value has to be detected as well
+  MultiIndex level(d, 0);
+  MultiIndex index(d, 0);
+  double oldValue = fInterpolator->getStorage()->get(level, index);
+  double oldResult = fInterpolator->evaluate(q, param);
+  fInterpolator->getStorage()->set(level, index, oldValue + 1.0);
+  BOOST_CHECK_GT(std::abs(fInterpolator->evaluate(q, param) - oldResult), 1e-6);
+  fInterpolator->getStorage()->set(level, index, oldValue);
+  BOOST_CHECK_SMALL(fInterpolator->evaluate(q, param) - oldResult, 1e-12);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -6,7 +6,9 @@
 #define BOOST_TEST_DYN_LINK
 #include <boost/test/unit_test.hpp>
 
+#include <sgpp/combigrid/algebraic/FloatArrayVector.hpp>
 #include <sgpp/combigrid/functions/OrthogonalPolynomialBasis1D.hpp>
+#include <sgpp/combigrid/numeric/KahanAdder.hpp>
 #include <sgpp/combigrid/operation/CombigridTensorOperation.hpp>
 #include <sgpp/combigrid/operation/onedim/PolynomialQuadratureEvaluator.hpp>
 #include <sgpp/combigrid/pce/CombigridSurrogateModel.hpp>
@@ -14,6 +16,7 @@
 #include <sgpp/combigrid/utils/AnalyticModels.hpp>
 #include <sgpp/quadrature/sampling/LatinHypercubeSampleGenerator.hpp>
 
+#include <cmath>
 #include <vector>
 
 const double tolerance = 1e-12;
@@ -262,4 +265,48 @@ BOOST_AUTO_TEST_CASE(testVarianceComputationWithPCETransformation_Lognormal_Clen
 
 #endif
 
+BOOST_AUTO_TEST_CASE(testKahanAdderBulk) {
+  // one large value followed by many values that are lost in plain summation
+  const size_t n = 10003;
+  std::vector<double> values(n, 1e-16);
+  values[0] = 1.0;
+  double exact = 1.0 + static_cast<double>(n - 1) * 1e-16;
+
+  sgpp::combigrid::KahanAdder bulkAdder;
+  bulkAdder.add(values.data(), n);
+  sgpp::combigrid::KahanAdder scalarAdder;
+  for (size_t i = 0; i < n; i++) {
+    scalarAdder.add(values[i]);
+  }
+  BOOST_CHECK_SMALL(bulkAdder.value() - exact, 1e-15);
+  BOOST_CHECK_SMALL(scalarAdder.value() - exact, 1e-15);
+
+  std::vector<double> factors(n, 2.0);
+  sgpp::combigrid::KahanAdder productAdder;
+  productAdder.addProducts(factors.data(), values.data(), n);
+  BOOST_CHECK_SMALL(productAdder.value() - 2.0 * exact, 2e-15);
+
+  // the bulk version of addScaled has to match the element-wise one
+  std::vector<sgpp::combigrid::FloatArrayVector> others;
+  for (size_t i = 0; i < 7; i++) {
+    std::vector<sgpp::combigrid::FloatScalarVector> entries;
+    for (size_t j = 0; j <= i % 3; j++) {
+      entries.push_back(sgpp::combigrid::FloatScalarVector(std::sin(static_cast<double>(i + j))));
+    }
+    others.push_back(sgpp::combigrid::FloatArrayVector(entries));
+  }
+
+  sgpp::combigrid::FloatArrayVector bulkSum = sgpp::combigrid::FloatArrayVector::zero();
+  bulkSum.addScaled(factors.data(), others.data(), others.size());
+  sgpp::combigrid::FloatArrayVector elementwiseSum = sgpp::combigrid::FloatArrayVector::zero();
+  for (size_t i = 0; i < others.size(); i++) {
+    elementwiseSum.addScaled(factors[i], others[i]);
+  }
+
+  BOOST_CHECK_EQUAL(bulkSum.size(), elementwiseSum.size());
+  for (size_t j = 0; j < bulkSum.size(); j++) {
+    BOOST_CHECK_SMALL(bulkSum[j].value() - elementwiseSum[j].value(), 1e-14);
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
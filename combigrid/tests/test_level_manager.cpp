@@ -36,10 +36,13 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <cmath>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 #include <iomanip>
@@ -142,6 +145,91 @@ BOOST_AUTO_TEST_CASE(testLevelManagerParallel) {
   //           << "\n";
 }
 
+BOOST_AUTO_TEST_CASE(testLevelManagerAdaptiveParallelCompletesLevels) {
+  size_t numDims = 3;
+  size_t maxNumPoints = 150;
+  std::atomic<size_t> numEvaluations(0);
+  sgpp::combigrid::MultiFunction func([&numEvaluations](DataVector const &x) {
+    ++numEvaluations;
+    // an expensive model with varying run time
+    std::this_thread::sleep_for(std::chrono::microseconds(100 * (1 + numEvaluations % 5)));
+    return std::exp(x[0] + 0.5 * x[1] * x[2]);
+  });
+  auto op = sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(
+      numDims, func);
+
+  DataVector x(std::vector<double>{0.3, 0.6, 0.8});
+  op->setParameters(x);
+  auto levelManager = std::make_shared<AveragingLevelManager>();
+  op->setLevelManager(levelManager);
+  levelManager->addLevelsAdaptiveParallel(maxNumPoints, 4);
+
+  // started levels are completed, so no function evaluation is lost
+  BOOST_CHECK_LE(op->getUpperPointBound(), maxNumPoints);
+  BOOST_CHECK_EQUAL(op->getUpperPointBound(), op->numGridPoints());
+  BOOST_CHECK_EQUAL(numEvaluations, op->numGridPoints());
+  BOOST_CHECK_SMALL(op->getResult() - std::exp(x[0] + 0.5 * x[1] * x[2]), 1e-4);
+}
+
+/**
+ * Averaging level manager that only knows the levels with |l|_1 <= maxLevelSum, so the adaptive
+ * algorithms run out of candidate levels.
+ */
+class BoundedLevelManager : public AveragingLevelManager {
+ public:
+  explicit BoundedLevelManager(size_t maxLevelSum) : maxLevelSum(maxLevelSum) {}
+
+ protected:
+  std::vector<sgpp::combigrid::MultiIndex> getSuccessors(
+      sgpp::combigrid::MultiIndex const &level) override {
+    std::vector<sgpp::combigrid::MultiIndex> result;
+
+    for (auto &succLevel : AveragingLevelManager::getSuccessors(level)) {
+      size_t levelSum = 0;
+
+      for (size_t l : succLevel) {
+        levelSum += l;
+      }
+
+      if (levelSum <= maxLevelSum) {
+        result.push_back(succLevel);
+      }
+    }
+
+    return result;
+  }
+
+  size_t maxLevelSum;
+};
+
+BOOST_AUTO_TEST_CASE(testLevelManagerAdaptiveParallelRunsOutOfLevels) {
+  // the point bound is never reached, the threads have to terminate once the queue is empty
+  size_t numDims = 2;
+  size_t maxLevelSum = 3;
+  std::atomic<size_t> numEvaluations(0);
+  sgpp::combigrid::MultiFunction func([&numEvaluations](DataVector const &x) {
+    ++numEvaluations;
+    return std::exp(x[0] + 0.5 * x[1]);
+  });
+  auto op = sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(
+      numDims, func);
+  auto regularOp =
+      sgpp::combigrid::CombigridOperation::createExpClenshawCurtisPolynomialInterpolation(
+          numDims, func);
+
+  DataVector x(std::vector<double>{0.3, 0.6});
+  op->setParameters(x);
+  auto levelManager = std::make_shared<BoundedLevelManager>(maxLevelSum);
+  op->setLevelManager(levelManager);
+  levelManager->addLevelsAdaptiveParallel(1000000, 4);
+
+  // exactly the levels of the regular grid have been added
+  double regularResult = regularOp->evaluate(maxLevelSum, x);
+  BOOST_CHECK_EQUAL(op->numGridPoints(), regularOp->numGridPoints());
+  BOOST_CHECK_EQUAL(numEvaluations, 2 * op->numGridPoints());
+  BOOST_CHECK_SMALL(op->getResult() - regularResult, 1e-12);
+}
+
 BOOST_AUTO_TEST_CASE(testLevelManagerAdaptive) {
   size_t numDims = 6;
   sgpp::combigrid::Genz model;
@@ -8,10 +8,12 @@
 
 #include <sgpp/combigrid/operation/onedim/PolynomialQuadratureEvaluator.hpp>
 #include <sgpp/combigrid/operation/CombigridTensorOperation.hpp>
+#include <sgpp/combigrid/functions/MonomialFunctionBasis1D.hpp>
 #include <sgpp/combigrid/functions/OrthogonalPolynomialBasis1D.hpp>
 #include <sgpp/combigrid/functions/ProbabilityDensityFunction1D.hpp>
 #include <sgpp/combigrid/pce/CombigridSurrogateModel.hpp>
 #include <sgpp/combigrid/pce/CombigridSurrogateModelFactory.hpp>
+#include <sgpp/combigrid/pce/PolynomialExpansionEvaluator.hpp>
 #include <sgpp/combigrid/utils/AnalyticModels.hpp>
 #include <sgpp/combigrid/operation/multidim/AveragingLevelManager.hpp>
 #include <sgpp/combigrid/definitions.hpp>
@@ -20,6 +22,10 @@
 
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
 #include <vector>
 
 #ifdef USE_DAKOTA
@@ -118,6 +124,70 @@ BOOST_AUTO_TEST_CASE(testPCE_parabola) {
   testPCEParbola(op, functionBases);
 }
 
+BOOST_AUTO_TEST_CASE(testPCEIncrementalSobolIndices) {
+  sgpp::combigrid::OrthogonalPolynomialBasis1DConfiguration basisConfig;
+  basisConfig.polyParameters.type_ = sgpp::combigrid::OrthogonalPolynomialBasisType::LEGENDRE;
+  auto functionBasis = std::make_shared<sgpp::combigrid::OrthogonalPolynomialBasis1D>(basisConfig);
+
+  sgpp::combigrid::Ishigami ishigamiModel;
+  sgpp::combigrid::MultiFunction func(ishigamiModel.eval);
+  auto op = sgpp::combigrid::CombigridOperation::createExpL2LejaPolynomialInterpolation(
+      ishigamiModel.numDims, func);
+
+  // the surrogate model keeps its tensor operation and is refined level by level
+  sgpp::combigrid::CombigridSurrogateModelConfiguration config;
+  config.type = sgpp::combigrid::CombigridSurrogateModelsType::POLYNOMIAL_CHAOS_EXPANSION;
+  config.loadFromCombigridOperation(op, false);
+  config.basisFunction = functionBasis;
+  config.tensorOperation =
+      sgpp::combigrid::CombigridTensorOperation::createOperationTensorPolynomialInterpolation(
+          config.pointHierarchies, config.storage, functionBasis);
+  auto pce = sgpp::combigrid::createCombigridSurrogateModel(config);
+
+  for (size_t level = 1; level <= 4; level++) {
+    op->getLevelManager()->addRegularLevels(level);
+    config.levelStructure = op->getLevelManager()->getLevelStructure();
+    pce->updateConfig(config);
+
+    // reference: a surrogate model computed from scratch
+    sgpp::combigrid::CombigridSurrogateModelConfiguration referenceConfig;
+    referenceConfig.type =
+        sgpp::combigrid::CombigridSurrogateModelsType::POLYNOMIAL_CHAOS_EXPANSION;
+    referenceConfig.loadFromCombigridOperation(op);
+    referenceConfig.basisFunction = functionBasis;
+    auto reference = sgpp::combigrid::createCombigridSurrogateModel(referenceConfig);
+
+    BOOST_CHECK_SMALL(std::abs(reference->variance() - pce->variance()), 1e-12);
+
+    sgpp::base::DataVector sobolIndices, referenceSobolIndices;
+    pce->getComponentSobolIndices(sobolIndices, false);
+    reference->getComponentSobolIndices(referenceSobolIndices, false);
+    BOOST_CHECK_EQUAL(sobolIndices.getSize(), referenceSobolIndices.getSize());
+    for (size_t i = 0; i < sobolIndices.getSize(); i++) {
+      BOOST_CHECK_SMALL(std::abs(referenceSobolIndices[i] - sobolIndices[i]), 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testOrthogonalPolynomialRecurrence) {
+  for (auto type : {sgpp::combigrid::OrthogonalPolynomialBasisType::LEGENDRE,
+                    sgpp::combigrid::OrthogonalPolynomialBasisType::HERMITE}) {
+    sgpp::combigrid::OrthogonalPolynomialBasis1DConfiguration config;
+    config.polyParameters.type_ = type;
+    sgpp::combigrid::OrthogonalPolynomialBasis1D basis(config);
+
+    sgpp::base::DataVector values;
+    for (double x : {0.0, 0.13, 0.5, 0.77, 1.0}) {
+      basis.evaluateUpTo(12, x, values);
+      BOOST_CHECK_EQUAL(values.getSize(), 13);
+      for (size_t i = 0; i < values.getSize(); i++) {
+        double reference = basis.evaluate(i, x);
+        BOOST_CHECK_SMALL(values[i] - reference, 1e-10 * std::max(1.0, std::abs(reference)));
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 // ----------------------------------------------------------------------
@@ -359,3 +429,63 @@ BOOST_AUTO_TEST_CASE(testMoments) {
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
+
+BOOST_AUTO_TEST_SUITE(testPolynomialExpansionEvaluator)
+
+BOOST_AUTO_TEST_CASE(testPolynomialExpansionEvaluatorMonomials) {
+  const size_t numDims = 3;
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+
+  // random coefficients for all multi-indices with total degree <= 4
+  sgpp::combigrid::FloatTensorVector coefficients(numDims);
+  for (size_t i = 0; i <= 4; i++) {
+    for (size_t j = 0; i + j <= 4; j++) {
+      for (size_t k = 0; i + j + k <= 4; k++) {
+        coefficients.getValues()->set(
+            sgpp::combigrid::MultiIndex{i, j, k},
+            sgpp::combigrid::FloatScalarVector(distribution(generator) - 0.5));
+      }
+    }
+  }
+
+  auto monomials = std::make_shared<sgpp::combigrid::MonomialFunctionBasis1D>();
+  sgpp::combigrid::PolynomialExpansionEvaluator evaluator(
+      coefficients,
+      std::vector<std::shared_ptr<sgpp::combigrid::AbstractInfiniteFunctionBasis1D>>(numDims,
+                                                                                      monomials));
+
+  // more samples than are tabulated at once, with an incomplete last block
+  const size_t numSamples = 5000;
+  sgpp::base::DataMatrix xs(numSamples, numDims);
+  for (size_t i = 0; i < xs.getSize(); i++) {
+    xs[i] = distribution(generator);
+  }
+
+  sgpp::base::DataVector results;
+  evaluator.eval(xs, results);
+  BOOST_CHECK_EQUAL(results.getSize(), numSamples);
+
+  sgpp::base::DataVector x(numDims);
+  for (size_t s = 0; s < numSamples; s++) {
+    double reference = 0.0;
+    for (auto it = coefficients.getValues()->getStoredDataIterator(); it->isValid();
+         it->moveToNext()) {
+      sgpp::combigrid::MultiIndex ix = it->getMultiIndex();
+      double term = it->value().value();
+      for (size_t k = 0; k < numDims; k++) {
+        term *= monomials->evaluate(ix[k], xs.get(s, k));
+      }
+      reference += term;
+    }
+
+    BOOST_CHECK_SMALL(results[s] - reference, 1e-12);
+
+    if (s % 1000 == 0) {
+      xs.getRow(s, x);
+      BOOST_CHECK_SMALL(evaluator.eval(x) - reference, 1e-12);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -16,6 +16,8 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <limits>
 #include <string>
@@ -92,6 +94,97 @@ BOOST_AUTO_TEST_CASE(testFunctionLookupTableSerialization) {
   BOOST_CHECK_EQUAL(func(vec), table2(vec));
 }
 
+BOOST_AUTO_TEST_CASE(testFunctionLookupTableCacheFile) {
+  std::string filename = "testFunctionLookupTableCacheFile.bin";
+  std::remove(filename.c_str());
+
+  auto func = testFunc1;
+  sgpp::base::DataVector vec(2);
+
+  {
+    FunctionLookupTable table((MultiFunction(func)));
+    BOOST_CHECK_EQUAL(table.attachCacheFile(filename), 0);
+
+    for (size_t i = 0; i < 10; ++i) {
+      vec[0] = static_cast<double>(i);
+      vec[1] = 0.1 * static_cast<double>(i);
+      BOOST_CHECK_EQUAL(func(vec), table(vec));
+    }
+  }
+
+  std::streamoff validSize = std::ifstream(filename, std::ios::binary | std::ios::ate).tellg();
+
+  // simulate a crash while the last entry was written
+  {
+    std::ofstream file(filename, std::ios::binary | std::ios::app);
+    file.write("\x02\x00\x00", 3);
+  }
+
+  // all values have to be restored from the file without evaluating the function
+  FunctionLookupTable table2(MultiFunction([](sgpp::base::DataVector const &x) { return -1.0; }));
+  BOOST_CHECK_EQUAL(table2.attachCacheFile(filename), 10);
+  BOOST_CHECK_EQUAL(table2.getNumEntries(), 10);
+
+  // the incomplete entry has been cut off
+  BOOST_CHECK_EQUAL(std::ifstream(filename, std::ios::binary | std::ios::ate).tellg(), validSize);
+
+  for (size_t i = 0; i < 10; ++i) {
+    vec[0] = static_cast<double>(i);
+    vec[1] = 0.1 * static_cast<double>(i);
+    BOOST_CHECK_EQUAL(func(vec), table2(vec));
+  }
+
+  // new values are appended behind the valid entries
+  vec[0] = 20.0;
+  BOOST_CHECK_EQUAL(table2(vec), -1.0);
+
+  FunctionLookupTable table3((MultiFunction(func)));
+  BOOST_CHECK_EQUAL(table3.attachCacheFile(filename), 11);
+  BOOST_CHECK_EQUAL(table3(vec), -1.0);
+
+  std::remove(filename.c_str());
+}
+
+BOOST_AUTO_TEST_CASE(testCombigridTreeStorageCacheFile) {
+  std::string filename = "testCombigridTreeStorageCacheFile.bin";
+  std::remove(filename.c_str());
+
+  std::vector<std::shared_ptr<AbstractPointHierarchy>> hierarchies(
+      2, std::make_shared<NonNestedPointHierarchy>(
+             std::make_shared<ClenshawCurtisDistribution>(),
+             std::make_shared<ExponentialLevelorderPointOrdering>()));
+
+  MultiIndex level(2, 2);
+  MultiIndex bounds(2, 3);
+  std::vector<bool> orderingConfiguration(2, false);
+  std::vector<double> values;
+
+  {
+    CombigridTreeStorage storage(hierarchies, MultiFunction(testFunc1));
+    storage.attachCacheFile(filename);
+    MultiIndexIterator mIt(bounds);
+
+    for (auto it = storage.getGuidedIterator(level, mIt, orderingConfiguration); it->isValid();
+         it->moveToNext()) {
+      values.push_back(it->value());
+    }
+  }
+
+  CombigridTreeStorage otherStorage(hierarchies, MultiFunction(testFunc2));
+  BOOST_CHECK_EQUAL(otherStorage.attachCacheFile(filename), values.size());
+  BOOST_CHECK_EQUAL(otherStorage.getNumEntries(), values.size());
+  MultiIndexIterator otherMIt(bounds);
+  size_t i = 0;
+
+  for (auto it = otherStorage.getGuidedIterator(level, otherMIt, orderingConfiguration);
+       it->isValid(); it->moveToNext(), ++i) {
+    BOOST_CHECK_EQUAL(it->value(), values[i]);
+  }
+
+  BOOST_CHECK_EQUAL(i, values.size());
+  std::remove(filename.c_str());
+}
+
 BOOST_AUTO_TEST_CASE(testCombigridTreeStorageSerialization) {
   std::vector<std::shared_ptr<AbstractPointHierarchy>> hierarchies(
       2, std::make_shared<NonNestedPointHierarchy>(
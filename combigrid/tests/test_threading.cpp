@@ -7,6 +7,7 @@
 #include <sgpp/combigrid/integration/MCIntegrator.hpp>
 #include <sgpp/combigrid/operation/CombigridMultiOperation.hpp>
 #include <sgpp/combigrid/operation/CombigridOperation.hpp>
+#include <sgpp/combigrid/storage/FunctionLookupTable.hpp>
 #include <sgpp/combigrid/storage/tree/CombigridTreeStorage.hpp>
 #include <sgpp/combigrid/threading/ThreadPool.hpp>
 #include <sgpp/combigrid/utils/Stopwatch.hpp>
@@ -14,12 +15,15 @@
 #include <sgpp/globaldef.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <memory>
 #include <vector>
 
 using sgpp::base::DataVector;
+using sgpp::combigrid::FunctionLookupTable;
+using sgpp::combigrid::MultiFunction;
 using sgpp::combigrid::ThreadPool;
 
 int counter = 0;
@@ -83,3 +87,39 @@ BOOST_AUTO_TEST_CASE(testThreadingWithCallback) {
 
   checkCorrectness();
 }
+
+BOOST_AUTO_TEST_CASE(testFunctionLookupTableThreading) {
+  std::atomic<int> numEvaluations(0);
+  FunctionLookupTable table(MultiFunction([&numEvaluations](DataVector const &x) {
+    ++numEvaluations;
+    return x[0] * x[0] + x[1];
+  }));
+
+  // all threads evaluate the same points, only the first access may compute a value
+  auto tp = std::make_shared<ThreadPool>(4);
+  std::atomic<int> numWrong(0);
+
+  for (int t = 0; t < 8; ++t) {
+    tp->addTask(ThreadPool::Task([&table, &numWrong]() {
+      DataVector x(2);
+
+      for (int i = 0; i < 500; ++i) {
+        x[0] = static_cast<double>(i);
+        x[1] = 0.5;
+
+        if (table.evalThreadsafe(x) != x[0] * x[0] + x[1]) {
+          ++numWrong;
+        }
+      }
+    }));
+  }
+
+  // without idle callback, the threads terminate once all tasks are done
+  tp->start();
+  tp->join();
+
+  BOOST_CHECK_EQUAL(numWrong, 0);
+  BOOST_CHECK_EQUAL(table.getNumEntries(), 500);
+  BOOST_CHECK_GE(numEvaluations, 500);
+  BOOST_CHECK_LE(numEvaluations, 8 * 500);
+}
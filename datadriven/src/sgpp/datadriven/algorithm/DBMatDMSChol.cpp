@@ -17,8 +17,11 @@
 #endif /* USE_GSL */
 
 #include <math.h>
+#include <algorithm>
+#include <cmath>
 #include <ctime>
 #include <iostream>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -267,24 +270,190 @@ void DBMatDMSChol::choleskyDowndate(sgpp::base::DataMatrix& decompMatrix,
 #endif /* USE_GSL */
 }
 
+void DBMatDMSChol::choleskyBlockUpdate(sgpp::base::DataMatrix& decompMatrix,
+                                       const sgpp::base::DataMatrix& update, bool downdate,
+                                       size_t blockSize) const {
+  const size_t size = decompMatrix.getNrows();
+
+  if (decompMatrix.getNcols() != size || update.getNrows() != size) {
+    throw sgpp::base::data_exception(
+        "choleskyBlockUpdate::Size of DecomposedMatrix and update matrix don´t "
+        "match...");
+  }
+
+  const size_t nb = std::max<size_t>(blockSize, 1);
+  const size_t rank = update.getNcols();
+  double* L = decompMatrix.getPointer();
+
+  for (size_t chunkStart = 0; chunkStart < rank; chunkStart += nb) {
+    const size_t kc = std::min(nb, rank - chunkStart);
+
+    // working copy of the current update vectors (row major, size x kc)
+    std::vector<double> W(size * kc);
+    size_t firstRow = size;
+
+    for (size_t i = 0; i < size; i++) {
+      for (size_t l = 0; l < kc; l++) {
+        W[i * kc + l] = update.get(i, chunkStart + l);
+
+        if (W[i * kc + l] != 0.0 && firstRow == size) {
+          firstRow = i;
+        }
+      }
+    }
+
+    // rows above the first nonzero entry of W are not modified
+    for (size_t panelStart = firstRow; panelStart < size; panelStart += nb) {
+      const size_t b = std::min(nb, size - panelStart);
+      const size_t w = b + kc;
+
+      // panel [L(J, J) W(J, :)] and the accumulated transformation Q
+      std::vector<double> P(b * w, 0.0);
+      std::vector<double> Q(w * w, 0.0);
+
+      for (size_t r = 0; r < b; r++) {
+        for (size_t c = 0; c <= r; c++) {
+          P[r * w + c] = L[(panelStart + r) * size + panelStart + c];
+        }
+
+        for (size_t l = 0; l < kc; l++) {
+          P[r * w + b + l] = W[(panelStart + r) * kc + l];
+        }
+      }
+
+      for (size_t i = 0; i < w; i++) {
+        Q[i * w + i] = 1.0;
+      }
+
+      bool identity = true;
+
+      // eliminate W(J, :) row by row into the diagonal of L(J, J)
+      for (size_t i = 0; i < b; i++) {
+        for (size_t l = b; l < w; l++) {
+          const double y = P[i * w + l];
+
+          if (y == 0.0) {
+            continue;
+          }
+
+          identity = false;
+          const double x = P[i * w + i];
+          double a, s, t;
+
+          if (!downdate) {
+            // Givens rotation: col_i = c col_i + s col_l, col_l = -s col_i + c col_l
+            const double r = std::hypot(x, y);
+            a = x / r;
+            s = y / r;
+            t = -s;
+          } else {
+            // hyperbolic rotation, keeps col_i col_i' - col_l col_l' invariant
+            if (std::fabs(y) >= x) {
+              throw sgpp::base::data_exception(
+                  "choleskyBlockUpdate::Matrix not numerical positive definite");
+            }
+
+            const double tau = y / x;
+            const double scale = 1.0 / std::sqrt((1.0 - tau) * (1.0 + tau));
+            a = scale;
+            s = -tau * scale;
+            t = -tau * scale;
+          }
+
+          for (size_t r = i; r < b; r++) {
+            const double u = P[r * w + i];
+            const double v = P[r * w + l];
+            P[r * w + i] = a * u + s * v;
+            P[r * w + l] = t * u + a * v;
+          }
+
+          for (size_t r = 0; r < w; r++) {
+            const double u = Q[r * w + i];
+            const double v = Q[r * w + l];
+            Q[r * w + i] = a * u + s * v;
+            Q[r * w + l] = t * u + a * v;
+          }
+
+          P[i * w + l] = 0.0;
+        }
+
+        if (P[i * w + i] <= 0.0) {
+          throw sgpp::base::data_exception(
+              "choleskyBlockUpdate::Matrix not numerical positive definite");
+        }
+      }
+
+      if (identity) {
+        continue;
+      }
+
+      for (size_t r = 0; r < b; r++) {
+        for (size_t c = 0; c <= r; c++) {
+          L[(panelStart + r) * size + panelStart + c] = P[r * w + c];
+        }
+
+        for (size_t l = 0; l < kc; l++) {
+          W[(panelStart + r) * kc + l] = P[r * w + b + l];
+        }
+      }
+
+      // [L(I, J) W(I, :)] = [L(I, J) W(I, :)] * Q for all rows I below the panel
+#pragma omp parallel
+      {
+        std::vector<double> row(w);
+        std::vector<double> result(w);
+
+#pragma omp for schedule(static)
+        for (size_t r = panelStart + b; r < size; r++) {
+          double* rowL = L + r * size + panelStart;
+          double* rowW = W.data() + r * kc;
+
+          std::copy(rowL, rowL + b, row.begin());
+          std::copy(rowW, rowW + kc, row.begin() + b);
+          std::fill(result.begin(), result.end(), 0.0);
+
+          for (size_t j = 0; j < w; j++) {
+            const double value = row[j];
+
+            if (value == 0.0) {
+              continue;
+            }
+
+            const double* rowQ = Q.data() + j * w;
+
+#pragma omp simd
+            for (size_t c = 0; c < w; c++) {
+              result[c] += value * rowQ[c];
+            }
+          }
+
+          std::copy(result.begin(), result.begin() + b, rowL);
+          std::copy(result.begin() + b, result.end(), rowW);
+        }
+      }
+    }
+  }
+}
+
 void DBMatDMSChol::choleskyUpdateLambda(sgpp::base::DataMatrix& decompMatrix,
                                         double lambda_up) const {
   size_t size = decompMatrix.getNcols();
+  const size_t blockSize = 64;
 
-  sgpp::base::DataVector lambdaModification(size, 0.0);
-  // In case lambda is increased apply Cholesky rank one updates
-  if (lambda_up > 0) {
-    for (size_t i = 0; i < size; i++) {
-      lambdaModification.set(i, sqrt(lambda_up));
-      choleskyUpdate(decompMatrix, lambdaModification, true);
-      lambdaModification.setAll(0.0);
-    }
-  } else if (lambda_up < 0) {
-    // In case lambda is decreased apply Cholesky rank one downdates
-    for (size_t i = 0; i < size; i++) {
-      lambdaModification.set(i, sqrt(fabs(lambda_up)));
-      choleskyDowndate(decompMatrix, lambdaModification, true);
-      lambdaModification.setAll(0.0);
+  // lambda * I = WW' with W = sqrt(|lambda|) * I, the columns of W are applied blockwise
+  const double value = sqrt(fabs(lambda_up));
+
+  if (lambda_up != 0) {
+    for (size_t j = 0; j < size; j += blockSize) {
+      const size_t numColumns = std::min(blockSize, size - j);
+      sgpp::base::DataMatrix lambdaModification(size, numColumns, 0.0);
+
+      for (size_t l = 0; l < numColumns; l++) {
+        lambdaModification.set(j + l, l, value);
+      }
+
+      // In case lambda is increased apply Cholesky updates, otherwise downdates
+      choleskyBlockUpdate(decompMatrix, lambdaModification, lambda_up < 0, blockSize);
     }
   }
 }
@@ -70,6 +70,24 @@ class DBMatDMSChol : public DBMatDecompMatrixSolver {
   void choleskyDowndate(sgpp::base::DataMatrix& decompMatrix,
                         const sgpp::base::DataVector& downdate, bool do_cv = false) const;
 
+  /**
+   * Performe a blocked rank k cholesky update (LL' + WW') or downdate (LL' - WW').
+   * The columns of W are processed in chunks of blockSize columns. For each chunk, the factor is
+   * traversed in panels of blockSize rows: the rotations (hyperbolic rotations for downdates)
+   * that eliminate the panel rows of W are accumulated into a small dense transformation, which
+   * is then applied to all rows below the panel at once as a parallel matrix-matrix product.
+   * Leading rows in which W vanishes are skipped.
+   *
+   * @param decompMatrix the LL' lower triangular cholesky factor
+   * @param update the matrix W of the k update vectors (one vector per column)
+   * @param downdate perform a downdate instead of an update
+   * @param blockSize number of rows per panel and maximum number of simultaneously processed
+   * update vectors
+   */
+  void choleskyBlockUpdate(sgpp::base::DataMatrix& decompMatrix,
+                           const sgpp::base::DataMatrix& update, bool downdate = false,
+                           size_t blockSize = 64) const;
+
  protected:
   /**
    * Update the decomposition if the regularization parameter changes. This may be more expensive
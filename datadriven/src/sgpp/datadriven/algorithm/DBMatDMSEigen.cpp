@@ -7,14 +7,15 @@
 
 #include <sgpp/datadriven/algorithm/DBMatDMSEigen.hpp>
 
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_matrix_double.h>
+#include <sgpp/datadriven/algorithm/DenseLinearAlgebra.hpp>
 
 #include <iostream>
 
 namespace sgpp {
 namespace datadriven {
 
+using sgpp::base::DataVector;
+
 DBMatDMSEigen::DBMatDMSEigen() {}
 
 DBMatDMSEigen::~DBMatDMSEigen() {}
@@ -24,28 +25,22 @@ void DBMatDMSEigen::solve(sgpp::base::DataMatrix& eigenVectors,
                           sgpp::base::DataVector& alpha,
                           sgpp::base::DataVector& rhs, double lambda) {
   size_t n = eigenVectors.getNcols();
-  // Create a matrix view for the eigenvectors
-  gsl_matrix_view q = gsl_matrix_view_array(eigenVectors.getPointer(), n, n);
-  // Create a vector view for the right hand side
-  gsl_vector_view b = gsl_vector_view_array(rhs.getPointer(), n);
-  // Create a vector view for the eigenvalues
-  gsl_vector_view e = gsl_vector_view_array(eigenValues.getPointer(), n);
-  gsl_vector* res = gsl_vector_alloc(n);
+  // the eigenvectors are stored in the leading n rows of the matrix
+  DataVector res(n);
 
   // Compute Q^T * b
-  gsl_blas_dgemv(CblasTrans, 1., &q.matrix, &b.vector, 0., res);
+  DenseLinearAlgebra::gemv(true, 1., eigenVectors.getPointer(), n, n, rhs.getPointer(), 0.,
+                           res.getPointer());
 
   // Compute D^(-1) * Q^T * b (with D = E + lambda * I)
   for (size_t i = 0; i < n; i++) {
-    gsl_vector_set(&e.vector, i, 1 / (gsl_vector_get(&e.vector, i) + lambda));
+    eigenValues[i] = 1 / (eigenValues[i] + lambda);
+    res[i] *= eigenValues[i];
   }
-  gsl_vector_mul(res, &e.vector);
-
-  gsl_vector_view alphaView = gsl_vector_view_array(alpha.getPointer(), n);
 
   // Compute Q * D^(-1) * Q^T * b
-  gsl_blas_dgemv(CblasNoTrans, 1., &q.matrix, res, 0., &alphaView.vector);
-  gsl_vector_free(res);
+  DenseLinearAlgebra::gemv(false, 1., eigenVectors.getPointer(), n, n, res.getPointer(), 0.,
+                           alpha.getPointer());
 }
 
 }  // namespace datadriven
@@ -5,15 +5,8 @@
 
 #include <sgpp/datadriven/algorithm/DBMatDMS_SMW.hpp>
 
-#ifdef USE_GSL
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_math.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_vector.h>
-#endif /* USE_GSL */
-
 #include <sgpp/base/exception/algorithm_exception.hpp>
+#include <sgpp/datadriven/algorithm/DenseLinearAlgebra.hpp>
 
 #include <iostream>
 
@@ -22,7 +15,6 @@ namespace datadriven {
 
 void DBMatDMS_SMW::solve(sgpp::base::DataMatrix& A_inv, sgpp::base::DataMatrix& B,
                                sgpp::base::DataVector& b, sgpp::base::DataVector& alpha) {
-#ifdef USE_GSL
   // assert dimensions
   bool prior_refined = (B.getNcols() > 1);  // if B.getNcols <= 1, then no refining yet
 
@@ -36,28 +28,15 @@ void DBMatDMS_SMW::solve(sgpp::base::DataMatrix& A_inv, sgpp::base::DataMatrix&
           "In DBMatDMS_SWM::solve: Matrix B and vector alpha don't match for mult.");
     }
   }
-  gsl_matrix_view A_inv_view =
-      gsl_matrix_view_array(A_inv.getPointer(), A_inv.getNrows(), A_inv.getNcols());
-
-  // here, b and alpha have to be adjusted to size of A_inv, to ignore 0 rows and columns
-  gsl_vector_view b_cut_view = gsl_vector_view_array(b.getPointer(), A_inv.getNcols());
-  gsl_vector_view alpha_cut_view = gsl_vector_view_array(alpha.getPointer(), A_inv.getNcols());
 
   // alpha = A^-1 * b
-  gsl_blas_dgemv(CblasNoTrans, 1.0, &A_inv_view.matrix, &b_cut_view.vector, 0.0,
-                 &alpha_cut_view.vector);
+  // here, b and alpha are cut to the size of A_inv, to ignore 0 rows and columns
+  DenseLinearAlgebra::gemv(false, 1.0, A_inv, b, 0.0, alpha);
 
   if (A_inv.getNcols() < B.getNcols()) {
-    gsl_matrix_view B_view = gsl_matrix_view_array(B.getPointer(), B.getNrows(), B.getNcols());
-    gsl_vector_view b_view = gsl_vector_view_array(b.getPointer(), B.getNcols());
-    gsl_vector_view alpha_view = gsl_vector_view_array(alpha.getPointer(), B.getNcols());
-
     // alpha = alpha + B*b
-    gsl_blas_dgemv(CblasNoTrans, 1.0, &B_view.matrix, &b_view.vector, 1.0, &alpha_view.vector);
+    DenseLinearAlgebra::gemv(false, 1.0, B, b, 1.0, alpha);
   }
-#else
-  throw sgpp::base::algorithm_exception("USE_GSL not set");
-#endif /* USE_GSL */
 }
 
 void DBMatDMS_SMW::solveParallel(DataMatrixDistributed& T_inv, DataMatrixDistributed& Q,
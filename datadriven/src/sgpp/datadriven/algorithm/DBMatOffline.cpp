@@ -46,7 +46,11 @@ using sgpp::base::OperationMatrix;
 using sgpp::base::RegularGridConfiguration;
 
 DBMatOffline::DBMatOffline()
-    : lhsMatrix(), isConstructed(false), isDecomposed(false), lhsInverse() {
+    : lhsMatrix(),
+      isConstructed(false),
+      isDecomposed(false),
+      isDistributed(false),
+      lhsInverse() {
   interactions = std::vector<std::vector<size_t>>();
 }
 
@@ -54,7 +58,9 @@ DBMatOffline::DBMatOffline(const DBMatOffline& rhs)
     : lhsMatrix(rhs.lhsMatrix),
       isConstructed(rhs.isConstructed),
       isDecomposed(rhs.isDecomposed),
+      isDistributed(rhs.isDistributed),
       lhsInverse(rhs.lhsInverse),
+      lhsDistributed(rhs.lhsDistributed),
       interactions(rhs.interactions) {}
 
 DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs) {
@@ -64,13 +70,19 @@ DBMatOffline& sgpp::datadriven::DBMatOffline::operator=(const DBMatOffline& rhs)
   lhsMatrix = rhs.lhsMatrix;
   isConstructed = rhs.isConstructed;
   isDecomposed = rhs.isDecomposed;
+  isDistributed = rhs.isDistributed;
   lhsInverse = rhs.lhsInverse;
+  lhsDistributed = rhs.lhsDistributed;
   interactions = rhs.interactions;
   return *this;
 }
 
 DBMatOffline::DBMatOffline(const std::string& filepath)
-    : lhsMatrix(), isConstructed(true), isDecomposed(true), lhsInverse() {
+    : lhsMatrix(),
+      isConstructed(true),
+      isDecomposed(true),
+      isDistributed(false),
+      lhsInverse() {
   // Parse the interactions
   parseInter(filepath, interactions);
 
@@ -79,12 +91,23 @@ DBMatOffline::DBMatOffline(const std::string& filepath)
 
 DataMatrix& DBMatOffline::getDecomposedMatrix() {
   if (isDecomposed) {
+    if (isDistributed) {
+      gatherDistributedDecomposition();
+    }
     return lhsMatrix;
   } else {
     throw data_exception("Matrix was not decomposed yet");
   }
 }
 
+size_t DBMatOffline::getDecomposedMatrixColumns() {
+  if (isDecomposed) {
+    return isDistributed ? lhsDistributed.getGlobalCols() : lhsMatrix.getNcols();
+  } else {
+    throw data_exception("Matrix was not decomposed yet");
+  }
+}
+
 DataMatrix& DBMatOffline::getInverseMatrix() { return this->lhsInverse; }
 
 DataMatrixDistributed& DBMatOffline::getDecomposedMatrixDistributed() {
@@ -102,7 +125,9 @@ DataMatrixDistributed& DBMatOffline::getDecomposedMatrixDistributed() {
 void DBMatOffline::syncDistributedDecomposition(std::shared_ptr<BlacsProcessGrid> processGrid,
                                                 const ParallelConfiguration& parallelConfig) {
 #ifdef USE_SCALAPACK
-  if (isDecomposed) {
+  if (isDistributed) {
+    // the distributed decomposition is the only one, nothing to synchronize
+  } else if (isDecomposed) {
     lhsDistributed = DataMatrixDistributed::fromSharedData(
         lhsMatrix.data(), processGrid, lhsMatrix.getNrows(), lhsMatrix.getNcols(),
         parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
@@ -113,6 +138,14 @@ void DBMatOffline::syncDistributedDecomposition(std::shared_ptr<BlacsProcessGrid
   // no action needed without scalapack
 }
 
+void DBMatOffline::decomposeMatrixParallel(RegularizationConfiguration& regularizationConfig,
+                                           DensityEstimationConfiguration& densityEstimationConfig,
+                                           std::shared_ptr<BlacsProcessGrid> processGrid,
+                                           const ParallelConfiguration& parallelConfig) {
+  decomposeMatrix(regularizationConfig, densityEstimationConfig);
+  syncDistributedDecomposition(processGrid, parallelConfig);
+}
+
 void DBMatOffline::buildMatrix(Grid* grid, RegularizationConfiguration& regularizationConfig) {
   if (isConstructed) {  // Already constructed, do nothing
     return;
@@ -132,12 +165,106 @@ void DBMatOffline::buildMatrix(Grid* grid, RegularizationConfiguration& regulari
   isConstructed = true;
 }
 
+void DBMatOffline::buildMatrixParallel(Grid* grid,
+                                       RegularizationConfiguration& regularizationConfig,
+                                       std::shared_ptr<BlacsProcessGrid> processGrid,
+                                       const ParallelConfiguration& parallelConfig) {
+  buildMatrix(grid, regularizationConfig);
+}
+
+void DBMatOffline::buildMatrixDistributed(Grid* grid, std::shared_ptr<BlacsProcessGrid> processGrid,
+                                          size_t rowBlockSize, size_t columnBlockSize,
+                                          double diagonal) {
+#ifdef USE_SCALAPACK
+  if (isConstructed) {  // Already constructed, do nothing
+    return;
+  }
+  // check if grid was created
+  if (grid == nullptr) {
+    throw algorithm_exception("DBMatOffline: grid was not initialized");
+  }
+
+  size_t size = grid->getStorage().getSize();
+
+  if (grid->getType() != GridType::Linear) {
+    // no blockwise assembly of the L2 products, build the matrix locally and distribute it
+    lhsMatrix = DataMatrix(size, size);
+    std::unique_ptr<OperationMatrix> op(
+        op_factory::createOperationLTwoDotExplicit(&lhsMatrix, *grid));
+    for (size_t i = 0; i < size; i++) {
+      lhsMatrix.set(i, i, lhsMatrix.get(i, i) + diagonal);
+    }
+    isConstructed = true;
+    distributeMatrix(processGrid, rowBlockSize, columnBlockSize);
+    return;
+  }
+
+  lhsDistributed =
+      DataMatrixDistributed(processGrid, size, size, rowBlockSize, columnBlockSize);
+  size_t localRows = lhsDistributed.getLocalRows();
+  size_t localColumns = lhsDistributed.getLocalColumns();
+  double* localData = lhsDistributed.getLocalPointer();
+
+  // each local row block is a contiguous block of global rows, it is built for all columns at
+  // once and the local columns are copied into the (row major) local matrix
+  sgpp::pde::OperationMatrixLTwoDotExplicitLinear opLTwo;
+  for (size_t localRow = 0; localRow < localRows; localRow += rowBlockSize) {
+    size_t blockRows = std::min(rowBlockSize, localRows - localRow);
+    size_t rowStart = lhsDistributed.localToGlobalRowIndex(localRow);
+
+    DataMatrix rowBlock(blockRows, size);
+    opLTwo.buildMatrixWithBounds(&rowBlock, grid, rowStart, rowStart + blockRows, 0, size);
+
+    for (size_t i = 0; i < blockRows; i++) {
+      rowBlock.set(i, rowStart + i, rowBlock.get(i, rowStart + i) + diagonal);
+      double* localRowData = localData + (localRow + i) * localColumns;
+      for (size_t localColumn = 0; localColumn < localColumns; localColumn++) {
+        localRowData[localColumn] =
+            rowBlock.get(i, lhsDistributed.localToGlobalColumnIndex(localColumn));
+      }
+    }
+  }
+
+  isConstructed = true;
+  isDistributed = true;
+#else
+  throw sgpp::base::not_implemented_exception("Build without ScaLAPACK");
+#endif /* USE_SCALAPACK */
+}
+
+void DBMatOffline::distributeMatrix(std::shared_ptr<BlacsProcessGrid> processGrid,
+                                    size_t rowBlockSize, size_t columnBlockSize) {
+#ifdef USE_SCALAPACK
+  if (isDistributed) {
+    return;
+  }
+  lhsDistributed = DataMatrixDistributed::fromSharedData(lhsMatrix.data(), processGrid,
+                                                         lhsMatrix.getNrows(), lhsMatrix.getNcols(),
+                                                         rowBlockSize, columnBlockSize);
+  lhsMatrix = DataMatrix();
+  isDistributed = true;
+#else
+  throw sgpp::base::not_implemented_exception("Build without ScaLAPACK");
+#endif /* USE_SCALAPACK */
+}
+
+void DBMatOffline::gatherDistributedDecomposition() {
+#ifdef USE_SCALAPACK
+  if (isDistributed) {
+    lhsDistributed.toLocalDataMatrixBroadcast(lhsMatrix);
+    isDistributed = false;
+  }
+#endif /* USE_SCALAPACK */
+  // nothing is distributed without scalapack
+}
+
 void DBMatOffline::store(const std::string& fileName) {
 #ifdef USE_GSL
   if (!isDecomposed) {
     throw algorithm_exception("Matrix not decomposed yet");
     return;
   }
+  gatherDistributedDecomposition();
 
   // Write configuration
   std::ofstream outputFile(fileName, std::ofstream::out);
@@ -182,6 +309,7 @@ void DBMatOffline::compute_inverse() {
 
 void DBMatOffline::printMatrix() {
   if (isDecomposed) {
+    gatherDistributedDecomposition();
     std::cout << "Size: " << lhsMatrix.getNrows() << " , " << lhsMatrix.getNcols() << "\n"
               << lhsMatrix.toString();
   } else {
@@ -230,7 +358,9 @@ void sgpp::datadriven::DBMatOffline::parseInter(
   std::cout << interactions.size() << std::endl;
 }
 
-size_t DBMatOffline::getGridSize() { return lhsMatrix.getNrows(); }
+size_t DBMatOffline::getGridSize() {
+  return isDistributed ? lhsDistributed.getGlobalRows() : lhsMatrix.getNrows();
+}
 
 sgpp::base::DataMatrix& DBMatOffline::getLhsMatrix_ONLY_FOR_TESTING() { return this->lhsMatrix; }
 
@@ -86,11 +86,20 @@ class DBMatOffline {
 
   /**
    * Get a reference to the decomposed matrix. Throws if matrix has not yet been decomposed.
+   * If the decomposition is only stored distributed, it is gathered on every process first.
    *
    * @return decomposed matrix
    */
   DataMatrix& getDecomposedMatrix();
 
+  /**
+   * Returns the number of columns of the decomposed matrix without gathering a decomposition that
+   * is only stored distributed. Throws if matrix has not yet been decomposed.
+   *
+   * @return number of columns of the decomposed matrix
+   */
+  size_t getDecomposedMatrixColumns();
+
   /**
    * Get a reference to the inverse matrix
    *
@@ -127,6 +136,19 @@ class DBMatOffline {
    */
   virtual void buildMatrix(Grid* grid, RegularizationConfiguration& regularizationConfig);
 
+  /**
+   * Builds the lhs matrix like buildMatrix(), but for a decomposition on a BLACS process grid. The
+   * default implementation builds the matrix on each process, decomposition types that have a
+   * ScaLAPACK counterpart override this to assemble the distributed matrix directly.
+   * @param grid The grid object the matrix is based on
+   * @param regularizationConfig Configures the regularization which is incorporated into the lhs
+   * @param processGrid process grid to distribute the matrix on
+   * @param parallelConfig configuration of the block sizes
+   */
+  virtual void buildMatrixParallel(Grid* grid, RegularizationConfiguration& regularizationConfig,
+                                   std::shared_ptr<BlacsProcessGrid> processGrid,
+                                   const ParallelConfiguration& parallelConfig);
+
   /**
    * Decomposes the matrix according to the chosen decomposition type.
    * The number of rows of the stored result depends on the decomposition type.
@@ -136,6 +158,23 @@ class DBMatOffline {
   virtual void decomposeMatrix(RegularizationConfiguration& regularizationConfig,
                                DensityEstimationConfiguration& densityEstimationConfig) = 0;
 
+  /**
+   * Decomposes the matrix distributed on a BLACS process grid and stores the distributed
+   * decomposition, so that syncDistributedDecomposition() does not have to be called afterwards.
+   * An already decomposed matrix (e.g. loaded from a file) is only distributed.
+   * The default implementation decomposes the matrix on each process and distributes the result,
+   * decomposition types that have a ScaLAPACK counterpart override this and only keep the
+   * distributed decomposition, which is gathered on demand (e.g. for refinement or storing).
+   * @param regularizationConfig the regularization configuration
+   * @param densityEstimationConfig the density estimation configuration
+   * @param processGrid process grid to distribute the matrix on
+   * @param parallelConfig configuration of the block sizes
+   */
+  virtual void decomposeMatrixParallel(RegularizationConfiguration& regularizationConfig,
+                                       DensityEstimationConfiguration& densityEstimationConfig,
+                                       std::shared_ptr<BlacsProcessGrid> processGrid,
+                                       const ParallelConfiguration& parallelConfig);
+
   /**
    * Prints the matrix onto standard output
    */
@@ -178,11 +217,41 @@ class DBMatOffline {
   DataMatrix lhsMatrix;   // stores the (decomposed) matrix
   bool isConstructed;     // If the matrix was built
   bool isDecomposed;      // If the matrix was decomposed
+  bool isDistributed;     // If the (decomposed) matrix is only stored in lhsDistributed
   DataMatrix lhsInverse;  // stores the explicitly computed inverse (only in SMW case)
 
   // distributed lhs, only initialized in ScaLAPACK version
   DataMatrixDistributed lhsDistributed;
 
+  /**
+   * Assembles the L2 products of the grid plus diagonal times the identity directly into
+   * lhsDistributed, each process only computes its own rows. Grid types without a blockwise
+   * assembly are built on each process and distributed afterwards.
+   * @param grid The grid object the matrix is based on
+   * @param processGrid process grid to distribute the matrix on
+   * @param rowBlockSize row block size of the distributed matrix
+   * @param columnBlockSize column block size of the distributed matrix
+   * @param diagonal value added to the diagonal, e.g. the regularization parameter
+   */
+  void buildMatrixDistributed(Grid* grid, std::shared_ptr<BlacsProcessGrid> processGrid,
+                              size_t rowBlockSize, size_t columnBlockSize, double diagonal = 0.0);
+
+  /**
+   * Moves the local lhs matrix into lhsDistributed, afterwards only the distributed matrix is
+   * stored. Does nothing if the matrix is already distributed.
+   * @param processGrid process grid to distribute the matrix on
+   * @param rowBlockSize row block size of the distributed matrix
+   * @param columnBlockSize column block size of the distributed matrix
+   */
+  void distributeMatrix(std::shared_ptr<BlacsProcessGrid> processGrid, size_t rowBlockSize,
+                        size_t columnBlockSize);
+
+  /**
+   * Gathers a decomposition that is only stored distributed into lhsMatrix on every process.
+   * Override if the local layout of the decomposition differs from the distributed one.
+   */
+  virtual void gatherDistributedDecomposition();
+
  public:
   // vector of interactions (if size() == 0: a regular SG is created)
   std::vector<std::vector<size_t>> interactions;
@@ -14,21 +14,14 @@
 
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDMSChol.hpp>
-
-#ifdef USE_GSL
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_math.h>
-#include <gsl/gsl_matrix_double.h>
-#include <gsl/gsl_permutation.h>
-#include <gsl/gsl_permute.h>
-#endif /* USE_GSL */
+#include <sgpp/datadriven/algorithm/DenseLinearAlgebra.hpp>
 
 #include <algorithm>
 #include <chrono>
 #include <iomanip>
 #include <list>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -47,7 +40,6 @@ bool DBMatOfflineChol::isRefineable() { return true; }
 
 void DBMatOfflineChol::decomposeMatrix(RegularizationConfiguration& regularizationConfig,
                                        DensityEstimationConfiguration& densityEstimationConfig) {
-#ifdef USE_GSL
   if (isConstructed) {
     if (isDecomposed) {
       // Already decomposed => Do nothing
@@ -55,21 +47,9 @@ void DBMatOfflineChol::decomposeMatrix(RegularizationConfiguration& regularizati
     } else {
       auto begin = std::chrono::high_resolution_clock::now();
 
-      size_t n = lhsMatrix.getNrows();
-      gsl_matrix_view m = gsl_matrix_view_array(lhsMatrix.getPointer(), n,
-                                                n);  // Create GSL matrix view for decomposition
-
-      // Perform Cholesky decomposition
-      gsl_linalg_cholesky_decomp(&m.matrix);
+      // Perform Cholesky decomposition, only the lower triangular matrix is kept
+      DenseLinearAlgebra::choleskyDecomposition(lhsMatrix);
 
-      // Isolate lower triangular matrix
-      for (size_t i = 0; i < n; i++) {
-        for (size_t j = 0; j < n; j++) {
-          if (i < j) {
-            lhsMatrix.set(i, j, 0);
-          }
-        }
-      }
       isDecomposed = true;
       auto end = std::chrono::high_resolution_clock::now();
       std::cout << "Chol decomp took "
@@ -79,107 +59,104 @@ void DBMatOfflineChol::decomposeMatrix(RegularizationConfiguration& regularizati
   } else {
     throw algorithm_exception("Matrix has to be constructed before it can be decomposed");
   }
+}
+
+void DBMatOfflineChol::buildMatrixParallel(Grid* grid,
+                                           RegularizationConfiguration& regularizationConfig,
+                                           std::shared_ptr<BlacsProcessGrid> processGrid,
+                                           const ParallelConfiguration& parallelConfig) {
+#ifdef USE_SCALAPACK
+  if (getDecompositionType() == MatrixDecompositionType::Chol) {
+    buildMatrixDistributed(grid, regularizationConfig, processGrid, parallelConfig.rowBlockSize_,
+                           parallelConfig.columnBlockSize_);
+    return;
+  }
+#endif /* USE_SCALAPACK */
+  DBMatOffline::buildMatrixParallel(grid, regularizationConfig, processGrid, parallelConfig);
+}
+
+void DBMatOfflineChol::decomposeMatrixParallel(
+    RegularizationConfiguration& regularizationConfig,
+    DensityEstimationConfiguration& densityEstimationConfig,
+    std::shared_ptr<BlacsProcessGrid> processGrid, const ParallelConfiguration& parallelConfig) {
+#ifdef USE_SCALAPACK
+  if (getDecompositionType() != MatrixDecompositionType::Chol) {
+    // no ScaLAPACK counterpart, e.g. for the incomplete Cholesky decomposition
+    DBMatOffline::decomposeMatrixParallel(regularizationConfig, densityEstimationConfig,
+                                          processGrid, parallelConfig);
+    return;
+  }
+
+  if (!isConstructed) {
+    throw algorithm_exception("Matrix has to be constructed before it can be decomposed");
+  } else if (isDecomposed) {
+    syncDistributedDecomposition(processGrid, parallelConfig);
+    return;
+  }
+
+  auto begin = std::chrono::high_resolution_clock::now();
+
+  // Perform Cholesky decomposition on the process grid, only the distributed factor is kept
+  distributeMatrix(processGrid, parallelConfig.rowBlockSize_, parallelConfig.columnBlockSize_);
+  DataMatrixDistributed::choleskyDecomposition(lhsDistributed);
+
+  isDecomposed = true;
+  auto end = std::chrono::high_resolution_clock::now();
+  std::cout << "Parallel chol decomp took "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(end - begin).count() << "ms"
+            << std::endl;
 #else
-  throw algorithm_exception("built without GSL");
-#endif /*USE_GSL*/
+  DBMatOffline::decomposeMatrixParallel(regularizationConfig, densityEstimationConfig,
+                                        processGrid, parallelConfig);
+#endif /* USE_SCALAPACK */
+}
+
+void DBMatOfflineChol::gatherDistributedDecomposition() {
+  if (!isDistributed) {
+    return;
+  }
+  DBMatOffline::gatherDistributedDecomposition();
+
+  // isolate lower triangular matrix, pdpotrf did not reference the upper triangle
+  size_t n = lhsMatrix.getNrows();
+  double* data = lhsMatrix.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    std::fill(data + i * n + i + 1, data + (i + 1) * n, 0.0);
+  }
 }
 
 void DBMatOfflineChol::compute_inverse() {
-#ifdef USE_GSL
   if (!isDecomposed) {
     throw sgpp::base::algorithm_exception(
         "in DBMatOfflineChol::compute_inverse:\noffline matrix not decomposed yet.\n");
   }
-  // initialize lhsInverse
-  this->lhsInverse = DataMatrix(this->lhsMatrix.getNrows(), this->lhsMatrix.getNcols());
+  gatherDistributedDecomposition();
 
   // copy, in order to not mess with internal lhsMatrix of offlineChol object
-  this->lhsInverse.copyFrom(this->lhsMatrix);
-
-  // create matrix view in style of decomposition, see ::decomposeMatrix
-  gsl_matrix_view m =
-      gsl_matrix_view_array(lhsInverse.getPointer(), lhsInverse.getNrows(), lhsInverse.getNcols());
+  this->lhsInverse = DataMatrix(this->lhsMatrix);
 
   // inverts matrix, and stores it inplace, therefore in lhsInverse
-  gsl_linalg_cholesky_invert(&m.matrix);
-
-#else
-  throw algorithm_exception("build without GSL");
-#endif /*USE_GSL*/
+  DenseLinearAlgebra::choleskyInverse(this->lhsInverse);
 }
+
 void DBMatOfflineChol::choleskyModification(Grid& grid, datadriven::DensityEstimationConfiguration&,
                                             size_t newPoints, std::list<size_t> deletedPoints,
                                             double lambda) {
-#ifdef USE_GSL
+  if (!isDecomposed) {
+    throw algorithm_exception("Matrix was not decomposed, yet!");
+  }
+  // the modifications work on the local factor
+  gatherDistributedDecomposition();
 
   // Start coarsening
   // If list 'deletedPoints' is not empty, grid points got removed
   if (deletedPoints.size() > 0) {
-    size_t new_size = grid.getSize();
-    size_t old_size = new_size - newPoints + deletedPoints.size();
-
-    // 'c' is the threshold to decide what kind of Cholesky modification should
-    // be performed to take
-    // account for the removed grid points
-    double c = static_cast<double>(old_size) / 10;
-    // Indicates which permutation to perform
-    bool start1 = false;
-    size_t index_coarse = 0;
-
-    // If index of removed grid point <= c-> Permutation towards first
-    // row/column -> job = 1
-    size_t coarseCount_1 = 0;
-    // If index of removed grid point > c -> Permutation towards last row/column
-    // -> job = 2
-    size_t coarseCount_2 = 0;
-
-    for (std::list<size_t>::reverse_iterator it = deletedPoints.rbegin();
-         it != deletedPoints.rend(); it++) {
-      // Indicates current row/column to permute
-      index_coarse = *it + 1 + coarseCount_1;
-
-      if (static_cast<double>(index_coarse) > c && start1 == false) {
-        // Is accessed if index is larger than 'c'
-        choleskyPermutation(index_coarse, old_size - coarseCount_2, 2);
-        coarseCount_2++;
-      } else if (start1 == false) {
-        // Is accessed the first 'index_coarse' is less than 'c'
-        start1 = true;
-        // Delete last 'coarseCount_2' rows/columns of current Cholesky factor
-        lhsMatrix.resizeQuadratic(old_size - coarseCount_2);
-      }
-
-      if (start1 == true) {
-        // Is accessed if 'index_coarse' is less than 'c'
-        choleskyPermutation(1 + coarseCount_1, index_coarse, 1);
-        coarseCount_1++;
-      }
-    }
-
-    if (coarseCount_1 > 0) {
-      // If some indices have been less than 'c'
-      DataMatrix update_matrix(lhsMatrix.getNrows(), lhsMatrix.getNcols());
-      update_matrix.copyFrom(lhsMatrix);
-      // Resize copy of current Cholesky factor to
-      // receive a matrix of rank one update vectors
-      update_matrix.resizeToSubMatrix(coarseCount_1 + 1, 1, lhsMatrix.getNrows(), coarseCount_1);
-      // Resize current Cholesky factor to required submatrix
-      // for necessary rank one updates
-      lhsMatrix.resizeToSubMatrix(coarseCount_1 + 1, coarseCount_1 + 1, lhsMatrix.getNrows(),
-                                  lhsMatrix.getNrows());
-      DataVector temp_col(update_matrix.getNrows());
-
-      // 'coarseCount_1' many rank one updates based on the columns of
-      // 'update_matrix' are performed
-      DBMatDMSChol cholsolver;
-      for (size_t i = 0; i < coarseCount_1; i++) {
-        update_matrix.getColumn(i, temp_col);
-        cholsolver.choleskyUpdate(lhsMatrix, temp_col, false);
-      }
-    } else {
-      // If no indices have been less than 'c'
-      lhsMatrix.resizeQuadratic(old_size - coarseCount_2);
-    }
+    std::vector<size_t> deleted(deletedPoints.begin(), deletedPoints.end());
+    std::sort(deleted.begin(), deleted.end());
+    deleted.erase(std::unique(deleted.begin(), deleted.end()), deleted.end());
+    choleskyRemovePoints(deleted);
   }
 
   // Start refinement
@@ -197,172 +174,224 @@ void DBMatOfflineChol::choleskyModification(Grid& grid, datadriven::DensityEstim
       mat_refine.set(i, i - gridSize + newPoints, res + lambda);
     }
 
-    // std::cout << "mat_refine:\n" << mat_refine.toString() << "\n\n";
-
-    // Resize Cholesky factor to new 'gridSize' before 'choleskyAddPoint' is
-    // applied
-    // in order to save runtime
-    this->lhsMatrix.resizeQuadratic(gridSize);
-
-    // Now its time to call 'choleskyAddPoint''countNewGridPoints' often
-    DataVector temp_col = DataVector(gridSize);
-    for (size_t j = gridSize - newPoints; j < gridSize; j++) {
-      temp_col.resizeZero(gridSize);
-      mat_refine.getColumn(j - gridSize + newPoints, temp_col);
-      temp_col.resizeZero(j + 1);
-      choleskyAddPoint(temp_col, j);
-    }
+    // all new points are appended at once
+    choleskyAddPoints(mat_refine);
   }
-#else
-  throw algorithm_exception("built without GSL");
-#endif /*USE_GSL*/
 }
 
-void DBMatOfflineChol::choleskyAddPoint(DataVector& newCol, size_t size) {
-#ifdef USE_GSL
+void DBMatOfflineChol::choleskyRemovePoints(const std::vector<size_t>& deletedPoints) {
   if (!isDecomposed) {
     throw algorithm_exception("Matrix was not decomposed, yet!");
   }
 
-  DataMatrix& mat = lhsMatrix;
-  // Size of provided memory for Cholesky factor,
-  // because the allocations take place in 'choleskyModifications'
-  size_t size_full = mat.getNrows();
-  // Size of Cholesky factor after adding 'newCol'
-  size_t size_up = newCol.getSize();
+  size_t oldSize = lhsMatrix.getNrows();
 
-  if (size_up != (size + 1)) {
-    throw algorithm_exception(
-        "Size of update vector newCol needs to be 1 dim larger than the "
-        "underlying decomposed matrix!");
+  if (deletedPoints.empty()) {
+    return;
+  } else if (deletedPoints.back() >= oldSize || deletedPoints.size() > oldSize) {
+    throw algorithm_exception("Index of removed grid point is out of range");
   }
 
-  // Create GSL matrix view for update procedures
-  gsl_matrix_view m_full = gsl_matrix_view_array(mat.getPointer(), size_full, size_full);
-  // Access submatrx since mat_ has already expanded to save alocations
-  // procedures
-  gsl_matrix_view m = gsl_matrix_submatrix(&m_full.matrix, 0, 0, size, size);
+  size_t first = deletedPoints.front();
+  size_t newSize = oldSize - deletedPoints.size();
 
-  gsl_vector_view vvec = gsl_vector_view_array(newCol.getPointer(), size_up);
-  gsl_vector* wkvec_a = gsl_vector_calloc(size);
+  // remaining points behind the first removed one, in their original order
+  std::vector<size_t> kept;
+  kept.reserve(oldSize - first - deletedPoints.size());
 
-  // Extract newCol(0:size-1) = a
-  gsl_vector_view c = gsl_vector_subvector(&vvec.vector, 0, size);
+  for (size_t i = first, d = 0; i < oldSize; i++) {
+    if (d < deletedPoints.size() && deletedPoints[d] == i) {
+      d++;
+    } else {
+      kept.push_back(i);
+    }
+  }
 
-  // Solve system a = Lc
-  gsl_blas_dtrsv(CblasLower, CblasNoTrans, CblasNonUnit, &m.matrix, &c.vector);
-  gsl_blas_dcopy(&c.vector, wkvec_a);
+  size_t numKept = kept.size();
+  const double* L = lhsMatrix.getPointer();
+  DataMatrix result(newSize, newSize, 0.0);
+  double* R = result.getPointer();
+  DataMatrix trailing(numKept, numKept, 0.0);
+  // columns of the removed points in the remaining rows
+  DataMatrix update(numKept, deletedPoints.size());
+
+#pragma omp parallel for schedule(guided)
+  for (size_t i = 0; i < first; i++) {
+    std::copy(L + i * oldSize, L + i * oldSize + i + 1, R + i * newSize);
+  }
 
-  double phi;
-  gsl_blas_ddot(wkvec_a, &c.vector, &phi);
+#pragma omp parallel for schedule(guided)
+  for (size_t r = 0; r < numKept; r++) {
+    size_t row = kept[r];
+    std::copy(L + row * oldSize, L + row * oldSize + first, R + (first + r) * newSize);
 
-  // Compute d = sqrt(newCol[last] - phi)
-  double last = gsl_vector_get(&vvec.vector, size_up - 1);
-  phi = last - phi;
-  // Ensure 'phi' is larger 0
-  if (phi <= 0) {
-    throw algorithm_exception("Resulting matrix is at least not numerical positive definite!");
-  } else {
-    phi = sqrt(phi);
-  }
+    for (size_t c = 0; c <= r; c++) {
+      trailing.set(r, c, lhsMatrix.get(row, kept[c]));
+    }
 
-  // Modify Choleskyfactor m (L)
+    for (size_t d = 0; d < deletedPoints.size(); d++) {
+      update.set(r, d, lhsMatrix.get(row, deletedPoints[d]));
+    }
+  }
 
-  // DataVector full of zeros
-  DataVector zeros(size_full, 0.0);
+  // L'L'^T = L(kept, kept) L(kept, kept)^T + L(kept, deleted) L(kept, deleted)^T
+  DBMatDMSChol cholsolver;
+  cholsolver.choleskyBlockUpdate(trailing, update);
 
-  // Add 'newCol' and 'zeros' to current Cholesky factor 'lhsMatrix_'
-  mat.setColumn(size, zeros);
-  newCol.set(size_up - 1, phi);
-  newCol.resizeZero(size_full);
-  mat.setRow(size, newCol);
+#pragma omp parallel for schedule(guided)
+  for (size_t r = 0; r < numKept; r++) {
+    const double* rowTrailing = trailing.getPointer() + r * numKept;
+    std::copy(rowTrailing, rowTrailing + r + 1, R + (first + r) * newSize + first);
+  }
 
-  gsl_vector_free(wkvec_a);
-#else
-  throw algorithm_exception("built withot GSL");
-#endif /*USE_GSL*/
+  lhsMatrix = std::move(result);
 }
 
-void DBMatOfflineChol::choleskyPermutation(size_t k, size_t l, size_t job) {
-#ifdef USE_GSL
+void DBMatOfflineChol::choleskyAddPoints(const DataMatrix& newCols, size_t blockSize) {
   if (!isDecomposed) {
     throw algorithm_exception("Matrix was not decomposed, yet!");
   }
 
-  DataMatrix& mat = lhsMatrix;
-  size_t size = mat.getNrows();
+  // Size of Cholesky factor before and after adding the new points
+  size_t size = lhsMatrix.getNrows();
+  size_t newSize = newCols.getNrows();
+  size_t numNew = newCols.getNcols();
 
-  if (k > l) {
-    throw algorithm_exception("l needs to be larger than k");
-  } else if (l > size) {
-    throw algorithm_exception("l needs to be smaller than the column size of the matrix");
-  } else if (l == k) {
-    return;
+  if (newSize != size + numNew) {
+    throw algorithm_exception(
+        "Size of update vectors newCols needs to match the size of the underlying decomposed "
+        "matrix plus the number of new columns!");
+  }
+
+  size_t nb = std::max<size_t>(blockSize, 1);
+  lhsMatrix.resizeQuadratic(newSize);
+  double* L = lhsMatrix.getPointer();
+
+  // Solve L X = B, B = newCols(0:size-1, :), blockwise forward substitution
+  DataMatrix X(size, numNew);
+  double* x = X.getPointer();
+
+  for (size_t i = 0; i < size; i++) {
+    const double* rowB = newCols.getPointer() + i * numNew;
+    std::copy(rowB, rowB + numNew, x + i * numNew);
+  }
+
+  for (size_t blockStart = 0; blockStart < size; blockStart += nb) {
+    size_t blockEnd = std::min(blockStart + nb, size);
+
+    // X(J, :) -= L(J, 0:blockStart-1) X(0:blockStart-1, :)
+#pragma omp parallel for schedule(static)
+    for (size_t i = blockStart; i < blockEnd; i++) {
+      const double* rowL = L + i * newSize;
+      double* rowX = x + i * numNew;
+
+      for (size_t j = 0; j < blockStart; j++) {
+        const double value = rowL[j];
+
+        if (value == 0.0) {
+          continue;
+        }
+
+        const double* rowXj = x + j * numNew;
+
+#pragma omp simd
+        for (size_t l = 0; l < numNew; l++) {
+          rowX[l] -= value * rowXj[l];
+        }
+      }
+    }
+
+    // triangular solve with the diagonal block
+    for (size_t i = blockStart; i < blockEnd; i++) {
+      const double* rowL = L + i * newSize;
+      double* rowX = x + i * numNew;
+
+      for (size_t j = blockStart; j < i; j++) {
+        const double* rowXj = x + j * numNew;
+
+        for (size_t l = 0; l < numNew; l++) {
+          rowX[l] -= rowL[j] * rowXj[l];
+        }
+      }
+
+      for (size_t l = 0; l < numNew; l++) {
+        rowX[l] /= rowL[i];
+      }
+    }
   }
 
-  // Determine amount of necessary Givens rotations and rows to swap
-  size_t count_perm = l - k;
-  // Create GSL matrix view for update procedures
-  gsl_matrix_view m = gsl_matrix_view_array(mat.getPointer(), size, size);
+  // Schur complement S = C - X'X of the new points (lower triangle)
+  DataMatrix S(numNew, numNew, 0.0);
 
-  // Define and declare Workingvector, Cosine- and Sinevector
-  gsl_vector* svec = gsl_vector_calloc(count_perm);
-  gsl_vector* cvec = gsl_vector_calloc(count_perm);
+#pragma omp parallel
+  {
+    DataMatrix localS(numNew, numNew, 0.0);
 
-  double* givens_zero;
-  double* tbuff = m.matrix.data;
+#pragma omp for schedule(static) nowait
+    for (size_t i = 0; i < size; i++) {
+      const double* rowX = x + i * numNew;
 
-  if (job == 2) {
-    // Permute upper triangular - job = 2        => left circular shift
-    // 1,...,k-1,k,k+1, ..., l-1,l,l+1, ..,size  => 1,...,k-1,k+1, ...,
-    // l-1,l,k,l+1,..., size
-    for (size_t i = k - 1; i < l - 1; i++) {
-      gsl_matrix_swap_rows(&m.matrix, i, i + 1);
+      for (size_t p = 0; p < numNew; p++) {
+        for (size_t q = 0; q <= p; q++) {
+          localS.set(p, q, localS.get(p, q) + rowX[p] * rowX[q]);
+        }
+      }
     }
 
-    tbuff += (k - 1) * size + (k - 1);
-    for (size_t j = 1; j <= count_perm; j++) {
-      givens_zero = gsl_matrix_ptr(&m.matrix, k + j - 2, k + j - 1);
-      // Givensrotation in (k+i-1,k+i)-Plane
-      gsl_blas_drotg(tbuff, givens_zero, cvec->data + j - 1, svec->data + j - 1);
-      // Access columns to modify via Givens rotation
-      gsl_vector_view diag_sub =
-          gsl_matrix_subcolumn(&m.matrix, k + j - 2, k + j - 1, size - k - j + 1);
-      gsl_vector_view low_diag_sub =
-          gsl_matrix_subcolumn(&m.matrix, k + j - 1, k + j - 1, size - k - j + 1);
-      gsl_matrix_set(&m.matrix, k + j - 2, k + j - 1, 0.0);
-      // Apply Givens rotation
-      gsl_blas_drot(&diag_sub.vector, &low_diag_sub.vector, cvec->data[j - 1], svec->data[j - 1]);
-      tbuff += (size + 1);
+#pragma omp critical
+    { S.sub(localS); }
+  }
+
+  for (size_t p = 0; p < numNew; p++) {
+    for (size_t q = 0; q <= p; q++) {
+      // the coupling of new points p and q (q <= p) is stored in column p
+      S.set(p, q, S.get(p, q) + newCols.get(size + q, p));
+    }
+  }
+
+  // Cholesky factorization of the Schur complement
+  for (size_t p = 0; p < numNew; p++) {
+    double phi = S.get(p, p);
+
+    for (size_t q = 0; q < p; q++) {
+      phi -= S.get(p, q) * S.get(p, q);
     }
-  } else if (job == 1) {
-    // Permute upper triangular - job = 1       => right circular shift
-    // 1,...,k-1,k,k+1, ..., l-1,l,l+1,...size  => 1,...,k-1,l,k,k+1, ...,
-    // l-1,l+1,...size
-    for (size_t i = l - 1; i > k - 1; i--) {
-      gsl_matrix_swap_rows(&m.matrix, i, i - 1);
+
+    // Ensure 'phi' is larger 0
+    if (phi <= 0) {
+      throw algorithm_exception("Resulting matrix is at least not numerical positive definite!");
     }
 
-    tbuff += (k - 1) * size + (l - 2);
-    for (size_t j = 1; j <= count_perm; j++) {
-      givens_zero = gsl_matrix_ptr(&m.matrix, k - 1, l - j);
-      // Givensrotation in (l-i,l-i+1)-Plane
-      gsl_blas_drotg(tbuff, givens_zero, cvec->data + j - 1, svec->data + j - 1);
-      // Access columns to modify via Givens rotation
-      gsl_vector_view diag_sub = gsl_matrix_subcolumn(&m.matrix, l - j - 1, l - j, size - l + j);
-      gsl_vector_view low_diag_sub = gsl_matrix_subcolumn(&m.matrix, l - j, l - j, size - l + j);
-      gsl_matrix_set(&m.matrix, k - 1, l - j, 0.0);
-      // Apply Givens rotation
-      gsl_blas_drot(&diag_sub.vector, &low_diag_sub.vector, cvec->data[j - 1], svec->data[j - 1]);
-      tbuff -= 1;
+    phi = sqrt(phi);
+    S.set(p, p, phi);
+
+#pragma omp parallel for schedule(static)
+    for (size_t r = p + 1; r < numNew; r++) {
+      double value = S.get(r, p);
+
+      for (size_t q = 0; q < p; q++) {
+        value -= S.get(r, q) * S.get(p, q);
+      }
+
+      S.set(r, p, value / phi);
     }
   }
 
-  gsl_vector_free(svec);
-  gsl_vector_free(cvec);
-#else
-  throw algorithm_exception("built withot GSL");
-#endif /*USE_GSL*/
+  // Modify Choleskyfactor: new rows are [X' chol(S)]
+#pragma omp parallel for schedule(static)
+  for (size_t p = 0; p < numNew; p++) {
+    double* rowL = L + (size + p) * newSize;
+
+    for (size_t i = 0; i < size; i++) {
+      rowL[i] = x[i * numNew + p];
+    }
+
+    for (size_t q = 0; q <= p; q++) {
+      rowL[size + q] = S.get(p, q);
+    }
+
+    std::fill(rowL + size + p + 1, rowL + newSize, 0.0);
+  }
 }
 
 sgpp::datadriven::MatrixDecompositionType DBMatOfflineChol::getDecompositionType() {
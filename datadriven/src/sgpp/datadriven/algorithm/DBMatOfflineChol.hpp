@@ -14,7 +14,9 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineGE.hpp>
 
 #include <list>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -50,6 +52,32 @@ class DBMatOfflineChol : public DBMatOfflineGE {
   void decomposeMatrix(RegularizationConfiguration& regularizationConfig,
                        DensityEstimationConfiguration& densityEstimationConfig) override;
 
+  /**
+   * Assembles the lhs matrix directly into the distributed matrix for decomposeMatrixParallel().
+   * @param grid The grid object the matrix is based on
+   * @param regularizationConfig Configures the regularization which is incorporated into the lhs
+   * @param processGrid process grid to distribute the matrix on
+   * @param parallelConfig configuration of the block sizes
+   */
+  void buildMatrixParallel(Grid* grid, RegularizationConfiguration& regularizationConfig,
+                           std::shared_ptr<BlacsProcessGrid> processGrid,
+                           const ParallelConfiguration& parallelConfig) override;
+
+  /**
+   * Computes the Cholesky decomposition distributed on the process grid (pdpotrf). Only the
+   * distributed factor is kept, it is gathered into the local matrix for refinement and serial
+   * solves. The incomplete Cholesky decomposition has no ScaLAPACK counterpart and is computed on
+   * each process instead.
+   * @param regularizationConfig the regularization configuration
+   * @param densityEstimationConfig the density estimation configuration
+   * @param processGrid process grid to distribute the matrix on
+   * @param parallelConfig configuration of the block sizes
+   */
+  void decomposeMatrixParallel(RegularizationConfiguration& regularizationConfig,
+                               DensityEstimationConfiguration& densityEstimationConfig,
+                               std::shared_ptr<BlacsProcessGrid> processGrid,
+                               const ParallelConfiguration& parallelConfig) override;
+
   /**
    * Updates offline cholesky factorization based on coarsed (deletedPoints)
    * and refined (newPoints) gridPoints
@@ -74,28 +102,30 @@ class DBMatOfflineChol : public DBMatOfflineGE {
 
  protected:
   /**
-   * Permutes the rows of the cholesky factor based on permutations
-   * of the system matrix (e.g. coarsening)
+   * Removes grid points from the cholesky factor (e.g. coarsening). The rows of the removed
+   * points are deleted, which leaves the factor triangular up to the columns of the removed
+   * points. Those columns are folded into the trailing part of the factor by a single blocked
+   * rank k update, the leading part in front of the first removed point is not touched.
    *
-   * @param k "left" column to permutate
-   * @param l "right" column to permutate
-   * @param job = 2        => left circular shift
-   *	  1,...,k-1,k,k+1, ..., l-1,l,l+1, ..,size  => 1,...,k-1,k+1, ...,
-   *l-1,l,k,l+1,..., size
-   * 	  job = 1       => right circular shift
-   * 	  1,...,k-1,k,k+1, ..., l-1,l,l+1,...size  => 1,...,k-1,l,k,k+1, ...,
-   *l-1,l+1,...size
+   * @param deletedPoints indices of the removed grid points, sorted ascending
    */
-  void choleskyPermutation(size_t k, size_t l, size_t job);
+  void choleskyRemovePoints(const std::vector<size_t>& deletedPoints);
 
   /**
-   * Updates the cholesky factor when a new grid point is added (e.g. refine)
+   * Updates the cholesky factor when new grid points are added (e.g. refine). The new rows of
+   * the factor are obtained by a blocked, parallel forward substitution with all new columns
+   * at once and the cholesky factorization of the (small) Schur complement of the new points.
    *
-   * @param newCol DataVector with column to add to the system matrix
-   * @param size columns/rows of current Cholesky factor, necessary since the
-            allocated memory is increased before the Cholesky factor is modified
+   * @param newCols matrix with the columns to add to the system matrix, one column per new grid
+   * point, the number of rows is the new size of the system matrix
+   * @param blockSize block size of the forward substitution
+   */
+  void choleskyAddPoints(const DataMatrix& newCols, size_t blockSize = 64);
+
+  /**
+   * Gathers the distributed factor and clears the upper triangle, which still holds the lhs
    */
-  void choleskyAddPoint(DataVector& newCol, size_t size);
+  void gatherDistributedDecomposition() override;
 };
 
 } /* namespace datadriven */
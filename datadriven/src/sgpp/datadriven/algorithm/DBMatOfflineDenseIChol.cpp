@@ -16,6 +16,7 @@
 #include <chrono>
 #include <list>
 #include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -64,6 +65,14 @@ void DBMatOfflineDenseIChol::decomposeMatrix(RegularizationConfiguration& regula
 void DBMatOfflineDenseIChol::choleskyModification(Grid& grid,
     datadriven::DensityEstimationConfiguration& densityEstimationConfig, size_t newPoints,
     std::list<size_t> deletedPoints, double lambda) {
+  // coarsening: remove the points from the factor by a blocked rank k update
+  if (deletedPoints.size() > 0) {
+    std::vector<size_t> deleted(deletedPoints.begin(), deletedPoints.end());
+    std::sort(deleted.begin(), deleted.end());
+    deleted.erase(std::unique(deleted.begin(), deleted.end()), deleted.end());
+    choleskyRemovePoints(deleted);
+  }
+
   if (newPoints > 0) {
     //    auto begin = std::chrono::high_resolution_clock::now();
 
@@ -51,11 +51,12 @@ class DBMatOfflineDenseIChol : public DBMatOfflineChol {
 
   /**
    * Updates offline cholesky factorization based on coarsed (deletedPoints)
-   * and refined (newPoints) gridPoints. We ignore coarsening.
+   * and refined (newPoints) gridPoints. Coarsened points are removed from the factor by a
+   * blocked rank k update, refined points are added by incomplete cholesky sweeps.
    * @param grid the underlying grid
    * @param densityEstimationConfig configuration for the density estimation
    * @param newPoints amount of refined points
-   * @param deletedPoints list of indices of last coarsed points that are ignored.
+   * @param deletedPoints list of indices of last coarsed points
    * @param lambda the regularization parameter
    */
   void choleskyModification(Grid& grid,
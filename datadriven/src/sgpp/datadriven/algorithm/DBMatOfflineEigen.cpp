@@ -18,12 +18,12 @@
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DenseLinearAlgebra.hpp>
 #include <sgpp/datadriven/datamining/base/StringTokenizer.hpp>
 
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_eigen.h>
-#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix_double.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
@@ -31,6 +31,7 @@ namespace sgpp {
 namespace datadriven {
 
 using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
 using sgpp::base::application_exception;
 using sgpp::base::data_exception;
 using sgpp::base::algorithm_exception;
@@ -92,27 +93,12 @@ void DBMatOfflineEigen::decomposeMatrix(RegularizationConfiguration& regularizat
     }
     size_t n = lhsMatrix.getNrows();
 
-    gsl_matrix_view m = gsl_matrix_view_array(lhsMatrix.getPointer(), n,
-                                              n);  // Create GSL matrix view for decomposition
+    // The eigenvectors overwrite the matrix
+    DataVector e(n);  // Stores the eigenvalues
+    DenseLinearAlgebra::symmetricEigen(lhsMatrix, e);
 
-    auto q = std::unique_ptr<gsl_matrix>{gsl_matrix_alloc(n, n)};  // Stores the eigenvectors
-    auto e = std::unique_ptr<gsl_vector>{gsl_vector_alloc(n)};     // Stores the eigenvalues
-
-    gsl_eigen_symmv_workspace* ws = gsl_eigen_symmv_alloc(n);
-    gsl_eigen_symmv(&m.matrix, e.get(), q.get(), ws);
-    gsl_eigen_symmv_free(ws);
-
-    // Create an (n+1)*n matrix to store eigenvalues and -vectors:
-    lhsMatrix = DataMatrix(n + 1, n);
-
-    for (size_t r = 0; r < n; r++) {
-      for (size_t c = 0; c < n; c++) {
-        lhsMatrix.set(r, c, gsl_matrix_get(q.get(), r, c));
-      }
-    }
-    for (size_t c = 0; c < n; c++) {
-      lhsMatrix.set(n, c, gsl_vector_get(e.get(), c));
-    }
+    // Append the eigenvalues to get an (n+1)*n matrix storing eigenvalues and -vectors:
+    lhsMatrix.appendRow(e);
 
     isDecomposed = true;
   } else {
@@ -120,6 +106,62 @@ void DBMatOfflineEigen::decomposeMatrix(RegularizationConfiguration& regularizat
   }
 }
 
+void DBMatOfflineEigen::buildMatrixParallel(Grid* grid,
+                                            RegularizationConfiguration& regularizationConfig,
+                                            std::shared_ptr<BlacsProcessGrid> processGrid,
+                                            const ParallelConfiguration& parallelConfig) {
+#ifdef USE_SCALAPACK
+  buildMatrixDistributed(grid, processGrid, parallelConfig.rowBlockSize_,
+                         parallelConfig.rowBlockSize_);
+#else
+  DBMatOffline::buildMatrixParallel(grid, regularizationConfig, processGrid, parallelConfig);
+#endif /* USE_SCALAPACK */
+}
+
+void DBMatOfflineEigen::decomposeMatrixParallel(
+    RegularizationConfiguration& regularizationConfig,
+    DensityEstimationConfiguration& densityEstimationConfig,
+    std::shared_ptr<BlacsProcessGrid> processGrid, const ParallelConfiguration& parallelConfig) {
+#ifdef USE_SCALAPACK
+  if (!isConstructed) {
+    throw data_exception("Matrix has to be constructed before it can be decomposed!");
+  } else if (isDecomposed) {
+    syncDistributedDecomposition(processGrid, parallelConfig);
+    return;
+  }
+
+  // pdsyevd needs square blocks
+  size_t blockSize = parallelConfig.rowBlockSize_;
+  distributeMatrix(processGrid, blockSize, blockSize);
+  size_t n = lhsDistributed.getGlobalRows();
+
+  DataMatrixDistributed eigenvectors;
+  DataVector e(n);  // Stores the eigenvalues
+  DataMatrixDistributed::symmetricEigen(lhsDistributed, eigenvectors, e);
+
+  // the eigenvectors are the rows of the distributed matrix, but the columns of the local one
+  DataMatrixDistributed transposed = eigenvectors.transpose();
+
+  // Append the eigenvalues to get an (n+1)*n matrix storing eigenvalues and -vectors, the first
+  // n rows have the same distribution as the transposed eigenvectors
+  lhsDistributed = DataMatrixDistributed(processGrid, n + 1, n, blockSize, blockSize);
+  double* localData = lhsDistributed.getLocalPointer();
+  size_t localColumns = lhsDistributed.getLocalColumns();
+  for (size_t localRow = 0; localRow < transposed.getLocalRows(); localRow++) {
+    std::copy_n(transposed.getLocalPointer() + localRow * transposed.getLocalColumns(),
+                transposed.getLocalColumns(), localData + localRow * localColumns);
+  }
+  for (size_t j = 0; j < n; j++) {
+    lhsDistributed.set(n, j, e[j]);
+  }
+
+  isDecomposed = true;
+#else
+  DBMatOffline::decomposeMatrixParallel(regularizationConfig, densityEstimationConfig,
+                                        processGrid, parallelConfig);
+#endif /* USE_SCALAPACK */
+}
+
 sgpp::datadriven::MatrixDecompositionType DBMatOfflineEigen::getDecompositionType() {
   return sgpp::datadriven::MatrixDecompositionType::Eigen;
 }
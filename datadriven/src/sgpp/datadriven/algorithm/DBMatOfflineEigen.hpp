@@ -16,6 +16,7 @@
 
 #include <gsl/gsl_permutation.h>
 
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -55,6 +56,32 @@ class DBMatOfflineEigen : public DBMatOffline {
    */
   void decomposeMatrix(RegularizationConfiguration& regularizationConfig,
       DensityEstimationConfiguration& densityEstimationConfig) override;
+
+  /**
+   * Assembles the matrix A directly on the process grid with square blocks, as needed by
+   * decomposeMatrixParallel(). Without ScaLAPACK the matrix is built locally.
+   * @param grid The grid object the matrix is based on
+   * @param regularizationConfig the regularization configuration, lambda is applied online
+   * @param processGrid process grid to distribute the matrix on
+   * @param parallelConfig configuration of the block sizes
+   */
+  void buildMatrixParallel(Grid* grid, RegularizationConfiguration& regularizationConfig,
+                           std::shared_ptr<BlacsProcessGrid> processGrid,
+                           const ParallelConfiguration& parallelConfig) override;
+
+  /**
+   * Computes the eigen decomposition distributed on the process grid (pdsyevd). Only the
+   * distributed result is kept, it is gathered in the layout of decomposeMatrix() when needed
+   * locally.
+   * @param regularizationConfig the regularization configuration
+   * @param densityEstimationConfig the density estimation configuration
+   * @param processGrid process grid to distribute the matrix on
+   * @param parallelConfig configuration of the block sizes
+   */
+  void decomposeMatrixParallel(RegularizationConfiguration& regularizationConfig,
+                               DensityEstimationConfiguration& densityEstimationConfig,
+                               std::shared_ptr<BlacsProcessGrid> processGrid,
+                               const ParallelConfiguration& parallelConfig) override;
 };
 
 } /* namespace datadriven */
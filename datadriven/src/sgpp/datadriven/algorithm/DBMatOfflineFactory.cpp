@@ -54,11 +54,11 @@ DBMatOffline* DBMatOfflineFactory::buildOfflineObject(
 
     case (MatrixDecompositionType::Chol):
     case (MatrixDecompositionType::SMW_chol):
-#ifdef USE_GSL
+#if defined(USE_GSL) || defined(USE_LAPACK)
       return new DBMatOfflineChol();
 #else
-      throw factory_exception("built without GSL");
-#endif /* USE_GSL */
+      throw factory_exception("built without GSL and LAPACK");
+#endif /* USE_GSL || USE_LAPACK */
       break;
 
     case (MatrixDecompositionType::DenseIchol):
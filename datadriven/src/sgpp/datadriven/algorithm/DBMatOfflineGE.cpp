@@ -24,6 +24,7 @@
 #endif /* USE_GSL */
 
 #include <list>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -105,5 +106,18 @@ void DBMatOfflineGE::buildMatrix(Grid* grid, RegularizationConfiguration& regula
   isConstructed = true;
 }
 
+void DBMatOfflineGE::buildMatrixDistributed(Grid* grid,
+                                            RegularizationConfiguration& regularizationConfig,
+                                            std::shared_ptr<BlacsProcessGrid> processGrid,
+                                            size_t rowBlockSize, size_t columnBlockSize) {
+  if (regularizationConfig.type_ != RegularizationType::Identity) {
+    throw operation_exception("Unsupported regularization type");
+  }
+
+  // A + lambda * I
+  DBMatOffline::buildMatrixDistributed(grid, processGrid, rowBlockSize, columnBlockSize,
+                                       regularizationConfig.lambda_);
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -13,6 +13,7 @@
 
 #include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
 
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -35,6 +36,19 @@ class DBMatOfflineGE : public DBMatOffline {
 
  protected:
   DBMatOfflineGE();
+
+  /**
+   * Assembles the lhs matrix with identity regularization term directly into the distributed
+   * matrix, see DBMatOffline::buildMatrixDistributed()
+   * @param grid The grid object the matrix is based on
+   * @param regularizationConfig Configures the regularization which is incorporated into the lhs
+   * @param processGrid process grid to distribute the matrix on
+   * @param rowBlockSize row block size of the distributed matrix
+   * @param columnBlockSize column block size of the distributed matrix
+   */
+  void buildMatrixDistributed(Grid* grid, RegularizationConfiguration& regularizationConfig,
+                              std::shared_ptr<BlacsProcessGrid> processGrid, size_t rowBlockSize,
+                              size_t columnBlockSize);
 };
 
 } /* namespace datadriven */
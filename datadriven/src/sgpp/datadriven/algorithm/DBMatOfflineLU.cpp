@@ -79,6 +79,55 @@ void DBMatOfflineLU::decomposeMatrix(RegularizationConfiguration& regularization
   }
 }
 
+void DBMatOfflineLU::buildMatrixParallel(Grid* grid,
+                                         RegularizationConfiguration& regularizationConfig,
+                                         std::shared_ptr<BlacsProcessGrid> processGrid,
+                                         const ParallelConfiguration& parallelConfig) {
+#ifdef USE_SCALAPACK
+  buildMatrixDistributed(grid, regularizationConfig, processGrid, parallelConfig.rowBlockSize_,
+                         parallelConfig.rowBlockSize_);
+#else
+  DBMatOfflineGE::buildMatrixParallel(grid, regularizationConfig, processGrid, parallelConfig);
+#endif /* USE_SCALAPACK */
+}
+
+void DBMatOfflineLU::decomposeMatrixParallel(
+    RegularizationConfiguration& regularizationConfig,
+    DensityEstimationConfiguration& densityEstimationConfig,
+    std::shared_ptr<BlacsProcessGrid> processGrid, const ParallelConfiguration& parallelConfig) {
+#ifdef USE_SCALAPACK
+  if (!isConstructed) {
+    throw base::algorithm_exception("Matrix has to be constructed before it can be decomposed!");
+  } else if (isDecomposed) {
+    syncDistributedDecomposition(processGrid, parallelConfig);
+    return;
+  }
+
+  // pdgetrf needs square blocks
+  distributeMatrix(processGrid, parallelConfig.rowBlockSize_, parallelConfig.rowBlockSize_);
+  size_t n = lhsDistributed.getGlobalRows();
+
+  std::vector<size_t> pivots;
+  DataMatrixDistributed::luDecomposition(lhsDistributed, pivots);
+
+  // the matrix is symmetric, so the distributed matrix holds the transposed factors of A
+  lhsDistributed = lhsDistributed.transpose();
+
+  // the row interchanges are applied one after another, see gsl_permute_vector
+  permutation = std::unique_ptr<gsl_permutation>{gsl_permutation_alloc(n)};
+  gsl_permutation_init(permutation.get());
+
+  for (size_t i = 0; i < n; i++) {
+    gsl_permutation_swap(permutation.get(), i, pivots[i]);
+  }
+
+  isDecomposed = true;
+#else
+  DBMatOffline::decomposeMatrixParallel(regularizationConfig, densityEstimationConfig,
+                                        processGrid, parallelConfig);
+#endif /* USE_SCALAPACK */
+}
+
 DBMatOfflineLU::DBMatOfflineLU(const std::string& fileName)
     : DBMatOfflineGE(), permutation{nullptr} {
   isConstructed = true;
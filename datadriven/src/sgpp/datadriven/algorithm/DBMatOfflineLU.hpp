@@ -16,6 +16,7 @@
 
 #include <gsl/gsl_permutation.h>
 
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -65,6 +66,31 @@ class DBMatOfflineLU : public DBMatOfflineGE {
   void decomposeMatrix(RegularizationConfiguration& regularizationConfig,
       DensityEstimationConfiguration& densityEstimationConfig) override;
 
+  /**
+   * Assembles A + lambda * I directly on the process grid with square blocks, as needed by
+   * decomposeMatrixParallel(). Without ScaLAPACK the matrix is built locally.
+   * @param grid The grid object the matrix is based on
+   * @param regularizationConfig Configures the regularization which is incorporated into the lhs
+   * @param processGrid process grid to distribute the matrix on
+   * @param parallelConfig configuration of the block sizes
+   */
+  void buildMatrixParallel(Grid* grid, RegularizationConfiguration& regularizationConfig,
+                           std::shared_ptr<BlacsProcessGrid> processGrid,
+                           const ParallelConfiguration& parallelConfig) override;
+
+  /**
+   * Computes the LU decomposition distributed on the process grid (pdgetrf). Only the distributed
+   * factors are kept, they are gathered in the layout of decomposeMatrix() when needed locally.
+   * @param regularizationConfig the regularization configuration
+   * @param densityEstimationConfig the density estimation configuration
+   * @param processGrid process grid to distribute the matrix on
+   * @param parallelConfig configuration of the block sizes
+   */
+  void decomposeMatrixParallel(RegularizationConfiguration& regularizationConfig,
+                               DensityEstimationConfiguration& densityEstimationConfig,
+                               std::shared_ptr<BlacsProcessGrid> processGrid,
+                               const ParallelConfiguration& parallelConfig) override;
+
   /**
    * Apply permutation vector to the LU factors
    * @param b permutation vector
@@ -203,6 +203,67 @@ void DBMatOnlineDE::computeDensityFunction(DataVector& alpha, DataMatrix& m, Gri
   std::cout << "\ndensity function computed successfully\n";
 }
 
+void DBMatOnlineDE::computeRhsMultiple(DataMatrix& m, DataMatrix& weights, DataMatrix& b,
+                                       Grid& grid,
+                                       DensityEstimationConfiguration& densityEstimationConfig) {
+  if (m.getNrows() != weights.getNrows()) {
+    throw algorithm_exception(
+        "In DBMatOnlineDE::computeRhsMultiple: number of weights doesn't match number of points");
+  }
+
+  b.resizeRowsCols(grid.getSize(), weights.getNcols());
+  b.setAll(0.0);
+
+  if (m.getNrows() == 0) {
+    return;
+  }
+
+  // Bt * W, all right hand sides share the evaluations of the basis functions
+  std::unique_ptr<sgpp::base::OperationMultipleEval> B(
+      (offlineObject.interactions.size() == 0)
+          ? sgpp::op_factory::createOperationMultipleEval(grid, m)
+          : sgpp::op_factory::createOperationMultipleEvalInter(grid, m,
+                                                               offlineObject.interactions));
+  B->multTransposeMultiple(weights, b);
+
+  // Perform permutation because of decomposition (LU)
+  if (densityEstimationConfig.decomposition_ == MatrixDecompositionType::LU) {
+#ifdef USE_GSL
+    DataVector column(b.getNrows());
+    for (size_t j = 0; j < b.getNcols(); j++) {
+      b.getColumn(j, column);
+      static_cast<DBMatOfflineLU&>(offlineObject).permuteVector(column);
+      b.setColumn(j, column);
+    }
+#else
+    throw algorithm_exception("built without GSL");
+#endif /*USE_GSL*/
+  }
+}
+
+void DBMatOnlineDE::computeDensityFunctionsMultiple(
+    DataMatrix& alphas, DataMatrix& b, Grid& grid,
+    DensityEstimationConfiguration& densityEstimationConfig, bool do_cv) {
+  if (b.getNrows() != grid.getSize()) {
+    throw algorithm_exception(
+        "In DBMatOnlineDE::computeDensityFunctionsMultiple: b doesn't match size of system "
+        "matrix");
+  }
+
+  alphas.resizeRowsCols(grid.getSize(), b.getNcols());
+  DataVector alpha(grid.getSize());
+  DataVector rhs(grid.getSize());
+
+  // the decomposition is shared, only the substitutions are done per right hand side
+  for (size_t j = 0; j < b.getNcols(); j++) {
+    b.getColumn(j, rhs);
+    solveSLE(alpha, rhs, grid, densityEstimationConfig, do_cv);
+    alphas.setColumn(j, alpha);
+  }
+
+  functionComputed = true;
+}
+
 void DBMatOnlineDE::computeDensityFunctionParallel(
     DataVectorDistributed& alpha, Grid& grid,
     DensityEstimationConfiguration& densityEstimationConfig,
@@ -242,16 +303,14 @@ void DBMatOnlineDE::computeDensityFunctionParallel(
     // init bSaveDistributed and bTotalPointsDistributed only here, as they are not needed in the
     // local version
     bSaveDistributed = std::make_unique<DataVectorDistributed>(
-        processGrid, offlineObject.getDecomposedMatrix().getNcols(), parallelConfig.rowBlockSize_);
+        processGrid, offlineObject.getDecomposedMatrixColumns(), parallelConfig.rowBlockSize_);
     bTotalPointsDistributed = std::make_unique<DataVectorDistributed>(
-        processGrid, offlineObject.getDecomposedMatrix().getNcols(), parallelConfig.rowBlockSize_);
+        processGrid, offlineObject.getDecomposedMatrixColumns(), parallelConfig.rowBlockSize_);
 
     distributedVectorsInitialized = true;
   }
 
   if (m.getNrows() > 0) {
-    DataMatrix& lhsMatrix = offlineObject.getDecomposedMatrix();
-
     // in case OrthoAdapt, the current size is not lhs size, but B size
     bool use_B_size = false;
     sgpp::datadriven::DBMatOnlineDEOrthoAdapt* thisOrthoAdaptPtr;
@@ -267,7 +326,8 @@ void DBMatOnlineDE::computeDensityFunctionParallel(
     size_t numberOfPoints = m.getNrows();
     totalPoints++;
 
-    size_t bSize = use_B_size ? thisOrthoAdaptPtr->getB().getNcols() : lhsMatrix.getNcols();
+    size_t bSize = use_B_size ? thisOrthoAdaptPtr->getB().getNcols()
+                              : offlineObject.getDecomposedMatrixColumns();
 
     DataVectorDistributed b(processGrid, bSize, parallelConfig.rowBlockSize_);
     if (b.getGlobalRows() != grid.getSize()) {
@@ -371,6 +431,22 @@ void DBMatOnlineDE::eval(DataVector& alpha, DataMatrix& values, DataVector& resu
   }
 }
 
+void DBMatOnlineDE::evalMultiple(DataMatrix& alphas, DataMatrix& values, DataMatrix& results,
+                                 Grid& grid, bool force) {
+  if (functionComputed || force == true) {
+    std::unique_ptr<sgpp::base::OperationMultipleEval> opEval(
+        (offlineObject.interactions.size() == 0)
+            ? sgpp::op_factory::createOperationMultipleEval(grid, values)
+            : sgpp::op_factory::createOperationMultipleEvalInter(grid, values,
+                                                                 offlineObject.interactions));
+    results.resizeRowsCols(values.getNrows(), alphas.getNcols());
+    opEval->multMultiple(alphas, results);
+    results.mult(normFactor);
+  } else {
+    throw algorithm_exception("Density function not computed, yet!");
+  }
+}
+
 void DBMatOnlineDE::evalParallel(DataVector& alpha, DataMatrix& values,
                                  DataVectorDistributed& results, Grid& grid, bool force) {
   if (functionComputed || force == true) {
@@ -123,6 +123,36 @@ class DBMatOnlineDE : public DBMatOnline {
                                       std::list<size_t>* deletedPoints = nullptr,
                                       size_t newPoints = 0);
 
+  /**
+   * Computes the right hand sides of several density functions on the same grid, e.g. the class
+   * conditional densities of a classification, with a single pass over the data points. The
+   * right hand side of density j is the sum of the basis functions at the data points, weighted
+   * by column j of weights.
+   *
+   * @param m the matrix that contains the data points
+   * @param weights weight of each data point (rows) for each density function (columns)
+   * @param b the right hand sides, one column per density function (resized)
+   * @param grid The underlying grid
+   * @param densityEstimationConfig Configuration for the density estimation
+   */
+  void computeRhsMultiple(DataMatrix& m, DataMatrix& weights, DataMatrix& b, Grid& grid,
+                          DensityEstimationConfiguration& densityEstimationConfig);
+
+  /**
+   * Computes several density functions on the same grid by solving the system with the
+   * decomposition of the offline object for multiple right hand sides
+   *
+   * @param alphas the matrix where the surplusses of the density functions will be stored, one
+   * column per density function (resized)
+   * @param b the right hand sides, one column per density function, see computeRhsMultiple
+   * @param grid The underlying grid
+   * @param densityEstimationConfig Configuration for the density estimation
+   * @param do_cv Indicates whether crossvalidation should take place
+   */
+  void computeDensityFunctionsMultiple(DataMatrix& alphas, DataMatrix& b, Grid& grid,
+                                       DensityEstimationConfiguration& densityEstimationConfig,
+                                       bool do_cv = false);
+
   /**
    * Evaluates the density function at a certain point
    *
@@ -146,6 +176,18 @@ class DBMatOnlineDE : public DBMatOnline {
   void eval(DataVector& alpha, DataMatrix& values, DataVector& results, Grid& grid,
             bool force = false);
 
+  /**
+   * Evaluates several density functions on the same grid on multiple points in a single pass
+   *
+   * @param alphas the surplusses, one column per density function
+   * @param values the points at which the functions are evaluated
+   * @param results the results, one row per point and one column per density function
+   * @param grid the underlying grid
+   * @param force if set, it will even try to evaluate if the internal state recommends otherwise
+   */
+  void evalMultiple(DataMatrix& alphas, DataMatrix& values, DataMatrix& results, Grid& grid,
+                    bool force = false);
+
   /**
    * Evaluates the density function on multiple points using parallization
    *
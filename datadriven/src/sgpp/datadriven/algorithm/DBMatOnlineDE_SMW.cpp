@@ -3,14 +3,6 @@
 // use, please see the copyright notice provided with SG++ or at
 // sgpp.sparsegrids.org
 
-#ifdef USE_GSL
-#include <gsl/gsl_blas.h>
-#include <gsl/gsl_linalg.h>
-#include <gsl/gsl_math.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_vector.h>
-#endif /* USE_GSL */
-
 #include <sgpp/base/exception/algorithm_exception.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDMSOrthoAdapt.hpp>
 #include <sgpp/datadriven/algorithm/DBMatDMS_SMW.hpp>
@@ -18,6 +10,7 @@
 #include <sgpp/datadriven/algorithm/DBMatOfflineOrthoAdapt.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOnlineDEOrthoAdapt.hpp>
 #include <sgpp/datadriven/algorithm/DBMatOnlineDE_SMW.hpp>
+#include <sgpp/datadriven/algorithm/DenseLinearAlgebra.hpp>
 
 #include <algorithm>
 #include <functional>
@@ -27,6 +20,24 @@
 namespace sgpp {
 namespace datadriven {
 
+namespace {
+
+// adds the size x size matrix summand to the leading block of matrix
+void addLeadingBlock(DataMatrix& matrix, const DataMatrix& summand, size_t size) {
+  size_t ncols = matrix.getNcols();
+  double* data = matrix.getPointer();
+  const double* summandData = summand.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) {
+      data[i * ncols + j] += summandData[i * size + j];
+    }
+  }
+}
+
+}  // namespace
+
 DBMatOnlineDE_SMW::DBMatOnlineDE_SMW(DBMatOffline& offline, Grid& grid, double lambda, double beta)
     : sgpp::datadriven::DBMatOnlineDE(offline, grid, lambda, beta) {
   if (offline.getDecompositionType() != sgpp::datadriven::MatrixDecompositionType::OrthoAdapt &&
@@ -122,7 +133,6 @@ void DBMatOnlineDE_SMW::solveSLEParallel(DataVectorDistributed& alpha, DataVecto
 
 void DBMatOnlineDE_SMW::smw_adapt(DataMatrix& X, size_t newPoints, bool refine,
                                   std::vector<size_t> coarsenIndices) {
-#ifdef USE_GSL
   // dimension of offline's lhs matrix and its inverse
   size_t offMatrixSize = this->offlineObject.getGridSize();
 
@@ -154,11 +164,6 @@ void DBMatOnlineDE_SMW::smw_adapt(DataMatrix& X, size_t newPoints, bool refine,
    *
    ************************************************************/
 
-  // create view of B, will store values of B~
-  gsl_matrix_view b_adapt_full_view =
-      gsl_matrix_view_array(this->b_adapt_matrix_.getPointer(), this->b_adapt_matrix_.getNrows(),
-                            this->b_adapt_matrix_.getNcols());
-
   // adapt X's diagonal, lambda already added before
   for (size_t k = X.getNrows() - X.getNcols(); k < X.getNrows(); k++) {
     // <x, x> = 0 => x=0, therefore:
@@ -177,51 +182,38 @@ void DBMatOnlineDE_SMW::smw_adapt(DataMatrix& X, size_t newPoints, bool refine,
     E.set(k, k - E.getNrows() + E.getNcols(), 1.0);
   }
 
-  // create view of A^-1
-  gsl_matrix_view A_inv_view = gsl_matrix_view_array(
-      this->offlineObject.getInverseMatrix().getPointer(), offMatrixSize, offMatrixSize);
+  // A^-1
+  DataMatrix& A_inv = this->offlineObject.getInverseMatrix();
 
   // A^-1 + B (calculate in size of A^-1, store in size of B)
   DataMatrix AB(this->b_adapt_matrix_);
-  gsl_matrix_view AB_view = gsl_matrix_view_array(AB.getPointer(), this->b_adapt_matrix_.getNrows(),
-                                                  this->b_adapt_matrix_.getNcols());
-  gsl_matrix_view AB_sub_view =
-      gsl_matrix_submatrix(&AB_view.matrix, 0, 0, offMatrixSize, offMatrixSize);
-  gsl_matrix_add(&AB_sub_view.matrix, &A_inv_view.matrix);
+  addLeadingBlock(AB, A_inv, offMatrixSize);
 
   // (A^-1 + B) * X
-  gsl_matrix* AX = gsl_matrix_alloc(X.getNrows(), X.getNcols());
-  gsl_matrix_view X_view = gsl_matrix_view_array(X.getPointer(), X.getNrows(), X.getNcols());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &AB_view.matrix, &X_view.matrix, 0.0, AX);
+  DataMatrix AX(X.getNrows(), X.getNcols());
+  DenseLinearAlgebra::gemm(false, false, 1.0, AB, X, 0.0, AX);
 
   // E^t * (A^-1 + B)
-  gsl_matrix* EA = gsl_matrix_alloc(X.getNcols(), X.getNrows());
-  gsl_matrix_view E_view = gsl_matrix_view_array(E.getPointer(), X.getNrows(), X.getNcols());
-  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &E_view.matrix, &AB_view.matrix, 0.0, EA);
+  DataMatrix EA(X.getNcols(), X.getNrows());
+  DenseLinearAlgebra::gemm(true, false, 1.0, E, AB, 0.0, EA);
 
   // I + E^t * (A^-1 + B) * X
-  gsl_matrix* TO_INV = gsl_matrix_alloc(X.getNcols(), X.getNcols());
-  gsl_matrix_set_identity(TO_INV);
-  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &E_view.matrix, AX, 1.0, TO_INV);
+  DataMatrix INV(X.getNcols(), X.getNcols(), 0.0);
+  for (size_t k = 0; k < X.getNcols(); k++) {
+    INV.set(k, k, 1.0);
+  }
+  DenseLinearAlgebra::gemm(true, false, 1.0, E, AX, 1.0, INV);
 
   // (I + E^t * (A^-1 + B) * X)^-1
-  gsl_permutation* P = gsl_permutation_alloc(X.getNcols());
-  int* signum = new int[X.getNcols()];
-  gsl_linalg_LU_decomp(TO_INV, P, signum);
-  gsl_matrix* INV = gsl_matrix_alloc(X.getNcols(), X.getNcols());
-  gsl_linalg_LU_invert(TO_INV, P, INV);
+  DenseLinearAlgebra::inverse(INV);
 
   // (A^-1 + B) X (I + E^t (A^-1 + B) X)^-1
-  gsl_matrix* AXINV = gsl_matrix_alloc(X.getNrows(), X.getNcols());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, AX, INV, 0.0, AXINV);
-
-  // (A^-1 + B) X (I + E^t (A^-1 + B) X)^-1 E^t (A^-1 + B)
-  gsl_matrix* AXINVEA = gsl_matrix_alloc(X.getNrows(), X.getNrows());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, AXINV, EA, 0.0, AXINVEA);
+  DataMatrix AXINV(X.getNrows(), X.getNcols());
+  DenseLinearAlgebra::gemm(false, false, 1.0, AX, INV, 0.0, AXINV);
 
   // B - (A^-1 + B) X (I + E^t (A^-1 + B) X)^-1 E^t (A^-1 + B)
   // effectively stores final values of Phase 1 in b_adapt_matrix_
-  gsl_matrix_sub(&b_adapt_full_view.matrix, AXINVEA);
+  DenseLinearAlgebra::gemm(false, false, -1.0, AXINV, EA, 1.0, this->b_adapt_matrix_);
 
   /************************************************************
    *
@@ -231,41 +223,33 @@ void DBMatOnlineDE_SMW::smw_adapt(DataMatrix& X, size_t newPoints, bool refine,
 
   // A^-1 + B~ (calculate in size of A^-1, store in size of B~)
   DataMatrix ABtilde(this->b_adapt_matrix_);
-  gsl_matrix_view ABtilde_view = gsl_matrix_view_array(
-      ABtilde.getPointer(), this->b_adapt_matrix_.getNrows(), this->b_adapt_matrix_.getNcols());
-  gsl_matrix_view ABtilde_sub_view =
-      gsl_matrix_submatrix(&ABtilde_view.matrix, 0, 0, offMatrixSize, offMatrixSize);
-  gsl_matrix_add(&ABtilde_sub_view.matrix, &A_inv_view.matrix);
+  addLeadingBlock(ABtilde, A_inv, offMatrixSize);
 
-  // (A^-1 + B~) * E    und    X^t*(A+B)
-  gsl_matrix* AE = gsl_matrix_alloc(X.getNrows(), X.getNcols());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, &ABtilde_view.matrix, &E_view.matrix, 0.0, AE);
+  // (A^-1 + B~) * E
+  DataMatrix AE(X.getNrows(), X.getNcols());
+  DenseLinearAlgebra::gemm(false, false, 1.0, ABtilde, E, 0.0, AE);
 
   // X^t * (A^-1 + B~)
-  gsl_matrix* XA = gsl_matrix_alloc(X.getNcols(), X.getNrows());
-  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &X_view.matrix, &ABtilde_view.matrix, 0.0, XA);
+  DataMatrix XA(X.getNcols(), X.getNrows());
+  DenseLinearAlgebra::gemm(true, false, 1.0, X, ABtilde, 0.0, XA);
 
   // I + X^t * (A^-1 + B) * E
-  gsl_matrix_set_identity(TO_INV);
-  gsl_blas_dgemm(CblasTrans, CblasNoTrans, 1.0, &X_view.matrix, AE, 1.0, TO_INV);
+  INV.setAll(0.0);
+  for (size_t k = 0; k < X.getNcols(); k++) {
+    INV.set(k, k, 1.0);
+  }
+  DenseLinearAlgebra::gemm(true, false, 1.0, X, AE, 1.0, INV);
 
   // (I + X^t * (A^-1 + B) * E)^-1
-  gsl_permutation* Ptilde = gsl_permutation_alloc(X.getNcols());
-  int* signumtilde = new int[X.getNcols()];
-  gsl_linalg_LU_decomp(TO_INV, Ptilde, signumtilde);
-  gsl_linalg_LU_invert(TO_INV, Ptilde, INV);
+  DenseLinearAlgebra::inverse(INV);
 
   // (A^-1 + B) E (I + X^t * (A^-1 + B) * E)^-1
-  gsl_matrix* AEINV = gsl_matrix_alloc(X.getNrows(), X.getNcols());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, AE, INV, 0.0, AEINV);
-
-  // (A^-1 + B) E (I + X^t (A^-1 + B) E)^-1 X^t (A^-1 + B)
-  gsl_matrix* AEINVXA = gsl_matrix_alloc(X.getNrows(), X.getNrows());
-  gsl_blas_dgemm(CblasNoTrans, CblasNoTrans, 1.0, AEINV, XA, 0.0, AEINVXA);
+  DataMatrix AEINV(X.getNrows(), X.getNcols());
+  DenseLinearAlgebra::gemm(false, false, 1.0, AE, INV, 0.0, AEINV);
 
   // B~ - (A^-1 + B~) E (I + X^t (A^-1 + B~) E)^-1 X^t (A^-1 + B~)
   // effectively stores final values of Phase 2 in b_adapt_matrix_
-  gsl_matrix_sub(&b_adapt_full_view.matrix, AEINVXA);
+  DenseLinearAlgebra::gemm(false, false, -1.0, AEINV, XA, 1.0, this->b_adapt_matrix_);
 
   /*****
    *
@@ -319,7 +303,6 @@ void DBMatOnlineDE_SMW::smw_adapt(DataMatrix& X, size_t newPoints, bool refine,
   this->b_is_refined = this->b_adapt_matrix_.getNcols() > offMatrixSize;
 
   return;
-#endif /* USE_GSL */
 }
 
 void DBMatOnlineDE_SMW::compute_L2_refine_matrix(DataMatrix& X, Grid& grid, size_t newPoints,
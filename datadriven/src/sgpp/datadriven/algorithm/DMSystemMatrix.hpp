@@ -60,6 +60,21 @@ class DMSystemMatrix : public DMSystemMatrixBase {
    *   multiplication on the rhs
    */
   virtual void generateb(base::DataVector& classes, base::DataVector& b);
+
+  virtual void prepareGrid();
+
+  /**
+   * Enables caching of the evaluation matrix of the operation B, such that the basis functions
+   * are evaluated at the training data only once instead of in every iteration of the solver
+   * (see base::OperationMultipleEval::enableMatrixCaching()). The cached matrix is rebuilt
+   * automatically after the grid has been refined.
+   *
+   * @param memoryBudget maximum number of bytes the cached matrix may occupy
+   * @param singlePrecision store the matrix entries in single precision
+   */
+  void enableMatrixCaching(
+      size_t memoryBudget = base::EvaluationMatrixCache::defaultMemoryBudget,
+      bool singlePrecision = false);
 };
 
 }  // namespace datadriven
@@ -0,0 +1,334 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/algorithm/DenseLinearAlgebra.hpp>
+
+#include <sgpp/base/exception/algorithm_exception.hpp>
+
+#ifdef USE_GSL
+#include <gsl/gsl_blas.h>
+#include <gsl/gsl_eigen.h>
+#include <gsl/gsl_linalg.h>
+#include <gsl/gsl_matrix_double.h>
+#include <gsl/gsl_permutation.h>
+#endif /* USE_GSL */
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#ifdef USE_LAPACK
+extern "C" {
+
+// Cholesky decomposition
+void dpotrf_(const char* uplo, const int* n, double* a, const int* lda, int* info);
+
+// inverse from the Cholesky decomposition
+void dpotri_(const char* uplo, const int* n, double* a, const int* lda, int* info);
+
+// LU decomposition with partial pivoting
+void dgetrf_(const int* m, const int* n, double* a, const int* lda, int* ipiv, int* info);
+
+// inverse from the LU decomposition
+void dgetri_(const int* n, double* a, const int* lda, const int* ipiv, double* work,
+             const int* lwork, int* info);
+
+// eigenvalues and eigenvectors of a symmetric matrix (divide and conquer)
+void dsyevd_(const char* jobz, const char* uplo, const int* n, double* a, const int* lda,
+             double* w, double* work, const int* lwork, int* iwork, const int* liwork, int* info);
+
+// C := alpha*op(A)*op(B) + beta*C
+void dgemm_(const char* transa, const char* transb, const int* m, const int* n, const int* k,
+            const double* alpha, const double* a, const int* lda, const double* b, const int* ldb,
+            const double* beta, double* c, const int* ldc);
+
+// y := alpha*op(A)*x + beta*y
+void dgemv_(const char* trans, const int* m, const int* n, const double* alpha, const double* a,
+            const int* lda, const double* x, const int* incx, const double* beta, double* y,
+            const int* incy);
+}
+#endif /* USE_LAPACK */
+
+namespace sgpp {
+namespace datadriven {
+
+using sgpp::base::algorithm_exception;
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+
+// Note on the LAPACK backend: LAPACK expects column major matrices. The row major storage of a
+// DataMatrix is the column major storage of its transposed, so symmetric matrices can be passed
+// directly (with the triangles swapped) and products are computed as C' = op(B)' op(A)'.
+
+namespace {
+
+void checkSquare(const DataMatrix& matrix, const char* message) {
+  if (matrix.getNrows() != matrix.getNcols()) {
+    throw algorithm_exception(message);
+  }
+}
+
+}  // namespace
+
+bool DenseLinearAlgebra::isAvailable() {
+#if defined(USE_LAPACK) || defined(USE_GSL)
+  return true;
+#else
+  return false;
+#endif
+}
+
+std::string DenseLinearAlgebra::getBackendName() {
+#if defined(USE_LAPACK)
+  return "LAPACK";
+#elif defined(USE_GSL)
+  return "GSL";
+#else
+  return "none";
+#endif
+}
+
+void DenseLinearAlgebra::choleskyDecomposition(DataMatrix& matrix) {
+  checkSquare(matrix, "DenseLinearAlgebra::choleskyDecomposition: matrix is not square");
+  size_t n = matrix.getNrows();
+
+  if (n == 0) {
+    return;
+  }
+
+#if defined(USE_LAPACK)
+  // the upper triangle of the column major (transposed) matrix is the lower triangle of L
+  int size = static_cast<int>(n);
+  int info = 0;
+  dpotrf_("U", &size, matrix.getPointer(), &size, &info);
+
+  if (info != 0) {
+    throw algorithm_exception(
+        "DenseLinearAlgebra::choleskyDecomposition: matrix is not positive definite");
+  }
+#elif defined(USE_GSL)
+  gsl_matrix_view m = gsl_matrix_view_array(matrix.getPointer(), n, n);
+  gsl_linalg_cholesky_decomp(&m.matrix);
+#else
+  throw algorithm_exception("built without LAPACK and GSL");
+#endif
+
+  // isolate lower triangular matrix
+  double* data = matrix.getPointer();
+
+#pragma omp parallel for schedule(static)
+  for (size_t i = 0; i < n; i++) {
+    std::fill(data + i * n + i + 1, data + (i + 1) * n, 0.0);
+  }
+}
+
+void DenseLinearAlgebra::choleskyInverse(DataMatrix& matrix) {
+  checkSquare(matrix, "DenseLinearAlgebra::choleskyInverse: matrix is not square");
+  size_t n = matrix.getNrows();
+
+  if (n == 0) {
+    return;
+  }
+
+#if defined(USE_LAPACK)
+  int size = static_cast<int>(n);
+  int info = 0;
+  dpotri_("U", &size, matrix.getPointer(), &size, &info);
+
+  if (info != 0) {
+    throw algorithm_exception("DenseLinearAlgebra::choleskyInverse: factor is singular");
+  }
+
+  // only the lower triangle holds the inverse, mirror it
+  double* data = matrix.getPointer();
+
+#pragma omp parallel for schedule(dynamic, 16)
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = i + 1; j < n; j++) {
+      data[i * n + j] = data[j * n + i];
+    }
+  }
+#elif defined(USE_GSL)
+  gsl_matrix_view m = gsl_matrix_view_array(matrix.getPointer(), n, n);
+  gsl_linalg_cholesky_invert(&m.matrix);
+#else
+  throw algorithm_exception("built without LAPACK and GSL");
+#endif
+}
+
+void DenseLinearAlgebra::inverse(DataMatrix& matrix) {
+  checkSquare(matrix, "DenseLinearAlgebra::inverse: matrix is not square");
+  size_t n = matrix.getNrows();
+
+  if (n == 0) {
+    return;
+  }
+
+#if defined(USE_LAPACK)
+  // inv(A') = inv(A)', so the transposition does not matter
+  int size = static_cast<int>(n);
+  int info = 0;
+  std::vector<int> pivots(n);
+  dgetrf_(&size, &size, matrix.getPointer(), &size, pivots.data(), &info);
+
+  if (info != 0) {
+    throw algorithm_exception("DenseLinearAlgebra::inverse: matrix is singular");
+  }
+
+  int lwork = -1;
+  double workSize = 0.0;
+  dgetri_(&size, matrix.getPointer(), &size, pivots.data(), &workSize, &lwork, &info);
+
+  if (info != 0) {
+    throw algorithm_exception("DenseLinearAlgebra::inverse: workspace query failed");
+  }
+
+  lwork = std::max(static_cast<int>(workSize), size);
+  std::vector<double> work(lwork);
+  dgetri_(&size, matrix.getPointer(), &size, pivots.data(), work.data(), &lwork, &info);
+
+  if (info != 0) {
+    throw algorithm_exception("DenseLinearAlgebra::inverse: matrix is singular");
+  }
+#elif defined(USE_GSL)
+  gsl_matrix_view m = gsl_matrix_view_array(matrix.getPointer(), n, n);
+  gsl_permutation* permutation = gsl_permutation_alloc(n);
+  gsl_matrix* result = gsl_matrix_alloc(n, n);
+  int signum = 0;
+  gsl_linalg_LU_decomp(&m.matrix, permutation, &signum);
+  gsl_linalg_LU_invert(&m.matrix, permutation, result);
+  gsl_matrix_memcpy(&m.matrix, result);
+  gsl_matrix_free(result);
+  gsl_permutation_free(permutation);
+#else
+  throw algorithm_exception("built without LAPACK and GSL");
+#endif
+}
+
+void DenseLinearAlgebra::symmetricEigen(DataMatrix& matrix, DataVector& eigenvalues) {
+  checkSquare(matrix, "DenseLinearAlgebra::symmetricEigen: matrix is not square");
+  size_t n = matrix.getNrows();
+  eigenvalues.resize(n);
+
+  if (n == 0) {
+    return;
+  }
+
+#if defined(USE_LAPACK)
+  int size = static_cast<int>(n);
+  int info = 0;
+  int lwork = -1;
+  int liwork = -1;
+  double workSize = 0.0;
+  int iworkSize = 0;
+  dsyevd_("V", "U", &size, matrix.getPointer(), &size, eigenvalues.getPointer(), &workSize,
+          &lwork, &iworkSize, &liwork, &info);
+
+  if (info != 0) {
+    throw algorithm_exception("DenseLinearAlgebra::symmetricEigen: workspace query failed");
+  }
+
+  lwork = static_cast<int>(workSize);
+  liwork = iworkSize;
+  std::vector<double> work(lwork);
+  std::vector<int> iwork(liwork);
+  dsyevd_("V", "U", &size, matrix.getPointer(), &size, eigenvalues.getPointer(), work.data(),
+          &lwork, iwork.data(), &liwork, &info);
+
+  if (info != 0) {
+    throw algorithm_exception("DenseLinearAlgebra::symmetricEigen: no convergence");
+  }
+
+  // the eigenvectors are stored column major, i.e. in the rows of the DataMatrix
+  matrix.transpose();
+#elif defined(USE_GSL)
+  gsl_matrix_view m = gsl_matrix_view_array(matrix.getPointer(), n, n);
+  gsl_vector_view e = gsl_vector_view_array(eigenvalues.getPointer(), n);
+  gsl_matrix* q = gsl_matrix_alloc(n, n);
+  gsl_eigen_symmv_workspace* ws = gsl_eigen_symmv_alloc(n);
+  gsl_eigen_symmv(&m.matrix, &e.vector, q, ws);
+  gsl_eigen_symmv_free(ws);
+  gsl_matrix_memcpy(&m.matrix, q);
+  gsl_matrix_free(q);
+#else
+  throw algorithm_exception("built without LAPACK and GSL");
+#endif
+}
+
+void DenseLinearAlgebra::gemm(bool transA, bool transB, double alpha, const DataMatrix& A,
+                              const DataMatrix& B, double beta, DataMatrix& C) {
+  size_t m = transA ? A.getNcols() : A.getNrows();
+  size_t k = transA ? A.getNrows() : A.getNcols();
+  size_t n = transB ? B.getNrows() : B.getNcols();
+
+  if ((transB ? B.getNcols() : B.getNrows()) != k || C.getNrows() != m || C.getNcols() != n) {
+    throw algorithm_exception("DenseLinearAlgebra::gemm: dimensions do not match");
+  }
+
+  if (m == 0 || n == 0) {
+    return;
+  }
+
+#if defined(USE_LAPACK)
+  int rows = static_cast<int>(m);
+  int cols = static_cast<int>(n);
+  int inner = static_cast<int>(k);
+  int lda = std::max(static_cast<int>(A.getNcols()), 1);
+  int ldb = std::max(static_cast<int>(B.getNcols()), 1);
+  dgemm_(transB ? "T" : "N", transA ? "T" : "N", &cols, &rows, &inner, &alpha, B.getPointer(),
+         &ldb, A.getPointer(), &lda, &beta, C.getPointer(), &cols);
+#elif defined(USE_GSL)
+  gsl_matrix_const_view a =
+      gsl_matrix_const_view_array(A.getPointer(), A.getNrows(), A.getNcols());
+  gsl_matrix_const_view b =
+      gsl_matrix_const_view_array(B.getPointer(), B.getNrows(), B.getNcols());
+  gsl_matrix_view c = gsl_matrix_view_array(C.getPointer(), m, n);
+  gsl_blas_dgemm(transA ? CblasTrans : CblasNoTrans, transB ? CblasTrans : CblasNoTrans, alpha,
+                 &a.matrix, &b.matrix, beta, &c.matrix);
+#else
+  throw algorithm_exception("built without LAPACK and GSL");
+#endif
+}
+
+void DenseLinearAlgebra::gemv(bool trans, double alpha, const DataMatrix& A, const DataVector& x,
+                              double beta, DataVector& y) {
+  if (x.getSize() < (trans ? A.getNrows() : A.getNcols()) ||
+      y.getSize() < (trans ? A.getNcols() : A.getNrows())) {
+    throw algorithm_exception("DenseLinearAlgebra::gemv: dimensions do not match");
+  }
+
+  gemv(trans, alpha, A.getPointer(), A.getNrows(), A.getNcols(), x.getPointer(), beta,
+       y.getPointer());
+}
+
+void DenseLinearAlgebra::gemv(bool trans, double alpha, const double* A, size_t nrows,
+                              size_t ncols, const double* x, double beta, double* y) {
+  size_t m = trans ? ncols : nrows;
+
+  if (m == 0) {
+    return;
+  }
+
+#if defined(USE_LAPACK)
+  // the column major view of A is A', so the transposition flag is inverted
+  int rows = static_cast<int>(ncols);
+  int cols = static_cast<int>(nrows);
+  int lda = std::max(rows, 1);
+  int inc = 1;
+  dgemv_(trans ? "N" : "T", &rows, &cols, &alpha, A, &lda, x, &inc, &beta, y, &inc);
+#elif defined(USE_GSL)
+  size_t n = trans ? nrows : ncols;
+  gsl_matrix_const_view a = gsl_matrix_const_view_array(A, nrows, ncols);
+  gsl_vector_const_view xView = gsl_vector_const_view_array(x, n);
+  gsl_vector_view yView = gsl_vector_view_array(y, m);
+  gsl_blas_dgemv(trans ? CblasTrans : CblasNoTrans, alpha, &a.matrix, &xView.vector, beta,
+                 &yView.vector);
+#else
+  throw algorithm_exception("built without LAPACK and GSL");
+#endif
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,115 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <string>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Dense linear algebra kernels used by the offline and online phases of the DBMat density
+ * estimation. The backend is chosen at build time: if SG++ was built with USE_LAPACK, the
+ * kernels call the (blocked and usually multithreaded) routines of the LAPACK/BLAS
+ * implementation that was linked (e.g. OpenBLAS or MKL), otherwise they fall back to GSL.
+ * If neither is available, all kernels throw an algorithm_exception.
+ *
+ * All matrices are row major sgpp::base::DataMatrix objects.
+ */
+class DenseLinearAlgebra {
+ public:
+  /**
+   * @return true if a backend is available
+   */
+  static bool isAvailable();
+
+  /**
+   * @return name of the backend ("LAPACK", "GSL" or "none")
+   */
+  static std::string getBackendName();
+
+  /**
+   * Cholesky decomposition A = LL' of a symmetric positive definite matrix, done in place.
+   * Afterwards the lower triangle of the matrix holds L, the upper triangle is set to zero.
+   *
+   * @param matrix symmetric positive definite matrix, overwritten by L
+   */
+  static void choleskyDecomposition(sgpp::base::DataMatrix& matrix);
+
+  /**
+   * Computes the inverse of A = LL' from its Cholesky factor, done in place.
+   *
+   * @param matrix the lower triangular Cholesky factor L, overwritten by the (full, symmetric)
+   * inverse of LL'
+   */
+  static void choleskyInverse(sgpp::base::DataMatrix& matrix);
+
+  /**
+   * Computes the inverse of a general square matrix by LU decomposition with partial pivoting,
+   * done in place.
+   *
+   * @param matrix square matrix, overwritten by its inverse
+   */
+  static void inverse(sgpp::base::DataMatrix& matrix);
+
+  /**
+   * Computes all eigenvalues and eigenvectors of a symmetric matrix.
+   *
+   * @param matrix symmetric matrix, overwritten by the eigenvectors (one eigenvector per column)
+   * @param eigenvalues the eigenvalues (resized to the number of rows of the matrix)
+   */
+  static void symmetricEigen(sgpp::base::DataMatrix& matrix, sgpp::base::DataVector& eigenvalues);
+
+  /**
+   * General matrix matrix product C = alpha * op(A) * op(B) + beta * C
+   *
+   * @param transA use the transposed of A
+   * @param transB use the transposed of B
+   * @param alpha scalar factor of the product
+   * @param A left matrix
+   * @param B right matrix
+   * @param beta scalar factor of C
+   * @param C result matrix, has to have matching dimensions
+   */
+  static void gemm(bool transA, bool transB, double alpha, const sgpp::base::DataMatrix& A,
+                   const sgpp::base::DataMatrix& B, double beta, sgpp::base::DataMatrix& C);
+
+  /**
+   * General matrix vector product y = alpha * op(A) * x + beta * y. Only the leading entries of
+   * x and y that match the dimensions of op(A) are used.
+   *
+   * @param trans use the transposed of A
+   * @param alpha scalar factor of the product
+   * @param A the matrix
+   * @param x input vector, has to have at least as many entries as op(A) has columns
+   * @param beta scalar factor of y
+   * @param y result vector, has to have at least as many entries as op(A) has rows
+   */
+  static void gemv(bool trans, double alpha, const sgpp::base::DataMatrix& A,
+                   const sgpp::base::DataVector& x, double beta, sgpp::base::DataVector& y);
+
+  /**
+   * General matrix vector product y = alpha * op(A) * x + beta * y for a row major matrix given
+   * by a raw pointer, e.g. the leading rows of a larger DataMatrix.
+   *
+   * @param trans use the transposed of A
+   * @param alpha scalar factor of the product
+   * @param A pointer to the row major matrix entries
+   * @param nrows number of rows of A
+   * @param ncols number of columns of A
+   * @param x input vector with as many entries as op(A) has columns
+   * @param beta scalar factor of y
+   * @param y result vector with as many entries as op(A) has rows
+   */
+  static void gemv(bool trans, double alpha, const double* A, size_t nrows, size_t ncols,
+                   const double* x, double beta, double* y);
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -20,8 +20,7 @@ SystemMatrixLeastSquaresIdentity::SystemMatrixLeastSquaresIdentity(base::Grid& g
                                                                    double lambda)
     : DMSystemMatrixBase(trainData, lambda), instances(0), paddedInstances(0), grid(grid) {
   this->instances = this->dataset_.getNrows();
-  this->B.reset(op_factory::createOperationMultipleEval(grid, this->dataset_,
-                                                        this->implementationConfiguration));
+  createOperationB();
 
   // padded during Operator construction, fetch new size
   this->paddedInstances = this->dataset_.getNrows();
@@ -60,8 +59,17 @@ void SystemMatrixLeastSquaresIdentity::prepareGrid() { this->B->prepare(); }
 void SystemMatrixLeastSquaresIdentity::setImplementation(
     datadriven::OperationMultipleEvalConfiguration operationConfiguration) {
   this->implementationConfiguration = operationConfiguration;
+  createOperationB();
+}
+
+void SystemMatrixLeastSquaresIdentity::createOperationB() {
   this->B.reset(op_factory::createOperationMultipleEval(this->grid, this->dataset_,
                                                         this->implementationConfiguration));
+
+  if (this->implementationConfiguration.isMatrixCachingEnabled()) {
+    this->B->enableMatrixCaching(this->implementationConfiguration.getMatrixCacheMemoryBudget(),
+                                 this->implementationConfiguration.isMatrixCacheSinglePrecision());
+  }
 }
 
 }  // namespace datadriven
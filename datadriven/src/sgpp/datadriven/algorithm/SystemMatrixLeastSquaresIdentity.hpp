@@ -48,6 +48,12 @@ class SystemMatrixLeastSquaresIdentity : public datadriven::DMSystemMatrixBase {
 
   datadriven::OperationMultipleEvalConfiguration implementationConfiguration;
 
+  /**
+   * Creates the operation B for the current implementation configuration and enables the caching
+   * of its evaluation matrix if the configuration requests it.
+   */
+  void createOperationB();
+
  public:
   /**
    * Std-Constructor
@@ -70,6 +76,13 @@ class SystemMatrixLeastSquaresIdentity : public datadriven::DMSystemMatrixBase {
 
   virtual void prepareGrid();
 
+  /**
+   * Selects the implementation of the operation B. If matrix caching is enabled in the
+   * configuration, B is evaluated only once at the training data and the iterations of the solver
+   * apply the cached matrix.
+   *
+   * @param operationConfiguration configuration of the operation B
+   */
   void setImplementation(datadriven::OperationMultipleEvalConfiguration operationConfiguration);
 };
 
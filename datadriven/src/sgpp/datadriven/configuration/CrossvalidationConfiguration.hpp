@@ -38,6 +38,10 @@ struct CrossvalidationConfiguration {
   // must be > 1
   size_t lambdaSteps_;
   bool logScale_;  // search the optimization interval on a log-scale
+
+  // concurrent training of the folds
+  size_t parallelFolds_ = 1;   // number of folds trained concurrently
+  size_t threadsPerFold_ = 0;  // OpenMP threads per concurrent fold, 0: split threads evenly
 };
 
 }  // namespace datadriven
@@ -30,6 +30,12 @@ struct LearnerConfiguration {
    * (false corresponds to a uniform prior)
    */
   bool usePrior = false;
+
+  /**
+   * Determine if the densities of all classes should be learned on one common grid with a single
+   * system matrix decomposition (only for decomposition based density estimation)
+   */
+  bool sharedGrid = false;
 };
 }  // namespace datadriven
 }  // namespace sgpp
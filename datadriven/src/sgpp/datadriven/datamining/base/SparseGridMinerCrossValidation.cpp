@@ -14,11 +14,20 @@
 
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/datadriven/algorithm/RefinementMonitorFactory.hpp>
+#include <sgpp/datadriven/operation/hash/DatadrivenOperationCommon.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <exception>
 #include <iostream>
+#include <string>
 #include <vector>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace sgpp {
 namespace datadriven {
 
@@ -27,8 +36,6 @@ SparseGridMinerCrossValidation::SparseGridMinerCrossValidation(
     : SparseGridMiner(fitter, scorer), dataSource{dataSource} {}
 
 double SparseGridMinerCrossValidation::learn(bool verbose) {
-  // todo(fuchsgdk): see below
-
 #ifdef USE_SCALAPACK
   if (fitter->getFitterConfiguration().getParallelConfig().scalapackEnabled_) {
     auto processGrid = fitter->getProcessGrid();
@@ -41,6 +48,34 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
   const CrossvalidationConfiguration& crossValidationConfig =
       dataSource->getCrossValidationConfig();
 
+  std::vector<double> scores =
+      canLearnFoldsConcurrently() ? learnFoldsConcurrently(verbose) : learnFoldsSequentially(verbose);
+
+  // Calculate mean score and std deviation
+  double meanScore = 0.0;
+  for (size_t idx = 0; idx < scores.size(); idx++) {
+    meanScore += scores[idx];
+  }
+  meanScore /= static_cast<double>(scores.size());
+  double stdDeviation = 0.0;
+  for (size_t idx = 0; idx < scores.size(); idx++) {
+    stdDeviation += std::pow(scores[idx] - meanScore, 2);
+  }
+  stdDeviation = std::sqrt(stdDeviation / static_cast<double>(crossValidationConfig.kfold_ - 1));
+
+  std::ostringstream out;
+  out << "###############" << std::endl
+      << "Mean score: " << meanScore << std::endl
+      << "Standard deviation: " << stdDeviation;
+  print(out);
+  return meanScore;
+}
+
+std::vector<double> SparseGridMinerCrossValidation::learnFoldsSequentially(bool verbose) {
+  // todo(fuchsgdk): see below
+  const CrossvalidationConfiguration& crossValidationConfig =
+      dataSource->getCrossValidationConfig();
+
   std::vector<double> scores;
   scores.reserve(crossValidationConfig.kfold_);
 
@@ -60,8 +95,8 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
 
     // Create a refinement monitor for this fold
     RefinementMonitorFactory monitorFactory;
-    RefinementMonitor* monitor = monitorFactory.createRefinementMonitor(
-        fitter->getFitterConfiguration().getRefinementConfig());
+    std::unique_ptr<RefinementMonitor> monitor(monitorFactory.createRefinementMonitor(
+        fitter->getFitterConfiguration().getRefinementConfig()));
 
     // Reset the fitter
     fitter->reset();
@@ -86,73 +121,197 @@ double SparseGridMinerCrossValidation::learn(bool verbose) {
       size_t iteration = 0;
       while (true) {
         std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
-        size_t numInstances = dataset->getNumberInstances();
-        if (numInstances == 0) {
+        if (dataset->getNumberInstances() == 0) {
           // The source does not provide any more samples
           break;
         }
 
+        std::ostringstream out;
+        trainOnBatch(*fitter, *monitor, *dataset, *validationData, iteration++, verbose, out);
         if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Itertation #" << (iteration++) << std::endl
-              << "Batch size: " << numInstances;
           print(out);
         }
+      }
+    }
+    // Evaluate the final score on the validation data
+    dataSource->reset();
+    Dataset* validationData = dataSource->getValidationData();
+    scores.push_back(scorer->test(*fitter, *validationData));
+  }
 
-        // Train model on new batch
-        fitter->update(*dataset);
+  return scores;
+}
 
-        // Evaluate the score on the training and validation data
-        double scoreTrain = scorer->test(*fitter, *dataset);
-        double scoreVal = scorer->test(*fitter, *validationData);
+std::vector<double> SparseGridMinerCrossValidation::learnFoldsConcurrently(bool verbose) {
+  const CrossvalidationConfiguration& crossValidationConfig =
+      dataSource->getCrossValidationConfig();
+  size_t kfold = crossValidationConfig.kfold_;
+  size_t epochs = dataSource->getConfig().epochs;
 
-        if (verbose) {
-          std::ostringstream out;
-          out << "Score on batch: " << scoreTrain << std::endl
-              << "Score on validation data: " << scoreVal;
-          print(out);
-        }
+  // The data source is stateful and cannot be shared between the folds. As the shuffling is
+  // deterministic, every epoch of a fold sees the same batches, so they are read only once.
+  std::vector<Dataset> validationData(kfold);
+  std::vector<std::vector<std::unique_ptr<Dataset>>> batches(kfold);
+  for (size_t fold = 0; fold < kfold; fold++) {
+    dataSource->setFold(fold);
+    dataSource->reset();
+    validationData[fold] = *dataSource->getValidationData();
+    while (true) {
+      std::unique_ptr<Dataset> dataset(dataSource->getNextSamples());
+      if (dataset->getNumberInstances() == 0) {
+        break;
+      }
+      batches[fold].push_back(std::move(dataset));
+    }
+  }
 
-        // Refine the model if neccessary
-        monitor->pushToBuffer(numInstances, scoreVal, scoreTrain);
-        size_t refinements = monitor->refinementsNecessary();
-        while (refinements--) {
-          fitter->refine();
-        }
+  std::vector<std::unique_ptr<ModelFittingBase>> models(kfold);
+  for (size_t fold = 0; fold < kfold; fold++) {
+    models[fold].reset(fitter->createNewInstance());
+  }
+
+  std::vector<double> scores(kfold);
+  std::vector<std::string> logs(kfold);
+  std::exception_ptr error;
+
+  int numFoldThreads = static_cast<int>(std::min(crossValidationConfig.parallelFolds_, kfold));
+#ifdef _OPENMP
+  // split the available threads evenly between the folds if not specified otherwise
+  int threadsPerFold = crossValidationConfig.threadsPerFold_ > 0
+                           ? static_cast<int>(crossValidationConfig.threadsPerFold_)
+                           : std::max(1, omp_get_max_threads() / numFoldThreads);
+  int maxActiveLevels = omp_get_max_active_levels();
+  omp_set_max_active_levels(std::max(maxActiveLevels, omp_get_active_level() + 2));
+#endif
 
+#pragma omp parallel for num_threads(numFoldThreads) schedule(dynamic, 1)
+  for (size_t fold = 0; fold < kfold; fold++) {
+#ifdef _OPENMP
+    // applies to all parallel regions started by this thread, i.e. the fitter of this fold
+    omp_set_num_threads(threadsPerFold);
+#endif
+    try {
+      ModelFittingBase& model = *models[fold];
+      RefinementMonitorFactory monitorFactory;
+      std::unique_ptr<RefinementMonitor> monitor(monitorFactory.createRefinementMonitor(
+          model.getFitterConfiguration().getRefinementConfig()));
+
+      std::ostringstream out;
+      out << "###############"
+          << "Fold #" << fold;
+
+      for (size_t epoch = 0; epoch < epochs; epoch++) {
         if (verbose) {
-          std::ostringstream out;
-          out << "###############"
-              << "Iteration finished.";
-          print(out);
+          out << std::endl
+              << "###############"
+              << "Starting training epoch #" << epoch << std::endl
+              << "Validation data size: " << validationData[fold].getNumberInstances();
+        }
+        for (size_t iteration = 0; iteration < batches[fold].size(); iteration++) {
+          std::ostringstream batchOut;
+          trainOnBatch(model, *monitor, *batches[fold][iteration], validationData[fold], iteration,
+                       verbose, batchOut);
+          if (verbose) {
+            out << std::endl << batchOut.str();
+          }
+        }
+      }
+      scores[fold] = scorer->test(model, validationData[fold]);
+      logs[fold] = out.str();
+    } catch (...) {
+#pragma omp critical
+      {
+        if (!error) {
+          error = std::current_exception();
         }
       }
     }
-    // Evaluate the final score on the validation data
-    dataSource->reset();
-    Dataset* validationData = dataSource->getValidationData();
-    scores.push_back(scorer->test(*fitter, *validationData));
   }
 
-  // Calculate mean score and std deviation
-  double meanScore = 0.0;
-  for (size_t idx = 0; idx < scores.size(); idx++) {
-    meanScore += scores[idx];
+#ifdef _OPENMP
+  omp_set_max_active_levels(maxActiveLevels);
+#endif
+
+  if (error) {
+    std::rethrow_exception(error);
   }
-  meanScore /= static_cast<double>(scores.size());
-  double stdDeviation = 0.0;
-  for (size_t idx = 0; idx < scores.size(); idx++) {
-    stdDeviation += std::pow(scores[idx] - meanScore, 2);
+
+  for (size_t fold = 0; fold < kfold; fold++) {
+    print(logs[fold]);
   }
-  stdDeviation = std::sqrt(stdDeviation / static_cast<double>(crossValidationConfig.kfold_ - 1));
 
-  std::ostringstream out;
-  out << "###############" << std::endl
-      << "Mean score: " << meanScore << std::endl
-      << "Standard deviation: " << stdDeviation;
-  print(out);
-  return meanScore;
+  // as in the sequential case, the fitter of the miner holds the model of the last fold
+  fitter = std::move(models[kfold - 1]);
+  return scores;
 }
+
+bool SparseGridMinerCrossValidation::canLearnFoldsConcurrently() const {
+  const CrossvalidationConfiguration& crossValidationConfig =
+      dataSource->getCrossValidationConfig();
+  if (crossValidationConfig.parallelFolds_ <= 1 || crossValidationConfig.kfold_ <= 1) {
+    return false;
+  }
+
+  const FitterConfiguration& fitterConfig = fitter->getFitterConfiguration();
+  if (fitterConfig.getParallelConfig().scalapackEnabled_) {
+    return false;
+  }
+
+  // accelerator backends share their devices and are not split between folds
+  OperationMultipleEvalConfiguration multipleEvalConfig = fitterConfig.getMultipleEvalConfig();
+  switch (multipleEvalConfig.getSubType()) {
+    case OperationMultipleEvalSubType::OCL:
+    case OperationMultipleEvalSubType::OCLFASTMP:
+    case OperationMultipleEvalSubType::OCLMP:
+    case OperationMultipleEvalSubType::OCLMASKMP:
+    case OperationMultipleEvalSubType::OCLOPT:
+    case OperationMultipleEvalSubType::OCLUNIFIED:
+    case OperationMultipleEvalSubType::CUDA:
+      return false;
+    default:
+      break;
+  }
+
+  std::unique_ptr<ModelFittingBase> probe(fitter->createNewInstance());
+  return probe != nullptr;
+}
+
+void SparseGridMinerCrossValidation::trainOnBatch(ModelFittingBase& model,
+                                                  RefinementMonitor& monitor, Dataset& batch,
+                                                  Dataset& validationData, size_t iteration,
+                                                  bool verbose, std::ostringstream& log) const {
+  size_t numInstances = batch.getNumberInstances();
+
+  if (verbose) {
+    log << "###############"
+        << "Itertation #" << iteration << std::endl
+        << "Batch size: " << numInstances << std::endl;
+  }
+
+  // Train model on new batch
+  model.update(batch);
+
+  // Evaluate the score on the training and validation data
+  double scoreTrain = scorer->test(model, batch);
+  double scoreVal = scorer->test(model, validationData);
+
+  if (verbose) {
+    log << "Score on batch: " << scoreTrain << std::endl
+        << "Score on validation data: " << scoreVal << std::endl;
+  }
+
+  // Refine the model if neccessary
+  monitor.pushToBuffer(numInstances, scoreVal, scoreTrain);
+  size_t refinements = monitor.refinementsNecessary();
+  while (refinements--) {
+    model.refine();
+  }
+
+  if (verbose) {
+    log << "###############"
+        << "Iteration finished.";
+  }
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -16,15 +16,22 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceCrossValidation.hpp>
 
 #include <memory>
+#include <sstream>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
 
+class RefinementMonitor;
+
 /**
  * SparseGridMinerCrossValidation models a datamining process that involves cross validation to
  * validate the accuracy of the model itself. This process it slow and memory consuming and only
  * recommended for small datasets.
  *
+ * If the cross validation configuration requests more than one parallel fold and the fitter can
+ * create untrained copies of itself, several folds are trained concurrently, each one with its own
+ * fitter and its own (nested) OpenMP thread team. The scores are still reported in fold order.
  */
 class SparseGridMinerCrossValidation : public SparseGridMiner {
  public:
@@ -78,6 +85,46 @@ class SparseGridMinerCrossValidation : public SparseGridMiner {
   double learn(bool verbose) override;
 
  private:
+  /**
+   * Train and score the folds one after another with the fitter of the miner.
+   * @param verbose print information on the training of each batch
+   * @return the final validation scores of the folds
+   */
+  std::vector<double> learnFoldsSequentially(bool verbose);
+
+  /**
+   * Train and score several folds concurrently. The validation data and the training batches of
+   * all folds are read from the data source beforehand, then each fold is trained with its own
+   * untrained copy of the fitter. The log output of each fold is buffered and printed in fold
+   * order.
+   * @param verbose print information on the training of each batch
+   * @return the final validation scores of the folds
+   */
+  std::vector<double> learnFoldsConcurrently(bool verbose);
+
+  /**
+   * Check whether the folds can be trained concurrently, i.e. more than one parallel fold was
+   * configured, the fitter supports untrained copies and neither ScaLAPACK nor an accelerator
+   * backend for the multiple evaluation is used.
+   * @return true if learnFoldsConcurrently can be used
+   */
+  bool canLearnFoldsConcurrently() const;
+
+  /**
+   * Train a model on one batch of a fold, evaluate it on the batch and the validation data and
+   * refine it if the refinement monitor demands it.
+   * @param model the model of the fold
+   * @param monitor the refinement monitor of the fold
+   * @param batch the training batch
+   * @param validationData the validation data of the fold
+   * @param iteration number of the batch within the epoch
+   * @param verbose write information on the training to the log
+   * @param log stream the information is written to
+   */
+  void trainOnBatch(ModelFittingBase& model, RefinementMonitor& monitor, Dataset& batch,
+                    Dataset& validationData, size_t iteration, bool verbose,
+                    std::ostringstream& log) const;
+
   /**
    * DataSource provides samples that will be used by fitter to generalize data and scorer to
    * validate and assess model robustness.
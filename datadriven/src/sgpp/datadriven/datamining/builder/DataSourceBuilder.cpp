@@ -76,9 +76,9 @@ DataSourceSplitting* DataSourceBuilder::splittingAssemble() const {
   SampleProvider* sampleProvider = nullptr;
 
   if (config.fileType == DataSourceFileType::ARFF) {
-    sampleProvider = new ArffFileSampleProvider(shuffling);
+    sampleProvider = new ArffFileSampleProvider(shuffling, config.shuffleOncePerEpoch);
   } else if (config.fileType == DataSourceFileType::CSV) {
-    sampleProvider = new CSVFileSampleProvider(shuffling);
+    sampleProvider = new CSVFileSampleProvider(shuffling, config.shuffleOncePerEpoch);
   } else {
     data_exception("Unknown file type");
   }
@@ -114,9 +114,11 @@ DataSourceCrossValidation* DataSourceBuilder::crossValidationAssemble() const {
   SampleProvider* sampleProvider = nullptr;
 
   if (config.fileType == DataSourceFileType::ARFF) {
-    sampleProvider = new ArffFileSampleProvider(crossValidationShuffling);
+    sampleProvider =
+        new ArffFileSampleProvider(crossValidationShuffling, config.shuffleOncePerEpoch);
   } else if (config.fileType == DataSourceFileType::CSV) {
-    sampleProvider = new CSVFileSampleProvider(crossValidationShuffling);
+    sampleProvider =
+        new CSVFileSampleProvider(crossValidationShuffling, config.shuffleOncePerEpoch);
   } else {
     data_exception("Unknown file type");
   }
@@ -58,13 +58,19 @@ ModelFittingBase *DensityEstimationMinerFactory::createFitter(
 
 HyperparameterOptimizer *DensityEstimationMinerFactory::buildHPO(const std::string &path) const {
   DataMiningConfigParser parser(path);
+  HyperparameterOptimizer *hpo;
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path),
-                                                new DensityEstimationFitterFactory(parser), parser);
+    hpo = new HarmonicaHyperparameterOptimizer(buildMiner(path),
+                                               new DensityEstimationFitterFactory(parser), parser);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path),
-                                         new DensityEstimationFitterFactory(parser), parser);
+    hpo = new BoHyperparameterOptimizer(buildMiner(path),
+                                        new DensityEstimationFitterFactory(parser), parser);
   }
+  // additional miners to evaluate trials concurrently
+  for (size_t i = 1; i < hpo->getNumWorkers(); i++) {
+    hpo->addWorkerMiner(buildMiner(path));
+  }
+  return hpo;
 }
 FitterFactory *DensityEstimationMinerFactory::createFitterFactory(
     const DataMiningConfigParser &parser) const {
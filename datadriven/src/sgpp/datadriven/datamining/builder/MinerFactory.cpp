@@ -42,12 +42,18 @@ SparseGridMiner* MinerFactory::buildMiner(const std::string& path) const {
 
 sgpp::datadriven::HyperparameterOptimizer* MinerFactory::buildHPO(const std::string& path) const {
   DataMiningConfigParser parser(path);
+  HyperparameterOptimizer* hpo;
   if (parser.getHPOMethod("bayesian") == "harmonica") {
-    return new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
-                                                parser);
+    hpo = new HarmonicaHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser),
+                                               parser);
   } else {
-    return new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
+    hpo = new BoHyperparameterOptimizer(buildMiner(path), createFitterFactory(parser), parser);
   }
+  // additional miners to evaluate trials concurrently
+  for (size_t i = 1; i < hpo->getNumWorkers(); i++) {
+    hpo->addWorkerMiner(buildMiner(path));
+  }
+  return hpo;
 }
 
 DataSourceSplitting* MinerFactory::createDataSourceSplitting(
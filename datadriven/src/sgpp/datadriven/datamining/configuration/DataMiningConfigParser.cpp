@@ -156,6 +156,12 @@ bool DataMiningConfigParser::getDataSourceConfig(DataSourceConfig &config,
 
     config.randomSeed =
         parseUInt(*dataSourceConfig, "randomSeed", defaults.randomSeed, "dataSource");
+    config.shuffleOncePerEpoch = parseBool(*dataSourceConfig, "shuffleOncePerEpoch",
+                                           defaults.shuffleOncePerEpoch, "dataSource");
+    config.prefetchBatches =
+        parseUInt(*dataSourceConfig, "prefetchBatches", defaults.prefetchBatches, "dataSource");
+    config.loaderThreads =
+        parseUInt(*dataSourceConfig, "loaderThreads", defaults.loaderThreads, "dataSource");
     config.epochs = parseUInt(*dataSourceConfig, "epochs", defaults.epochs, "dataSource");
 
     // Parse info for test data
@@ -380,6 +386,10 @@ bool DataMiningConfigParser::getFitterCrossvalidationConfig(
         parseUInt(*crossvalidationConfig, "lambdaSteps", defaults.lambdaSteps_, "crossValidation");
     config.logScale_ =
         parseBool(*crossvalidationConfig, "logScale", defaults.logScale_, "crossValidation");
+    config.parallelFolds_ = parseUInt(*crossvalidationConfig, "parallelFolds",
+                                      defaults.parallelFolds_, "crossValidation");
+    config.threadsPerFold_ = parseUInt(*crossvalidationConfig, "threadsPerFold",
+                                       defaults.threadsPerFold_, "crossValidation");
   } else {
     std::cout << "# Could not find specification  of fitter[crossvalidationConfig]. Falling "
                  "Back to default values."
@@ -777,6 +787,8 @@ void DataMiningConfigParser::getHPOConfig(HPOConfig &config) {
     auto node = static_cast<DictNode *>(&(*configFile)["hpo"]);
     config.setSeed(parseInt(*node, "randomSeed", config.getSeed(), "hpo"));
     config.setNTrainSamples(parseInt(*node, "trainSize", config.getNTrainSamples(), "hpo"));
+    config.setNParallelTrials(
+        parseInt(*node, "parallelTrials", config.getNParallelTrials(), "hpo"));
     if (node->contains("harmonica")) {
       auto harmonica = static_cast<DictNode *>(&(*node)["harmonica"]);
       config.setLambda(parseDouble(*harmonica, "lambda", config.getLambda(), "hpo"));
@@ -885,6 +897,8 @@ bool DataMiningConfigParser::getFitterLearnerConfig(
 
     config.beta = parseDouble(*learnerConfig, "beta", defaults.beta, "learnerConfig");
     config.usePrior = parseBool(*learnerConfig, "usePrior", defaults.usePrior, "learnerConfig");
+    config.sharedGrid =
+        parseBool(*learnerConfig, "sharedGrid", defaults.sharedGrid, "learnerConfig");
   }
 
   return hasLearnerConfig;
@@ -31,6 +31,8 @@ SLESolverType sgpp::datadriven::SLESolverTypeParser::parse(const std::string &in
     return sgpp::solver::SLESolverType::BiCGSTAB;
   } else if (inputLower.compare("fista") == 0) {
     return sgpp::solver::SLESolverType::FISTA;
+  } else if (inputLower.compare("pipelinedcg") == 0) {
+    return sgpp::solver::SLESolverType::PipelinedCG;
   } else {
     std::string errorMsg = "Failed to convert string \"" + input + "\" to any known SLESolverType";
     throw base::data_exception(errorMsg.c_str());
@@ -45,7 +47,9 @@ const SLESolverTypeParser::SLESolverTypeMap_t SLESolverTypeParser::sleSolverType
   return SLESolverTypeParser::SLESolverTypeMap_t{std::make_pair(SLESolverType::CG, "CG"),
                                                  std::make_pair(SLESolverType::BiCGSTAB,
                                                                 "BiCGSTAB"),
-                                                 std::make_pair(SLESolverType::FISTA, "FISTA")};
+                                                 std::make_pair(SLESolverType::FISTA, "FISTA"),
+                                                 std::make_pair(SLESolverType::PipelinedCG,
+                                                                "PipelinedCG")};
 }();
 } /* namespace datadriven */
 } /* namespace sgpp */
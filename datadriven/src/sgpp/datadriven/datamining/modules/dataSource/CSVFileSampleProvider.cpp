@@ -15,6 +15,8 @@
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/base/exception/file_exception.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorCrossValidation.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorSequential.hpp>
 #include <sgpp/datadriven/tools/CSVTools.hpp>
 
 #include <string>
@@ -24,8 +26,14 @@ namespace sgpp {
 
 namespace datadriven {
 
-CSVFileSampleProvider::CSVFileSampleProvider(DataShufflingFunctor *shuffling)
-    : shuffling{shuffling}, dataset(Dataset{}), counter(0) {}
+CSVFileSampleProvider::CSVFileSampleProvider(DataShufflingFunctor *shuffling,
+                                             bool shuffleOncePerEpoch)
+    : shuffling{shuffling},
+      dataset(Dataset{}),
+      shuffleOncePerEpoch{shuffleOncePerEpoch},
+      shuffledDataset(Dataset{}),
+      shuffledFold(0),
+      counter(0) {}
 
 SampleProvider* CSVFileSampleProvider::clone() const {
   return dynamic_cast<SampleProvider*>(new CSVFileSampleProvider{*this});
@@ -61,6 +69,7 @@ void CSVFileSampleProvider::readFile(const std::string& fileName,
     // exception safe implementation.
     throw base::data_exception{"Failed to parse CSV File."};
   }
+  shuffledDataset = Dataset{};
 }
 
 Dataset* CSVFileSampleProvider::getNextSamples(size_t howMany) {
@@ -94,26 +103,39 @@ void CSVFileSampleProvider::readString(const std::string& input,
 }
 
 Dataset* CSVFileSampleProvider::splitDataset(size_t howMany) {
-  const size_t size = counter + howMany <= dataset.getNumberInstances()
-                          ? howMany
-                          : dataset.getNumberInstances() - counter;
+  const size_t numInstances = dataset.getNumberInstances();
+  const size_t size = counter + howMany <= numInstances ? howMany : numInstances - counter;
   auto tmpDataset = std::make_unique<Dataset>(size, dataset.getDimension());
 
-  base::DataMatrix& srcSamples = dataset.getData();
-  base::DataVector& srcTargets = dataset.getTargets();
-
-  base::DataMatrix& destSamples = tmpDataset->getData();
-  base::DataVector& destTargets = tmpDataset->getTargets();
-
-  base::DataVector tmpRow{srcSamples.getNcols()};
-
-  // copy "size" rows beginning from "counter" to the new dataset.
-  for (size_t i = counter; i < counter + size; ++i) {
-    size_t srcIdx = shuffling != nullptr ? (*shuffling)(i, dataset.getNumberInstances()) : i;
-    srcSamples.getRow(srcIdx, tmpRow);
-    destSamples.setRow(i - counter, tmpRow);
+  if (size == 0) {
+    // the epoch is exhausted
+    return tmpDataset.release();
+  }
 
-    destTargets[i - counter] = srcTargets[srcIdx];
+  if (shuffling == nullptr || dynamic_cast<DataShufflingFunctorSequential*>(shuffling) != nullptr) {
+    // the samples are taken in the order of the file
+    tmpDataset->copyInstances(dataset, counter);
+  } else if (shuffleOncePerEpoch) {
+    // the permutation does not change between epochs, so the permuted dataset is built once
+    // and reused; only the cross validation functor permutes differently for each fold
+    auto crossValidation = dynamic_cast<DataShufflingFunctorCrossValidation*>(shuffling);
+    const size_t fold = crossValidation != nullptr ? crossValidation->getFold() : 0;
+    if (shuffledDataset.getNumberInstances() != numInstances || fold != shuffledFold) {
+      std::vector<size_t> indices(numInstances);
+      for (size_t i = 0; i < numInstances; ++i) {
+        indices[i] = (*shuffling)(i, numInstances);
+      }
+      shuffledDataset = Dataset(numInstances, dataset.getDimension());
+      shuffledDataset.copyInstances(dataset, indices);
+      shuffledFold = fold;
+    }
+    tmpDataset->copyInstances(shuffledDataset, counter);
+  } else {
+    std::vector<size_t> indices(size);
+    for (size_t i = 0; i < size; ++i) {
+      indices[i] = (*shuffling)(counter + i, numInstances);
+    }
+    tmpDataset->copyInstances(dataset, indices);
   }
   counter = counter + size;
 
@@ -33,8 +33,12 @@ class CSVFileSampleProvider : public FileSampleProvider {
   /**
    * Default constructor
    * @param shuffling functor to permute the training data indexes
+   * @param shuffleOncePerEpoch permute the whole dataset once into a buffer that is reused by all
+   * epochs, so that the batches are contiguous blocks of that buffer (needs memory for a second
+   * copy of the dataset)
    */
-  explicit CSVFileSampleProvider(DataShufflingFunctor *shuffling = nullptr);
+  explicit CSVFileSampleProvider(DataShufflingFunctor *shuffling = nullptr,
+                                 bool shuffleOncePerEpoch = false);
 
   /**
    * Clone Pattern to allow copying of derived classes.
@@ -96,6 +100,23 @@ class CSVFileSampleProvider : public FileSampleProvider {
    */
   Dataset dataset;
 
+  /**
+   * Take the batches from a permuted copy of the whole dataset instead of permuting the samples
+   * of each batch
+   */
+  bool shuffleOncePerEpoch;
+
+  /**
+   * The permuted dataset if shuffleOncePerEpoch is set. It is built on first use and rebuilt only
+   * after a new dataset was read or the cross validation fold changed.
+   */
+  Dataset shuffledDataset;
+
+  /**
+   * The cross validation fold shuffledDataset was permuted for
+   */
+  size_t shuffledFold;
+
   /**
    * Indicates the index in dataset where #getNextSamples will start grabbing new samples in its
    * next call. After each call of #getNextSamples, the counter is set to the amount of min(counter
@@ -107,6 +128,8 @@ class CSVFileSampleProvider : public FileSampleProvider {
    * Helper member function for #getNextSamples. Linearly walks through dataset, beginning at
    * counter and returns a pointer to a new instance of #sgpp::datadriven::Dataset containing the
    * desired amount of samples (if available - else all remaining samples) and updates counter.
+   * Unshuffled batches and batches of the permuted dataset are copied as one block, otherwise the
+   * samples are gathered row by row.
    */
   Dataset *splitDataset(size_t howMany);
 };
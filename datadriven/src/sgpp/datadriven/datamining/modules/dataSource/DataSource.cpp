@@ -26,7 +26,10 @@ namespace sgpp {
 namespace datadriven {
 
 DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
-    : config(conf), currentIteration(0), sampleProvider(std::unique_ptr<SampleProvider>(sp)) {
+    : config(conf),
+      currentIteration(0),
+      sampleProvider(std::unique_ptr<SampleProvider>(sp)),
+      dataTransformationInitialized(false) {
   // if a file name was specified, we are reading from a file, so we need to open it.
   if (!this->config.filePath.empty()) {
     std::cout << "Read file " << config.filePath << std::endl;
@@ -37,6 +40,14 @@ DataSource::DataSource(DataSourceConfig conf, SampleProvider* sp)
   // Build data transformation
   DataTransformationBuilder dataTrBuilder;
   dataTransformation = dataTrBuilder.buildTransformation(conf.dataTransformationConfig);
+
+  // Prefetching only pays off if the data is processed in several batches
+  if (config.prefetchBatches > 0 && config.batchSize > 0) {
+    prefetcher = std::make_unique<DataSourcePrefetcher>(
+        [this]() { return readNextSamples(); },
+        [this](Dataset* dataset) { return transformSamples(dataset); }, config.prefetchBatches,
+        config.loaderThreads);
+  }
 }
 
 DataSourceIterator DataSource::begin() { return DataSourceIterator(*this, 0); }
@@ -44,37 +55,57 @@ DataSourceIterator DataSource::begin() { return DataSourceIterator(*this, 0); }
 DataSourceIterator DataSource::end() { return DataSourceIterator(*this, config.numBatches); }
 
 Dataset* DataSource::getNextSamples() {
+  currentIteration++;
+
+  if (prefetcher) {
+    return prefetcher->getNextSamples();
+  }
+
+  // only one iteration: we want all samples and (re)initialize the transformation on them
+  if (config.numBatches == 1 && config.batchSize == 0) {
+    dataTransformationInitialized = false;
+  }
+
+  return transformSamples(readNextSamples());
+}
+
+Dataset* DataSource::readNextSamples() {
   Dataset* dataset = nullptr;
 
   // only one iteration: we want all samples
   if (config.numBatches == 1 && config.batchSize == 0) {
-    currentIteration++;
     dataset = sampleProvider->getAllSamples();
-
-    // Transform dataset if wanted
-    if (!(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
-      dataTransformation->initialize(dataset, config.dataTransformationConfig);
-      return dataTransformation->doTransformation(dataset);
-    } else {
-      return dataset;
-    }
     // several iterations
   } else {
     dataset = sampleProvider->getNextSamples(config.batchSize);
-    currentIteration++;
-
-    // If data transformation wanted and first batch -> initialize transformation
-    if (currentIteration == 1 &&
-        !(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
-      dataTransformation->initialize(dataset, config.dataTransformationConfig);
-      return dataTransformation->doTransformation(dataset);
-    }
-
-    // Transform dataset if wanted
-    if (!(config.dataTransformationConfig.type == DataTransformationType::NONE))
-      return dataTransformation->doTransformation(dataset);
-    else
-      return dataset;
+  }
+
+  // If data transformation wanted and first batch -> initialize transformation
+  if (!dataTransformationInitialized &&
+      !(config.dataTransformationConfig.type == DataTransformationType::NONE)) {
+    dataTransformation->initialize(dataset, config.dataTransformationConfig);
+    dataTransformationInitialized = true;
+  }
+
+  return dataset;
+}
+
+Dataset* DataSource::transformSamples(Dataset* dataset) {
+  // Transform dataset if wanted
+  if (config.dataTransformationConfig.type == DataTransformationType::NONE) {
+    return dataset;
+  }
+
+  Dataset* transformed = dataTransformation->doTransformation(dataset);
+  if (transformed != dataset) {
+    delete dataset;
+  }
+  return transformed;
+}
+
+void DataSource::stopPrefetching() {
+  if (prefetcher) {
+    prefetcher->stop();
   }
 }
 
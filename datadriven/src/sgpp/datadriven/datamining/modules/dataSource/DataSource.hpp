@@ -13,10 +13,12 @@
 
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataSourceIterator.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourcePrefetcher.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/DataTransformation.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/SampleProvider.hpp>
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <memory>
 #include <string>
 
 namespace sgpp {
@@ -48,7 +50,8 @@ class DataSource {
 
   /**
    * Request data from the underlying SampleProvider as specified in the provided configuration
-   * object upon construction.
+   * object upon construction. If prefetching is enabled in the configuration, the batch was
+   * already read and transformed in the background.
    * @return #sgpp::datadriven::Dataset containing requested amount of samples (if available).
    */
   virtual Dataset* getNextSamples();
@@ -82,6 +85,26 @@ class DataSource {
   virtual Dataset *getValidationData() = 0;
 
  protected:
+  /**
+   * Reads the next batch from the sample provider without transforming it. Initializes the data
+   * transformation on the first batch.
+   * @return the untransformed batch, owned by the caller
+   */
+  Dataset* readNextSamples();
+
+  /**
+   * Applies the data transformation (if any) to a batch.
+   * @param dataset the batch, ownership is taken
+   * @return the transformed batch, owned by the caller
+   */
+  Dataset* transformSamples(Dataset* dataset);
+
+  /**
+   * Stops the background loaders (if prefetching is enabled) and discards the batches they read
+   * ahead. Has to be called before the sample provider is reset.
+   */
+  void stopPrefetching();
+
   /**
    * Configuration file that determines all relevant properties of the object.
    */
@@ -101,6 +124,18 @@ class DataSource {
    * pointer to DataTransformation to perform transformations on init.
    */
   DataTransformation* dataTransformation;
+
+  /**
+   * whether the data transformation was initialized on the first batch.
+   */
+  bool dataTransformationInitialized;
+
+  /**
+   * background loaders that read and transform the next batches ahead of time, null if
+   * prefetching is disabled. Declared last, so that the loaders are stopped before the sample
+   * provider is destroyed.
+   */
+  std::unique_ptr<DataSourcePrefetcher> prefetcher;
 };
 
 } /* namespace datadriven */
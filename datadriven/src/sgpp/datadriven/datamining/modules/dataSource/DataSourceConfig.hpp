@@ -77,6 +77,21 @@ struct DataSourceConfig {
    * Seed for the shuffling prng
    */
   int64_t randomSeed = -1;
+  /**
+   * Permute the whole dataset once per epoch into a buffer, so that the batches are contiguous
+   * blocks of it instead of being gathered sample by sample (needs a second copy of the dataset)
+   */
+  bool shuffleOncePerEpoch = false;
+  /**
+   * How many batches are read and transformed ahead of time by background loader threads while
+   * the model is trained on the current batch - if 0, the batches are read on request
+   */
+  size_t prefetchBatches = 0;
+  /**
+   * Number of background threads that read and transform the prefetched batches. Reading from
+   * the file is serialized, the data transformations run concurrently.
+   */
+  size_t loaderThreads = 1;
   /**
    * The number of epochs to train on
    */
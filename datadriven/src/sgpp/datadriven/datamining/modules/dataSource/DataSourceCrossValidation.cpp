@@ -34,6 +34,7 @@ Dataset* DataSourceCrossValidation::getValidationData() {
 }
 
 void DataSourceCrossValidation::reset() {
+  stopPrefetching();
   sampleProvider->reset();
 
   // Retrieve validation data again
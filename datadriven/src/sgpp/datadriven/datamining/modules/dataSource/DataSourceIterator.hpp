@@ -52,9 +52,9 @@ class DataSourceIterator {
   /**
    * Dereferencing an iterator yields the object the iterator currently points to.
    * @return: A Pointer to a new #sgpp::datadriven::Dataset. It is generated by the
-   * #sgpp::datadriven::DataSource which provides the data which might change its state. The
-   * #sgpp::datadriven::Dataset is owned
-   * by the caller.
+   * #sgpp::datadriven::DataSource which provides the data which might change its state. If the
+   * source prefetches batches, it was read and transformed in the background. The
+   * #sgpp::datadriven::Dataset is owned by the caller.
    */
   Dataset *operator*();
 
@@ -0,0 +1,145 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourcePrefetcher.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace sgpp {
+namespace datadriven {
+
+DataSourcePrefetcher::DataSourcePrefetcher(std::function<Dataset*()> readBatch,
+                                           std::function<Dataset*(Dataset*)> transformBatch,
+                                           size_t capacity, size_t numLoaderThreads)
+    : readBatch(readBatch),
+      transformBatch(transformBatch),
+      capacity(std::max<size_t>(capacity, 1)),
+      numLoaderThreads(std::max<size_t>(numLoaderThreads, 1)),
+      nextRead(0),
+      nextConsumed(0),
+      exhausted(false),
+      cancelled(false) {}
+
+DataSourcePrefetcher::~DataSourcePrefetcher() { stop(); }
+
+Dataset* DataSourcePrefetcher::getNextSamples() {
+  if (loaders.empty()) {
+    for (size_t i = 0; i < numLoaderThreads; i++) {
+      loaders.emplace_back(&DataSourcePrefetcher::load, this);
+    }
+  }
+
+  std::unique_ptr<Dataset> batch;
+  std::exception_ptr failure;
+  {
+    std::unique_lock<std::mutex> lock(queueMutex);
+    batchReady.wait(lock, [this]() { return batches.count(nextConsumed) > 0; });
+    auto it = batches.find(nextConsumed);
+    batch = std::move(it->second);
+    batches.erase(it);
+    nextConsumed++;
+    failure = error;
+  }
+  slotFree.notify_all();
+
+  // the loaders are done after the last batch of the epoch, join them so that the next request
+  // starts over (e.g. after the source was reset)
+  if (!batch || batch->getNumberInstances() == 0) {
+    stop();
+
+    if (!batch) {
+      std::rethrow_exception(failure);
+    }
+  }
+
+  return batch.release();
+}
+
+void DataSourcePrefetcher::stop() {
+  {
+    std::lock_guard<std::mutex> lock(queueMutex);
+    cancelled = true;
+  }
+  slotFree.notify_all();
+
+  for (auto& loader : loaders) {
+    loader.join();
+  }
+
+  loaders.clear();
+  batches.clear();
+  nextRead = 0;
+  nextConsumed = 0;
+  exhausted = false;
+  cancelled = false;
+  error = nullptr;
+}
+
+void DataSourcePrefetcher::load() {
+  while (true) {
+    size_t sequence;
+    std::unique_ptr<Dataset> batch;
+    std::exception_ptr failure;
+
+    {
+      std::lock_guard<std::mutex> readLock(readMutex);
+      {
+        std::unique_lock<std::mutex> lock(queueMutex);
+        slotFree.wait(lock, [this]() {
+          return cancelled || exhausted || nextRead - nextConsumed < capacity;
+        });
+
+        if (cancelled || exhausted) {
+          return;
+        }
+
+        sequence = nextRead++;
+      }
+
+      try {
+        batch.reset(readBatch());
+      } catch (...) {
+        failure = std::current_exception();
+      }
+
+      if (failure || batch->getNumberInstances() == 0) {
+        std::lock_guard<std::mutex> lock(queueMutex);
+        exhausted = true;
+      }
+    }
+
+    if (!failure) {
+      try {
+        Dataset* transformed = transformBatch(batch.get());
+        // the transformation took ownership of the batch that was read
+        batch.release();
+        batch.reset(transformed);
+      } catch (...) {
+        failure = std::current_exception();
+        batch.reset();
+      }
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(queueMutex);
+
+      if (failure) {
+        if (!error) {
+          error = failure;
+        }
+
+        exhausted = true;
+      }
+
+      batches[sequence] = std::move(batch);
+    }
+    batchReady.notify_all();
+    slotFree.notify_all();
+  }
+}
+
+} /* namespace datadriven */
+} /* namespace sgpp */
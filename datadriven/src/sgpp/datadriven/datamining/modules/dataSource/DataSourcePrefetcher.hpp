@@ -0,0 +1,152 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Reads and transforms the batches of a #sgpp::datadriven::DataSource in background threads, so
+ * that I/O, parsing and data transformations overlap with the training on the current batch.
+ *
+ * The loader threads put the batches into a bounded queue. Reading from the (stateful) source is
+ * serialized, the transformation of the batches that were read runs concurrently on all loader
+ * threads. The batches are handed out in the order in which they were read. The loaders stop as
+ * soon as the source returns an empty batch, i.e. at the end of an epoch, and are started again
+ * by the next request.
+ */
+class DataSourcePrefetcher {
+ public:
+  /**
+   * Constructor
+   * @param readBatch reads the next (untransformed) batch from the source, empty if the source
+   * is exhausted. Never called concurrently.
+   * @param transformBatch transforms a batch that was read, takes ownership of it and returns the
+   * transformed batch. If it throws, the batch is still owned (and freed) by the prefetcher. Called
+   * concurrently if there is more than one loader thread.
+   * @param capacity maximum number of batches that are read ahead of the consumer
+   * @param numLoaderThreads number of background threads that read and transform the batches
+   */
+  DataSourcePrefetcher(std::function<Dataset*()> readBatch,
+                       std::function<Dataset*(Dataset*)> transformBatch, size_t capacity,
+                       size_t numLoaderThreads);
+
+  /**
+   * Destructor, stops the loader threads and discards all batches that were not requested
+   */
+  ~DataSourcePrefetcher();
+
+  DataSourcePrefetcher(const DataSourcePrefetcher&) = delete;
+  DataSourcePrefetcher& operator=(const DataSourcePrefetcher&) = delete;
+
+  /**
+   * Returns the next batch, blocks until it is available. Starts the loader threads if they are
+   * not running. Exceptions thrown while reading or transforming the batch are rethrown here.
+   * @return the next batch, owned by the caller. Empty if the source is exhausted.
+   */
+  Dataset* getNextSamples();
+
+  /**
+   * Stops the loader threads and discards all batches that were read ahead. Has to be called
+   * before the state of the source is changed from outside, e.g. when it is reset.
+   */
+  void stop();
+
+ private:
+  /**
+   * Main loop of the loader threads
+   */
+  void load();
+
+  /**
+   * Reads the next batch from the source
+   */
+  std::function<Dataset*()> readBatch;
+
+  /**
+   * Transforms a batch that was read
+   */
+  std::function<Dataset*(Dataset*)> transformBatch;
+
+  /**
+   * Maximum number of batches that are read ahead
+   */
+  size_t capacity;
+
+  /**
+   * Number of loader threads
+   */
+  size_t numLoaderThreads;
+
+  /**
+   * The running loader threads
+   */
+  std::vector<std::thread> loaders;
+
+  /**
+   * Serializes the reads from the source, so that the batches are read in sequence order
+   */
+  std::mutex readMutex;
+
+  /**
+   * Protects the queue and the counters below
+   */
+  std::mutex queueMutex;
+
+  /**
+   * Signaled when the consumer took a batch or the loaders are stopped
+   */
+  std::condition_variable slotFree;
+
+  /**
+   * Signaled when a batch was put into the queue
+   */
+  std::condition_variable batchReady;
+
+  /**
+   * Batches that are ready, by sequence number. A null entry marks a batch that failed.
+   */
+  std::map<size_t, std::unique_ptr<Dataset>> batches;
+
+  /**
+   * Sequence number of the next batch that will be read
+   */
+  size_t nextRead;
+
+  /**
+   * Sequence number of the next batch that will be handed out
+   */
+  size_t nextConsumed;
+
+  /**
+   * The source returned an empty batch or failed, no further batches will be read
+   */
+  bool exhausted;
+
+  /**
+   * The loader threads are asked to stop
+   */
+  bool cancelled;
+
+  /**
+   * First exception thrown by a loader thread
+   */
+  std::exception_ptr error;
+};
+
+} /* namespace datadriven */
+} /* namespace sgpp */
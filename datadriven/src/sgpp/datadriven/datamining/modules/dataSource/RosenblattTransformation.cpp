@@ -16,13 +16,14 @@
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
 #include <sgpp/datadriven/application/LearnerSGDE.hpp>
 
+#include <memory>
 #include <random>
 
 namespace sgpp {
 namespace datadriven {
 
 RosenblattTransformation::RosenblattTransformation()
-    : grid(nullptr), alpha(nullptr), datasetTransformed(nullptr), datasetInvTransformed(nullptr) {}
+    : grid(nullptr), alpha(nullptr), datasetInvTransformed(nullptr) {}
 
 void RosenblattTransformation::initialize(Dataset *dataset, DataTransformationConfig config) {
   RosenblattTransformationConfig rbConfig = config.rosenblattConfig;
@@ -56,9 +57,11 @@ void RosenblattTransformation::initialize(Dataset *dataset, DataTransformationCo
 
 Dataset *RosenblattTransformation::doTransformation(Dataset *dataset) {
   std::cout << "Performing Rosenblatt transformation" << std::endl;
-  OperationRosenblattTransformation *opRos(
+  // only local state, so that batches can be transformed concurrently (e.g. by prefetching)
+  std::unique_ptr<OperationRosenblattTransformation> opRos(
       sgpp::op_factory::createOperationRosenblattTransformation(*this->grid));
-  datasetTransformed = new Dataset{dataset->getNumberInstances(), dataset->getDimension()};
+  Dataset *datasetTransformed =
+      new Dataset{dataset->getNumberInstances(), dataset->getDimension()};
 
   opRos->doTransformation(this->alpha.get(), &dataset->getData(), &datasetTransformed->getData());
 
@@ -79,11 +79,6 @@ class RosenblattTransformation : public DataTransformation {
    */
   std::shared_ptr<base::DataVector> alpha;
 
-  /**
-   * Pointer to #sgpp::datadriven::Dataset
-   */
-  Dataset *datasetTransformed;
-
   /**
    * Pointer to #sgpp::datadriven::Dataset
    */
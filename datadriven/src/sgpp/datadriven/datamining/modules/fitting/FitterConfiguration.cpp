@@ -102,6 +102,11 @@ datadriven::OperationMultipleEvalConfiguration &FitterConfiguration::getMultiple
       static_cast<const FitterConfiguration &>(*this).getMultipleEvalConfig());
 }
 
+datadriven::LearnerConfiguration &FitterConfiguration::getLearnerConfig() {
+  return const_cast<datadriven::LearnerConfiguration &>(
+      static_cast<const FitterConfiguration &>(*this).getLearnerConfig());
+}
+
 void FitterConfiguration::setupDefaults() {
   gridConfig.type_ = sgpp::base::GridType::Linear;  // mirrors struct default
   gridConfig.dim_ = 0;
@@ -138,6 +143,8 @@ void FitterConfiguration::setupDefaults() {
   crossvalidationConfig.lambdaEnd_ = 0.001;
   crossvalidationConfig.lambdaSteps_ = 0;
   crossvalidationConfig.logScale_ = false;
+  crossvalidationConfig.parallelFolds_ = 1;  // mirrors struct default
+  crossvalidationConfig.threadsPerFold_ = 0;  // mirrors struct default
 
   // (Sebastian) The following two values were previously set
   // in the subclass FitterConfigurationDensityEstimation but were moved here
@@ -171,6 +178,7 @@ void FitterConfiguration::setupDefaults() {
 
   learnerConfig.beta = 1.0;  // mirrors struct default
   learnerConfig.usePrior = false;  // mirrors struct default
+  learnerConfig.sharedGrid = false;  // mirrors struct default
 
   // configure geometry configuration
   geometryConfig.stencilType = sgpp::datadriven::StencilType::None;
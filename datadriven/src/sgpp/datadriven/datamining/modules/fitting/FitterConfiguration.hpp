@@ -201,6 +201,12 @@ class FitterConfiguration {
    */
   datadriven::OperationMultipleEvalConfiguration &getMultipleEvalConfig();
 
+  /**
+   * Get or set the configuration for the learner's behaviour
+   * @return LearnerConfiguration
+   */
+  datadriven::LearnerConfiguration &getLearnerConfig();
+
   /**
    * set default values for all members based on the desired scenario.
    */
@@ -17,6 +17,7 @@
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
 #include <sgpp/solver/sle/BiCGStab.hpp>
 #include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
 
 #include <string>
 #include <vector>
@@ -36,6 +37,7 @@ using sgpp::solver::SLESolver;
 using sgpp::solver::SLESolverType;
 using sgpp::solver::ConjugateGradients;
 using sgpp::solver::BiCGStab;
+using sgpp::solver::PipelinedConjugateGradients;
 using sgpp::solver::SLESolverConfiguration;
 
 ModelFittingBase::ModelFittingBase()
@@ -90,6 +92,8 @@ SLESolver *ModelFittingBase::buildSolver(const SLESolverConfiguration &sleConfig
     return new ConjugateGradients(sleConfig.maxIterations_, sleConfig.eps_);
   } else if (sleConfig.type_ == SLESolverType::BiCGSTAB) {
     return new BiCGStab(sleConfig.maxIterations_, sleConfig.eps_);
+  } else if (sleConfig.type_ == SLESolverType::PipelinedCG) {
+    return new PipelinedConjugateGradients(sleConfig.maxIterations_, sleConfig.eps_);
   } else {
     throw factory_exception(
         "ModelFittingBase: An unsupported SLE solver type was "
@@ -86,6 +86,13 @@ class ModelFittingBase {
    */
   // virtual ModelFittingBase* clone() const = 0;
 
+  /**
+   * Create a new, untrained fitter of the same type and with the same configuration as this one,
+   * e.g. to train several folds of a cross validation concurrently.
+   * @return the new fitter (owned by the caller) or nullptr if the fitter does not support this.
+   */
+  virtual ModelFittingBase *createNewInstance() const { return nullptr; }
+
   // TODO(lettrich): dataset should be const.
   /**
    * Fit the grid to the dataset by determinig the weights of an initial grid
@@ -13,6 +13,11 @@
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingClassification.hpp>
 
 #include <sgpp/base/exception/application_exception.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationQuadrature.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDatabase.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineFactory.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOnlineDEFactory.hpp>
 #include <sgpp/datadriven/configuration/DensityEstimationConfiguration.hpp>
 #include <sgpp/datadriven/datamining/configuration/RefinementFunctorTypeParser.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingDensityEstimationCG.hpp>
@@ -27,6 +32,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -57,50 +63,82 @@ ModelFittingClassification::ModelFittingClassification(
                                                      config.getParallelConfig().processCols_);
   }
 #endif
+
+  if (this->config->getLearnerConfig().sharedGrid) {
+    bool scalapackEnabled = false;
+#ifdef USE_SCALAPACK
+    scalapackEnabled = this->config->getParallelConfig().scalapackEnabled_;
+#endif
+    if (this->config->getDensityEstimationConfig().type_ !=
+            DensityEstimationType::Decomposition ||
+        this->config->getGridConfig().generalType_ == base::GeneralGridType::ComponentGrid ||
+        scalapackEnabled) {
+      throw application_exception(
+          "Shared grid classification requires (non distributed) decomposition based density "
+          "estimation on a sparse grid");
+    }
+  }
 }
 
 double ModelFittingClassification::evaluate(const DataVector& sample) {
-  if (models.size() == 0) {
+  if (models.size() == 0 && !sharedOnline) {
     std::string errorMessage = "Prediction impossible! No models were trained!";
     throw application_exception(errorMessage.c_str());
+  } else if (sharedOnline) {
+    DataMatrix samples(1, sample.getSize());
+    samples.setRow(0, sample);
+    DataMatrix classDensities;
+    sharedOnline->evalMultiple(sharedAlphas, samples, classDensities, *sharedGrid);
+    return predictLabel(classDensities.getPointer());
   } else {
-    auto& learnerConfig = this->config->getLearnerConfig();
-    double prediction = 0.0, maxDensity = 0.0;
-
-    // Pre compute the total number of instances
-    size_t numInstances = 0;
+    std::vector<double> classDensities(models.size(), 0.0);
     for (auto& p : classIdx) {
       size_t idx = p.second;
-      numInstances += classNumberInstances[idx];
+      if (classNumberInstances[idx] > 0) {
+        classDensities[idx] = models[idx]->evaluate(sample);
+      }
     }
+    return predictLabel(classDensities.data());
+  }
+}
 
-    bool evaluatedModel = false;
-    for (auto& p : classIdx) {
-      double label = p.first;
-      size_t idx = p.second;
-      if (classNumberInstances[idx] == 0) {
-        // The model for this class was not trained -> no prediction possible for this model
-        continue;
-      }
-      double classConditionalDensity = models[idx]->evaluate(sample);
-      double prior;
-      if (learnerConfig.usePrior) {
-        // Prior is realtive frequency of instances of this class
-        prior = static_cast<double>(classNumberInstances[idx]) / static_cast<double>(numInstances);
-      } else {
-        // Uniform prior
-        prior = 1.0;
-      }
-      double density = prior * classConditionalDensity;
+double ModelFittingClassification::predictLabel(const double* classDensities) const {
+  auto& learnerConfig = this->config->getLearnerConfig();
+  double prediction = 0.0, maxDensity = 0.0;
 
-      if (!evaluatedModel || density > maxDensity) {
-        maxDensity = density;
-        prediction = label;
-      }
-      evaluatedModel = true;
+  // Pre compute the total number of instances
+  size_t numInstances = 0;
+  for (auto& p : classIdx) {
+    size_t idx = p.second;
+    numInstances += classNumberInstances[idx];
+  }
+
+  bool evaluatedModel = false;
+  for (auto& p : classIdx) {
+    double label = p.first;
+    size_t idx = p.second;
+    if (classNumberInstances[idx] == 0) {
+      // The model for this class was not trained -> no prediction possible for this model
+      continue;
+    }
+    double classConditionalDensity = classDensities[idx];
+    double prior;
+    if (learnerConfig.usePrior) {
+      // Prior is realtive frequency of instances of this class
+      prior = static_cast<double>(classNumberInstances[idx]) / static_cast<double>(numInstances);
+    } else {
+      // Uniform prior
+      prior = 1.0;
+    }
+    double density = prior * classConditionalDensity;
+
+    if (!evaluatedModel || density > maxDensity) {
+      maxDensity = density;
+      prediction = label;
     }
-    return prediction;
+    evaluatedModel = true;
   }
+  return prediction;
 }
 
 void ModelFittingClassification::evaluate(DataMatrix& samples, DataVector& results) {
@@ -126,6 +164,18 @@ void ModelFittingClassification::evaluate(DataMatrix& samples, DataVector& resul
   }
 #endif  // USE_SCALAPACK
 
+  if (sharedOnline) {
+    // all classes in a single pass over the samples
+    DataMatrix classDensities;
+    sharedOnline->evalMultiple(sharedAlphas, samples, classDensities, *sharedGrid);
+
+#pragma omp parallel for
+    for (size_t i = 0; i < samples.getNrows(); i++) {
+      results.set(i, predictLabel(classDensities.getPointer() + i * classDensities.getNcols()));
+    }
+    return;
+  }
+
 #pragma omp parallel for
   for (size_t i = 0; i < samples.getNrows(); i++) {
     DataVector tmp(samples.getNcols());
@@ -171,10 +221,12 @@ size_t ModelFittingClassification::labelToIdx(double label) {
     size_t idx = classIdx.size();
     classIdx[label] = idx;
 
-    // Create a new model
-    std::unique_ptr<ModelFittingDensityEstimation> model = createNewModel(
-        dynamic_cast<sgpp::datadriven::FitterConfigurationDensityEstimation&>(*config));
-    models.push_back(std::move(model));
+    // Create a new model, in the shared grid case the class is a column of the shared model
+    if (!this->config->getLearnerConfig().sharedGrid) {
+      std::unique_ptr<ModelFittingDensityEstimation> model = createNewModel(
+          dynamic_cast<sgpp::datadriven::FitterConfigurationDensityEstimation&>(*config));
+      models.push_back(std::move(model));
+    }
 
     // Count the number of instances for this class
     classNumberInstances.push_back(0u);
@@ -239,6 +291,10 @@ MultiGridRefinementFunctor* ModelFittingClassification::getRefinementFunctor(
 }
 
 bool ModelFittingClassification::refine() {
+  if (this->config->getLearnerConfig().sharedGrid) {
+    // the decomposition of the shared grid is kept
+    return false;
+  }
   if (config->getGridConfig().generalType_ == base::GeneralGridType::ComponentGrid) {
     for (size_t i = 0; i < models.size(); i++) {
       models.at(i)->refine();
@@ -305,6 +361,11 @@ bool ModelFittingClassification::refine() {
 void ModelFittingClassification::update(Dataset& newDataset) {
   dataset = &newDataset;
 
+  if (this->config->getLearnerConfig().sharedGrid) {
+    updateSharedGrid(newDataset);
+    return;
+  }
+
   // Split the dataset into classes
   DataVector tmp(newDataset.getDimension());
   std::map<double, DataMatrix*> classSamples;
@@ -327,13 +388,125 @@ void ModelFittingClassification::update(Dataset& newDataset) {
   }
 }
 
+void ModelFittingClassification::updateSharedGrid(Dataset& newDataset) {
+  auto& densityEstimationConfig = this->config->getDensityEstimationConfig();
+  DataMatrix& samples = newDataset.getData();
+
+  if (!sharedGrid) {
+    // build the grid and decompose the system matrix once for all classes, as in
+    // ModelFittingDensityEstimationOnOff
+    auto& databaseConfig = this->config->getDatabaseConfig();
+    auto& gridConfig = this->config->getGridConfig();
+    auto& refinementConfig = this->config->getRefinementConfig();
+    auto& regularizationConfig = this->config->getRegularizationConfig();
+    auto& geometryConfig = this->config->getGeometryConfig();
+
+    gridConfig.dim_ = samples.getNcols();
+    sharedGrid = std::unique_ptr<Grid>{buildGrid(gridConfig, geometryConfig)};
+
+    if (!databaseConfig.filepath.empty()) {
+      datadriven::DBMatDatabase database(databaseConfig.filepath);
+      if (database.hasDataMatrix(gridConfig, refinementConfig, regularizationConfig,
+                                 densityEstimationConfig)) {
+        std::string offlineFilepath = database.getDataMatrix(
+            gridConfig, refinementConfig, regularizationConfig, densityEstimationConfig);
+        sharedOffline.reset(DBMatOfflineFactory::buildFromFile(offlineFilepath));
+      }
+    }
+
+    if (!sharedOffline) {
+      sharedOffline.reset(DBMatOfflineFactory::buildOfflineObject(
+          gridConfig, refinementConfig, regularizationConfig, densityEstimationConfig));
+      sharedOffline->buildMatrix(sharedGrid.get(), regularizationConfig);
+      sharedOffline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+      sharedOffline->interactions = getInteractions(geometryConfig);
+
+      if (densityEstimationConfig.decomposition_ == MatrixDecompositionType::SMW_ortho ||
+          densityEstimationConfig.decomposition_ == MatrixDecompositionType::SMW_chol) {
+        sharedOffline->compute_inverse();
+      }
+    }
+
+    sharedOnline = std::unique_ptr<DBMatOnlineDE>{DBMatOnlineDEFactory::buildDBMatOnlineDE(
+        *sharedOffline, *sharedGrid, regularizationConfig.lambda_, 0,
+        densityEstimationConfig.decomposition_)};
+    sharedRhs = DataMatrix(sharedGrid->getSize(), 0);
+  }
+
+  // class indicators of the samples, one column per class
+  std::vector<size_t> sampleIdx(newDataset.getNumberInstances());
+  for (size_t i = 0; i < newDataset.getNumberInstances(); i++) {
+    sampleIdx[i] = labelToIdx(newDataset.getTargets().get(i));
+  }
+  DataMatrix indicators(newDataset.getNumberInstances(), classIdx.size(), 0.0);
+  std::vector<bool> classInBatch(classIdx.size(), false);
+  for (size_t i = 0; i < newDataset.getNumberInstances(); i++) {
+    indicators.set(i, sampleIdx[i], 1.0);
+    classNumberInstances[sampleIdx[i]]++;
+    classInBatch[sampleIdx[i]] = true;
+  }
+
+  // right hand sides of all classes, old batches are weighted by beta as in DBMatOnlineDE,
+  // i.e., only for the classes that receive samples in this batch
+  DataMatrix b;
+  sharedOnline->computeRhsMultiple(samples, indicators, b, *sharedGrid, densityEstimationConfig);
+  DataVector newClass(sharedGrid->getSize(), 0.0);
+  while (sharedRhs.getNcols() < classIdx.size()) {
+    sharedRhs.appendCol(newClass);
+  }
+  const double beta = this->config->getLearnerConfig().beta;
+  for (size_t idx = 0; idx < classIdx.size(); idx++) {
+    if (classInBatch[idx]) {
+      for (size_t i = 0; i < sharedRhs.getNrows(); i++) {
+        sharedRhs.set(i, idx, beta * sharedRhs.get(i, idx));
+      }
+    }
+  }
+  sharedRhs.add(b);
+
+  DataMatrix rhs(sharedRhs);
+  for (size_t i = 0; i < rhs.getNrows(); i++) {
+    for (size_t idx = 0; idx < rhs.getNcols(); idx++) {
+      rhs.set(i, idx, rhs.get(i, idx) / static_cast<double>(classNumberInstances[idx]));
+    }
+  }
+
+  sharedOnline->computeDensityFunctionsMultiple(sharedAlphas, rhs, *sharedGrid,
+                                                densityEstimationConfig,
+                                                this->config->getCrossvalidationConfig().enable_);
+
+  if (densityEstimationConfig.normalize_) {
+    std::unique_ptr<base::OperationQuadrature> opQuad(
+        op_factory::createOperationQuadrature(*sharedGrid));
+    DataVector alpha(sharedAlphas.getNrows());
+    for (size_t idx = 0; idx < sharedAlphas.getNcols(); idx++) {
+      sharedAlphas.getColumn(idx, alpha);
+      alpha.mult(1.0 / opQuad->doQuadrature(alpha));
+      sharedAlphas.setColumn(idx, alpha);
+    }
+  }
+}
+
 void ModelFittingClassification::reset() {
   models.clear();
+  sharedGrid.reset();
+  sharedOnline.reset();
+  sharedOffline.reset();
+  sharedAlphas = DataMatrix();
+  sharedRhs = DataMatrix();
   classNumberInstances.clear();
   classIdx.clear();
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingClassification::createNewInstance() const {
+  // the configuration is stored as density estimation configuration
+  FitterConfigurationClassification classificationConfig;
+  static_cast<FitterConfigurationDensityEstimation&>(classificationConfig) =
+      static_cast<const FitterConfigurationDensityEstimation&>(*this->config);
+  return new ModelFittingClassification(classificationConfig);
+}
+
 void ModelFittingClassification::storeClassificator() {
   std::cout << "Storing Classificator..." << std::endl;
 
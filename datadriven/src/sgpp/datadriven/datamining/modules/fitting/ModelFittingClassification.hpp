@@ -15,6 +15,8 @@
 #include <sgpp/globaldef.hpp>
 
 #include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOffline.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOnlineDE.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationClassification.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBaseSingleGrid.hpp>
@@ -38,6 +40,12 @@ namespace datadriven {
 /**
  * Fitter object that encapsulates density based classification using instances of
  * ModelFittingDensityEstimation for each class.
+ *
+ * If LearnerConfiguration::sharedGrid is set, the densities of all classes are instead learned on
+ * one common grid: the system matrix is decomposed once, the right hand sides of all classes are
+ * assembled in a single pass over the data and solved with the same decomposition, and all
+ * classes are evaluated in a single pass over the samples. This requires decomposition based
+ * density estimation and the common grid is not refined.
  */
 class ModelFittingClassification : public ModelFittingBase {
  public:
@@ -57,7 +65,7 @@ class ModelFittingClassification : public ModelFittingBase {
   /**
    * Improve the accuracy of the classification by refining the grids of each class
    * @return true if refinement could be performed for any grid based on the refinement
-   * configuration, else false.
+   * configuration, else false. Always false for a shared grid.
    */
   bool refine() override;
 
@@ -86,6 +94,12 @@ class ModelFittingClassification : public ModelFittingBase {
    */
   void reset() override;
 
+  /**
+   * Create a new, untrained fitter with the same configuration as this one
+   * @return the new fitter, owned by the caller
+   */
+  ModelFittingBase* createNewInstance() const override;
+
   /*
    * store Fitter into text file in folder /datadriven/classificator/
    */
@@ -107,6 +121,20 @@ class ModelFittingClassification : public ModelFittingBase {
    */
   size_t labelToIdx(double label);
 
+  /**
+   * Selects the class with the highest density, weighted by the prior if configured
+   * @param classDensities class conditional density for each class index
+   * @return the predicted class label
+   */
+  double predictLabel(const double* classDensities) const;
+
+  /**
+   * Updates the densities of all classes on the shared grid, creates the grid and the
+   * decomposition first if necessary
+   * @param dataset the new data
+   */
+  void updateSharedGrid(Dataset& dataset);
+
   /**
    * Returns the refinement functor suitable for the model settings.
    * @param grids vector of pointers to grids for each class
@@ -144,6 +172,32 @@ class ModelFittingClassification : public ModelFittingBase {
    */
   std::vector<size_t> classNumberInstances;
 
+  /**
+   * Shared grid of all classes (only if LearnerConfiguration::sharedGrid is set)
+   */
+  std::unique_ptr<Grid> sharedGrid;
+
+  /**
+   * Decomposition of the system matrix of the shared grid
+   */
+  std::unique_ptr<DBMatOffline> sharedOffline;
+
+  /**
+   * Online object that solves and evaluates on the shared grid
+   */
+  std::unique_ptr<DBMatOnlineDE> sharedOnline;
+
+  /**
+   * Surpluses on the shared grid, one column per class index
+   */
+  DataMatrix sharedAlphas;
+
+  /**
+   * Accumulated right hand sides on the shared grid (not yet divided by the number of
+   * instances), one column per class index
+   */
+  DataMatrix sharedRhs;
+
 #ifdef USE_SCALAPACK
   /**
    * BLACS process grid for ScaLAPACK version
@@ -172,5 +172,10 @@ void ModelFittingDensityEstimationCG::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationCG::createNewInstance() const {
+  return new ModelFittingDensityEstimationCG(
+      static_cast<const FitterConfigurationDensityEstimation&>(*this->config));
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
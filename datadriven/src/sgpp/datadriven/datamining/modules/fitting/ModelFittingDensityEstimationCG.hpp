@@ -105,6 +105,12 @@ class ModelFittingDensityEstimationCG : public ModelFittingDensityEstimation {
    */
   void reset() override;
 
+  /**
+   * Create a new, untrained fitter with the same configuration as this one
+   * @return the new fitter, owned by the caller
+   */
+  ModelFittingBase* createNewInstance() const override;
+
  private:
   /**
    * Creates the regularization operation matrix for the model settings.
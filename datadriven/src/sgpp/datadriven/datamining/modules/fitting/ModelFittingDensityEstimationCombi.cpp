@@ -220,6 +220,12 @@ void ModelFittingDensityEstimationCombi::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationCombi::createNewInstance() const {
+  FitterConfigurationDensityEstimation densityEstimationConfig(
+      static_cast<const FitterConfigurationDensityEstimation&>(*this->config));
+  return new ModelFittingDensityEstimationCombi(densityEstimationConfig);
+}
+
 std::unique_ptr<ModelFittingDensityEstimation> ModelFittingDensityEstimationCombi::createNewModel(
     sgpp::datadriven::FitterConfigurationDensityEstimation& densityEstimationConfig) {
   switch (densityEstimationConfig.getDensityEstimationConfig().type_) {
@@ -99,6 +99,12 @@ class ModelFittingDensityEstimationCombi : public ModelFittingDensityEstimation
    */
   void reset() override;
 
+  /**
+   * Create a new, untrained fitter with the same configuration as this one
+   * @return the new fitter, owned by the caller
+   */
+  ModelFittingBase* createNewInstance() const override;
+
  protected:
   /**
    * Contains the component grids witch form the sparse grids
@@ -185,5 +185,10 @@ void ModelFittingDensityEstimationOnOff::reset() {
   refinementsPerformed = 0;
 }
 
+ModelFittingBase* ModelFittingDensityEstimationOnOff::createNewInstance() const {
+  return new ModelFittingDensityEstimationOnOff(
+      static_cast<const FitterConfigurationDensityEstimation&>(*this->config));
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
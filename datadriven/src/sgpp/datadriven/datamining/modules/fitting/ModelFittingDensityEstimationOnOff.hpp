@@ -112,6 +112,12 @@ class ModelFittingDensityEstimationOnOff : public ModelFittingDensityEstimation
    */
   void reset() override;
 
+  /**
+   * Create a new, untrained fitter with the same configuration as this one
+   * @return the new fitter, owned by the caller
+   */
+  ModelFittingBase* createNewInstance() const override;
+
  private:
   // The online object
   std::unique_ptr<DBMatOnlineDE> online;
@@ -117,22 +117,24 @@ void ModelFittingDensityEstimationOnOffParallel::fit(DataMatrix& newDataset) {
     }
   }
 
-  // Build and decompose offline object if not loaded from database
+  // Build offline object if not loaded from database
   if (offline == nullptr) {
-    // Build offline object by factory, build matrix and decompose
+    // Build offline object by factory and assemble the matrix on the process grid
     offline = DBMatOfflineFactory::buildOfflineObject(
         gridConfig, refinementConfig, regularizationConfig, densityEstimationConfig);
-    offline->buildMatrix(grid.get(), regularizationConfig);
-    offline->decomposeMatrix(regularizationConfig, densityEstimationConfig);
+    offline->buildMatrixParallel(grid.get(), regularizationConfig, processGrid, parallelConfig);
   }
 
+  // Decompose the matrix, a decomposition loaded from the database is only distributed
+  offline->decomposeMatrixParallel(regularizationConfig, densityEstimationConfig, processGrid,
+                                   parallelConfig);
+
   alphaDistributed =
       DataVectorDistributed(processGrid, grid->getSize(), parallelConfig.rowBlockSize_);
 
   // online phase
   online = std::unique_ptr<DBMatOnlineDE>{DBMatOnlineDEFactory::buildDBMatOnlineDE(
       *offline, *grid, regularizationConfig.lambda_, 0, densityEstimationConfig.decomposition_)};
-  online->syncDistributedDecomposition(processGrid, parallelConfig);
 
   online->computeDensityFunctionParallel(alphaDistributed, newDataset, *grid,
                                          this->config->getDensityEstimationConfig(),
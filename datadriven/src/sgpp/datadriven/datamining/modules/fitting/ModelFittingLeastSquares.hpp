@@ -78,6 +78,12 @@ class ModelFittingLeastSquares : public ModelFittingBaseSingleGrid {
    */
   void reset() override;
 
+  /**
+   * Create a new, untrained fitter with the same configuration as this one
+   * @return the new fitter, owned by the caller
+   */
+  ModelFittingBase * createNewInstance() const override;
+
  private:
   /**
    * Count the amount of refinement operations performed on the current dataset.
@@ -15,6 +15,7 @@
 #include <sgpp/datadriven/datamining/modules/hpo/bo/BayesianOptimization.hpp>
 #include <sgpp/optimization/tools/Printer.hpp>
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <limits>
@@ -61,39 +62,41 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   int bestscnt = 0;
   std::string bestconfigstring;
 
-
-
-  // list/vector of configs, start setup
-  std::vector<BOConfig> initialConfigs{};
-  initialConfigs.reserve(static_cast<size_t>(config.getNRandom()));
-  std::mt19937 generator(static_cast<size_t>(config.getSeed()));
-
-  // random warmup phase
-  for (int i = 0; i < config.getNRandom(); ++i) {
-    initialConfigs.emplace_back(prototype);
-    initialConfigs[i].randomize(generator);
-    fitterFactory->setBO(initialConfigs[i]);
-    std::string configString = fitterFactory->printConfig();
-    // std::unique_ptr<ModelFittingBase> fitter(fitterFactory->buildFitter());
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    // hpoScorer->calculateScore(*fitter, *trainData, &stdDeviation);
-    initialConfigs[i].setScore(transformScore(result));
-    std::cout << (i + 1) << configString << ", " << result;
+  // output of one evaluated sample
+  auto report = [&](int sampleNo, const std::string &configString, double result) {
+    std::cout << sampleNo << configString << ", " << result;
     if (writeToFile) {
       myfile.open(fn.str(), std::ios_base::app);
       if (myfile.is_open()) {
-        myfile << (i + 1) << configString << ", " << result << std::endl;
+        myfile << sampleNo << configString << ", " << result << std::endl;
       }
       myfile.close();
     }
     if (result < best) {
       best = result;
-      bestscnt = i + 1;
+      bestscnt = sampleNo;
       bestconfigstring = configString;
       std::cout << " new best!";
     }
     std::cout << std::endl;
+  };
+
+  // list/vector of configs, start setup
+  std::vector<BOConfig> initialConfigs{};
+  initialConfigs.reserve(static_cast<size_t>(config.getNRandom()));
+  std::mt19937 generator(static_cast<size_t>(config.getSeed()));
+
+  // random warmup phase, all samples are independent of each other
+  for (int i = 0; i < config.getNRandom(); ++i) {
+    initialConfigs.emplace_back(prototype);
+    initialConfigs[i].randomize(generator);
+  }
+  std::vector<std::string> configStrings;
+  DataVector results;
+  evaluateConfigs(initialConfigs, configStrings, results);
+  for (size_t i = 0; i < initialConfigs.size(); ++i) {
+    initialConfigs[i].setScore(transformScore(results[i]));
+    report(static_cast<int>(i + 1), configStrings[i], results[i]);
   }
 
   std::cout << "############# Random Phase finished! #############" << std::endl;
@@ -101,32 +104,21 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   BayesianOptimization bo(initialConfigs);
   bo.setScales(bo.fitScales(), 0.7);
 
-
-  // main loop
-  for (int q = 0; q < config.getNRuns(); q++) {
-    BOConfig nextConfig = bo.main(prototype);
-    fitterFactory->setBO(nextConfig);
-    std::string configString = fitterFactory->printConfig();
-    miner->setModel(fitterFactory->buildFitter());
-    double result = miner->learn(false);
-    nextConfig.setScore(transformScore(result));
-    bo.updateGP(nextConfig, true);
-    bo.setScales(bo.fitScales(), 0.1);
-    std::cout << (q + config.getNRandom() + 1) << configString << ", " << result;
-    if (writeToFile) {
-      myfile.open(fn.str(), std::ios_base::app);
-      if (myfile.is_open()) {
-        myfile << (q + config.getNRandom() + 1) << configString << ", " << result << std::endl;
-      }
-      myfile.close();
+  // main loop, one sample per miner of the pool in each batch
+  size_t numWorkers = workerMiners.size() + 1;
+  for (int q = 0; q < config.getNRuns(); q += static_cast<int>(numWorkers)) {
+    size_t batchSize = std::min(numWorkers, static_cast<size_t>(config.getNRuns() - q));
+    std::vector<BOConfig> nextConfigs = bo.mainBatch(prototype, batchSize);
+    evaluateConfigs(nextConfigs, configStrings, results);
+    for (size_t i = 0; i < batchSize; ++i) {
+      nextConfigs[i].setScore(transformScore(results[i]));
+      bo.updateGP(nextConfigs[i], true);
     }
-    if (result < best) {
-      best = result;
-      bestscnt = static_cast<int>(q + config.getNRandom() + 1);
-      bestconfigstring = configString;
-      std::cout << " new best!";
+    bo.setScales(bo.fitScales(), 0.1);
+    for (size_t i = 0; i < batchSize; ++i) {
+      report(static_cast<int>(q + config.getNRandom() + 1 + static_cast<int>(i)),
+             configStrings[i], results[i]);
     }
-    std::cout << std::endl;
   }
   if (writeToFile) {
     myfile.open(fn.str(), std::ios_base::app);
@@ -141,6 +133,19 @@ double BoHyperparameterOptimizer::run(bool writeToFile) {
   return best;
 }
 
+void BoHyperparameterOptimizer::evaluateConfigs(std::vector<BOConfig> &configs,
+                                                std::vector<std::string> &configStrings,
+                                                DataVector &results) {
+  std::vector<ModelFittingBase *> fitters(configs.size());
+  configStrings.resize(configs.size());
+  for (size_t i = 0; i < configs.size(); ++i) {
+    fitterFactory->setBO(configs[i]);
+    configStrings[i] = fitterFactory->printConfig();
+    fitters[i] = fitterFactory->buildFitter();
+  }
+  evaluateTrials(fitters, results);
+}
+
 double BoHyperparameterOptimizer::transformScore(double original) {
   return -1 / (1 + original);
 }
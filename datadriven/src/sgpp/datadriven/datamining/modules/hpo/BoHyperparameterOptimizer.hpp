@@ -19,6 +19,8 @@
 #include <sgpp/datadriven/datamining/modules/hpo/HyperparameterOptimizer.hpp>
 
 #include <memory>
+#include <string>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -81,6 +83,16 @@ class BoHyperparameterOptimizer : public HyperparameterOptimizer {
    * @return transformed value
    */
   double transformScore(double original);
+
+ protected:
+  /**
+   * Build the fitters for a set of configurations and evaluate them on the pool of miners
+   * @param configs the configurations to evaluate
+   * @param configStrings output of the configurations, one string per configuration
+   * @param results the scores of the configurations
+   */
+  void evaluateConfigs(std::vector<BOConfig> &configs, std::vector<std::string> &configStrings,
+                       DataVector &results);
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
@@ -25,6 +25,7 @@ void HPOConfig::setupDefaults() {
   constraints = {2, 2};
   lambda = 1;
   nRandom = 10;
+  nParallelTrials = 1;
 }
 
 int64_t HPOConfig::getSeed() const {
@@ -82,5 +83,14 @@ int64_t HPOConfig::getNTrainSamples() const {
 void HPOConfig::setNTrainSamples(int64_t nTrainSamples) {
   HPOConfig::nTrainSamples = nTrainSamples;
 }
+
+int64_t HPOConfig::getNParallelTrials() const {
+  return nParallelTrials;
+}
+
+void HPOConfig::setNParallelTrials(int64_t nParallelTrials) {
+  HPOConfig::nParallelTrials = nParallelTrials;
+}
+
 } /* namespace datadriven */
 } /* namespace sgpp */
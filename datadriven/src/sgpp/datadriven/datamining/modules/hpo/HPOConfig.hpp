@@ -55,6 +55,10 @@ class HPOConfig {
 
   void setNTrainSamples(int64_t nTrainSamples);
 
+  int64_t getNParallelTrials() const;
+
+  void setNParallelTrials(int64_t nParallelTrials);
+
  private:
   /**
    * Seed for random sampling in both harmonica and bayesian optimization
@@ -84,6 +88,11 @@ class HPOConfig {
    * number of samples bayesian optimization is run for
    */
   int64_t nRuns;
+
+  /**
+   * number of trials (hyperparameter configurations) that are evaluated concurrently
+   */
+  int64_t nParallelTrials;
 };
 } /* namespace datadriven */
 } /* namespace sgpp */
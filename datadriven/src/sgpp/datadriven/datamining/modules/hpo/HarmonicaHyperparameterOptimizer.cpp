@@ -67,11 +67,9 @@ double HarmonicaHyperparameterOptimizer::run(bool writeToFile) {
     std::vector<std::string> configStrings(nRuns);
     harmonica.prepareConfigs(fitters, static_cast<int>(config.getSeed()), configStrings);
 
-    // run samples (parallelize here)
+    // run samples concurrently on the pool of miners
+    evaluateTrials(fitters, scores);
     for (size_t i = 0; i < nRuns; i++) {
-      miner->setModel(fitters[i]);
-      scores[i] = miner->learn(false);
-      // hpoScorer->calculateScore(*(fitters[i]), *trainData, &stdDeviation);
       std::cout << scnt << configStrings[i] << ", " << scores[i];
       if (scores[i] < best) {
         best = scores[i];
@@ -13,10 +13,16 @@
 #include <sgpp/datadriven/datamining/modules/hpo/HyperparameterOptimizer.hpp>
 
 
+#include <algorithm>
+#include <exception>
 #include <vector>
 #include <string>
 #include <limits>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 namespace sgpp {
 namespace datadriven {
 
@@ -27,5 +33,59 @@ HyperparameterOptimizer::HyperparameterOptimizer(SparseGridMiner* miner,
   config.setupDefaults();
   parser.getHPOConfig(config);
 }
+
+void HyperparameterOptimizer::addWorkerMiner(SparseGridMiner *workerMiner) {
+  workerMiners.emplace_back(workerMiner);
+}
+
+size_t HyperparameterOptimizer::getNumWorkers() const {
+  return static_cast<size_t>(std::max(config.getNParallelTrials(), static_cast<int64_t>(1)));
+}
+
+void HyperparameterOptimizer::evaluateTrials(std::vector<ModelFittingBase *> &fitters,
+                                             DataVector &scores) {
+  size_t numTrials = fitters.size();
+  size_t numMiners = std::min(workerMiners.size() + 1, std::max(numTrials, size_t(1)));
+  scores.resize(numTrials);
+  std::exception_ptr error;
+
+#ifdef _OPENMP
+  int threadsPerMiner = std::max(1, omp_get_max_threads() / static_cast<int>(numMiners));
+  int maxActiveLevels = omp_get_max_active_levels();
+  omp_set_max_active_levels(std::max(maxActiveLevels, omp_get_active_level() + 2));
+#endif
+
+#pragma omp parallel for num_threads(static_cast<int>(numMiners)) schedule(static, 1)
+  for (size_t worker = 0; worker < numMiners; worker++) {
+#ifdef _OPENMP
+    if (numMiners > 1) {
+      omp_set_num_threads(threadsPerMiner);
+    }
+#endif
+    SparseGridMiner &workerMiner = (worker == 0) ? *miner : *workerMiners[worker - 1];
+    for (size_t i = worker; i < numTrials; i += numMiners) {
+      try {
+        workerMiner.setModel(fitters[i]);
+        fitters[i] = nullptr;
+        scores[i] = workerMiner.learn(false);
+      } catch (...) {
+#pragma omp critical
+        {
+          if (!error) {
+            error = std::current_exception();
+          }
+        }
+      }
+    }
+  }
+
+#ifdef _OPENMP
+  omp_set_max_active_levels(maxActiveLevels);
+#endif
+
+  if (error) {
+    std::rethrow_exception(error);
+  }
+}
 } /* namespace datadriven */
 } /* namespace sgpp */
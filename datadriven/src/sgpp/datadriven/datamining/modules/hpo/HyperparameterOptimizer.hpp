@@ -19,6 +19,7 @@
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -76,13 +77,42 @@ class HyperparameterOptimizer {
    */
   virtual double run(bool writeToFile) = 0;
 
+  /**
+   * Add a miner to the pool of miners that evaluate trials concurrently. It has to be configured
+   * like the miner passed to the constructor. Usually the miner factory adds getNumWorkers() - 1
+   * of them.
+   * @param workerMiner the additional miner. The HyperparameterOptimizer instance will take
+   * ownership of the passed object.
+   */
+  void addWorkerMiner(SparseGridMiner *workerMiner);
+
+  /**
+   * @return the number of trials that should be evaluated concurrently according to the
+   * configuration
+   */
+  size_t getNumWorkers() const;
+
 
  protected:
+  /**
+   * Evaluate a set of trials on the pool of miners. Trial i is learned by miner
+   * i modulo the pool size, the miners themselves run concurrently, each one with an equal share
+   * of the OpenMP threads.
+   * @param fitters the fitters of the trials, ownership is passed to the miners
+   * @param scores the scores of the trials (in the order of the fitters)
+   */
+  void evaluateTrials(std::vector<ModelFittingBase *> &fitters, DataVector &scores);
+
   /**
    * Miner providing all testing facilities
    */
   std::unique_ptr<SparseGridMiner> miner;
 
+  /**
+   * Additional miners to evaluate trials concurrently to miner
+   */
+  std::vector<std::unique_ptr<SparseGridMiner>> workerMiners;
+
   /**
    * FitterFactory to provide fitters for running different hyperparameter configurations.
    */
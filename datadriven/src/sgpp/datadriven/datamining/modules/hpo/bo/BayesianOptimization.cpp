@@ -107,6 +107,32 @@ BOConfig BayesianOptimization::main(BOConfig &prototype) {
   return bestConfig;
 }
 
+std::vector<BOConfig> BayesianOptimization::mainBatch(BOConfig &prototype, size_t batchSize) {
+  std::vector<BOConfig> batch;
+  if (batchSize == 0) {
+    return batch;
+  }
+  batch.reserve(batchSize);
+  batch.push_back(main(prototype));
+  if (batchSize == 1) {
+    return batch;
+  }
+
+  double lie = std::numeric_limits<double>::infinity();
+  for (auto &config : allConfigs) {
+    lie = std::fmin(lie, config.getScore());
+  }
+
+  BayesianOptimization fantasy(*this);
+  while (batch.size() < batchSize) {
+    BOConfig pending(batch.back());
+    pending.setScore(lie);
+    fantasy.updateGP(pending, true);
+    batch.push_back(fantasy.main(prototype));
+  }
+  return batch;
+}
+
 double BayesianOptimization::acquisitionOuter(const base::DataVector &inp) {
   base::DataVector kernelrow(allConfigs.size());
   for (size_t i = 0; i < allConfigs.size(); i++) {
@@ -187,7 +213,16 @@ void BayesianOptimization::updateGP(BOConfig &newConfig, bool normalize) {
   kernelmatrix.set(size, size, 1 + noise);
   rawScores.push_back(newConfig.getScore());
 
-  decomposeCholesky(kernelmatrix, gleft);
+  // the scales did not change, so the existing decomposition only has to be extended
+  if (gleft.getNrows() == size) {
+    base::DataVector newRow(size);
+    for (size_t i = 0; i < size; ++i) {
+      newRow[i] = kernelmatrix.get(size, i);
+    }
+    extendCholesky(gleft, newRow, 1 + noise);
+  } else {
+    decomposeCholesky(kernelmatrix, gleft);
+  }
   if (normalize) {
     if (rawScores.min() < rawScores.max()) {
       rawScores.normalize();
@@ -241,6 +276,33 @@ void BayesianOptimization::decomposeCholesky(base::DataMatrix &km, base::DataMat
   }
 }
 
+void BayesianOptimization::extendCholesky(base::DataMatrix &gmatrix,
+                                          const base::DataVector &newRow, double diagonal) {
+  size_t n = gmatrix.getNrows();
+  // the new row of the factor solves L l = newRow
+  base::DataVector l(newRow);
+  for (size_t i = 0; i < n; i++) {
+    double sum = l[i];
+    for (size_t k = 0; k < i; k++) {
+      sum = sum - gmatrix.get(i, k) * l[k];
+    }
+    l[i] = sum / gmatrix.get(i, i);
+  }
+  double sum = diagonal - l.dotProduct(l);
+
+  gmatrix.appendRow();
+  gmatrix.appendCol(base::DataVector(n + 1, 0));
+  for (size_t k = 0; k < n; k++) {
+    gmatrix.set(n, k, l[k]);
+  }
+  if (sum > 0) {
+    gmatrix.set(n, n, std::sqrt(sum));
+  } else {
+    decomFailed = true;
+    gmatrix.set(n, n, 10e-8);
+  }
+}
+
 void BayesianOptimization::solveCholeskySystem(base::DataMatrix &gmatrix, base::DataVector &x) {
   for (size_t i = 0; i < x.size(); i++) {
     x[i] = x[i] / gmatrix.get(i, i);
@@ -57,6 +57,15 @@ class BayesianOptimization {
    */
   void decomposeCholesky(base::DataMatrix &km, base::DataMatrix &gnew);
 
+  /**
+   * Extend a Cholesky Decomposition by one row and column, i.e. the decomposition of the Gram
+   * matrix after a new sample was added, in O(n^2) instead of decomposing it again in O(n^3)
+   * @param gmatrix (triangular) matrix of the existing decomposition, extended in place
+   * @param newRow kernel values between the new sample and the existing ones
+   * @param diagonal kernel value of the new sample with itself
+   */
+  void extendCholesky(base::DataMatrix &gmatrix, const base::DataVector &newRow, double diagonal);
+
   /**
    * Solve a system of linear equations using previously decomposed matrix
    * @param gmatrix decomposed matrix
@@ -71,6 +80,17 @@ class BayesianOptimization {
    */
   BOConfig main(BOConfig &prototype);
 
+  /**
+   * routine to find several new sample points that can be evaluated concurrently. The points are
+   * chosen one after another by the constant liar heuristic: each pending point is added to a
+   * copy of the Gaussian Process with the best score so far as fake result, which lowers the
+   * expected improvement in its neighbourhood for the following points.
+   * @param prototype baseline BOConfig
+   * @param batchSize number of sample points
+   * @return new sample points, the first one is the one main() would return
+   */
+  std::vector<BOConfig> mainBatch(BOConfig &prototype, size_t batchSize);
+
 
   /**
    * kernel function
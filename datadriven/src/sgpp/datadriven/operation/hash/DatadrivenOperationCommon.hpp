@@ -5,6 +5,7 @@
 
 #pragma once
 
+#include <sgpp/base/algorithm/EvaluationMatrixCache.hpp>
 #include <sgpp/base/tools/OperationConfiguration.hpp>
 #include <sgpp/globaldef.hpp>
 
@@ -49,6 +50,11 @@ class OperationMultipleEvalConfiguration {
   // optional - can be set for easier reporting
   std::string name;
 
+  // caching of the evaluation matrix, see base::OperationMultipleEval::enableMatrixCaching()
+  bool matrixCaching = false;
+  size_t matrixCacheMemoryBudget = base::EvaluationMatrixCache::defaultMemoryBudget;
+  bool matrixCacheSinglePrecision = false;
+
  public:
   OperationMultipleEvalConfiguration(
       OperationMultipleEvalType type = OperationMultipleEvalType::DEFAULT,
@@ -92,6 +98,30 @@ class OperationMultipleEvalConfiguration {
   std::shared_ptr<base::OperationConfiguration> getParameters() { return this->parameters; }
 
   std::string& getName() { return this->name; }
+
+  /**
+   * Lets the system matrices built with this configuration cache the evaluation matrix of their
+   * operation (see base::OperationMultipleEval::enableMatrixCaching()). Only the DEFAULT type
+   * supports caching, the other types ignore this setting.
+   *
+   * @param memoryBudget maximum number of bytes the cached matrix may occupy
+   * @param singlePrecision store the matrix entries in single precision
+   */
+  void enableMatrixCaching(
+      size_t memoryBudget = base::EvaluationMatrixCache::defaultMemoryBudget,
+      bool singlePrecision = false) {
+    this->matrixCaching = true;
+    this->matrixCacheMemoryBudget = memoryBudget;
+    this->matrixCacheSinglePrecision = singlePrecision;
+  }
+
+  void disableMatrixCaching() { this->matrixCaching = false; }
+
+  bool isMatrixCachingEnabled() const { return this->matrixCaching; }
+
+  size_t getMatrixCacheMemoryBudget() const { return this->matrixCacheMemoryBudget; }
+
+  bool isMatrixCacheSinglePrecision() const { return this->matrixCacheSinglePrecision; }
 };
 }  // namespace datadriven
 }  // namespace sgpp
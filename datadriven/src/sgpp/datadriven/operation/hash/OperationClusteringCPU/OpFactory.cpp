@@ -0,0 +1,51 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OpFactory.hpp>
+
+#include <sgpp/base/exception/factory_exception.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <sstream>
+
+namespace sgpp {
+namespace datadriven {
+
+ClusteringCPU::OperationCreateGraphCPU* createNearestNeighborGraphCPU(base::DataMatrix& dataset,
+                                                                      size_t k,
+                                                                      size_t dimensions) {
+  if (dataset.getNcols() != dimensions) {
+    std::stringstream errorString;
+    errorString << "Error creating operation\"CreateGraphCPU\": "
+                << "dataset has " << dataset.getNcols() << " instead of " << dimensions
+                << " dimensions";
+    throw base::factory_exception(errorString.str().c_str());
+  }
+
+  return new ClusteringCPU::OperationCreateGraphCPU(dataset, k);
+}
+
+ClusteringCPU::OperationPruneGraphCPU* pruneNearestNeighborGraphCPU(base::Grid& grid,
+                                                                    size_t dimensions,
+                                                                    base::DataVector& alpha,
+                                                                    base::DataMatrix& data,
+                                                                    double treshold, size_t k) {
+  if (grid.getDimension() != dimensions || data.getNcols() != dimensions) {
+    std::stringstream errorString;
+    errorString << "Error creating operation\"PruneGraphCPU\": "
+                << "grid and dataset have to be " << dimensions << " dimensional";
+    throw base::factory_exception(errorString.str().c_str());
+  }
+
+  if (alpha.getSize() != grid.getSize()) {
+    throw base::factory_exception(
+        "Error creating operation\"PruneGraphCPU\": alpha does not match the grid size");
+  }
+
+  return new ClusteringCPU::OperationPruneGraphCPU(grid, alpha, data, treshold, k);
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,30 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationClusteringCPU.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphCPU.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationPruneGraphCPU.hpp>
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace datadriven {
+
+/// Generates the k nearest neighbors graph creation running on the CPU
+ClusteringCPU::OperationCreateGraphCPU* createNearestNeighborGraphCPU(base::DataMatrix& dataset,
+                                                                      size_t k,
+                                                                      size_t dimensions);
+/// Generates the graph pruning operation running on the CPU
+ClusteringCPU::OperationPruneGraphCPU* pruneNearestNeighborGraphCPU(base::Grid& grid,
+                                                                    size_t dimensions,
+                                                                    base::DataVector& alpha,
+                                                                    base::DataMatrix& data,
+                                                                    double treshold, size_t k);
+}  // namespace datadriven
+}  // namespace sgpp
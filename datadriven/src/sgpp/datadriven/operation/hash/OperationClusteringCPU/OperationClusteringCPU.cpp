@@ -0,0 +1,171 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationClusteringCPU.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/datadriven/algorithm/DensitySystemMatrix.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphCPU.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationPruneGraphCPU.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace ClusteringCPU {
+
+OperationClusteringCPU::OperationClusteringCPU(bool verbose) : verbose(verbose) {}
+
+std::vector<size_t> OperationClusteringCPU::calculate_clusters(base::Grid* grid,
+                                                               base::DataMatrix& dataset,
+                                                               double lambda, size_t k,
+                                                               double treshold) {
+  std::chrono::time_point<std::chrono::system_clock> start, end;
+  size_t gridsize = grid->getSize();
+  base::DataVector alpha(gridsize);
+  base::DataVector b(gridsize);
+
+  start = std::chrono::system_clock::now();
+  solver::ConjugateGradients solver(1000, 0.001);
+  DensitySystemMatrix densityMatrix(*grid, dataset, op_factory::createOperationIdentity(*grid),
+                                    lambda);
+  if (verbose) std::cout << "Creating rhs..." << std::endl;
+  densityMatrix.generateb(b);
+
+  if (verbose) std::cout << "Creating alpha..." << std::endl;
+  solver.solve(densityMatrix, alpha, b, false, verbose);
+  double max = alpha.max();
+  double min = alpha.min();
+  for (size_t i = 0; i < gridsize; i++) alpha[i] = alpha[i] * 1.0 / (max - min);
+
+  if (verbose) std::cout << "Starting graph creation..." << std::endl;
+  OperationCreateGraphCPU graphOperation(dataset, k);
+  std::vector<int> graph(dataset.getNrows() * k);
+  graphOperation.create_graph(graph);
+
+  if (verbose) std::cout << "Starting graph pruning..." << std::endl;
+  OperationPruneGraphCPU pruneOperation(*grid, alpha, dataset, treshold, k);
+  pruneOperation.prune_graph(graph);
+
+  std::vector<size_t> ret = find_clusters(graph, k);
+  end = std::chrono::system_clock::now();
+  std::chrono::duration<double> elapsed_seconds = end - start;
+  if (verbose) {
+    std::cout << "Time required for clustering: " << elapsed_seconds.count() << std::endl;
+  }
+
+  return ret;
+}
+
+std::vector<size_t> OperationClusteringCPU::find_clusters(std::vector<int>& graph, size_t k) {
+  if (k == 0 || graph.size() % k != 0) {
+    throw base::operation_exception("OperationClusteringCPU: invalid graph size");
+  }
+
+  const size_t nodes = graph.size() / k;
+
+  // symmetric adjacency structure (compressed rows) of the remaining graph
+  std::vector<size_t> offsets(nodes + 1, 0);
+
+  for (size_t i = 0; i < nodes; i++) {
+    if (graph[i * k] == -1) continue;
+
+    for (size_t j = 0; j < k; j++) {
+      int neighbor = graph[i * k + j];
+
+      if (neighbor < 0 || static_cast<size_t>(neighbor) == i ||
+          graph[static_cast<size_t>(neighbor) * k] == -1) {
+        continue;
+      }
+
+      offsets[i + 1]++;
+      offsets[static_cast<size_t>(neighbor) + 1]++;
+    }
+  }
+
+  for (size_t i = 0; i < nodes; i++) offsets[i + 1] += offsets[i];
+
+  std::vector<size_t> adjacency(offsets[nodes]);
+  std::vector<size_t> fill(offsets.begin(), offsets.end() - 1);
+
+  for (size_t i = 0; i < nodes; i++) {
+    if (graph[i * k] == -1) continue;
+
+    for (size_t j = 0; j < k; j++) {
+      int neighbor = graph[i * k + j];
+
+      if (neighbor < 0 || static_cast<size_t>(neighbor) == i ||
+          graph[static_cast<size_t>(neighbor) * k] == -1) {
+        continue;
+      }
+
+      adjacency[fill[i]++] = static_cast<size_t>(neighbor);
+      adjacency[fill[static_cast<size_t>(neighbor)]++] = i;
+    }
+  }
+
+  // every label is the index of a node of the same component, so the iteration converges to
+  // the smallest node index of each component
+  std::vector<size_t> labels(nodes);
+  std::vector<size_t> newLabels(nodes);
+
+  for (size_t i = 0; i < nodes; i++) labels[i] = i;
+
+  size_t changes = 1;
+
+  while (changes > 0) {
+    changes = 0;
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (size_t i = 0; i < nodes; i++) {
+      size_t label = labels[i];
+
+      for (size_t e = offsets[i]; e < offsets[i + 1]; e++) {
+        if (labels[adjacency[e]] < label) label = labels[adjacency[e]];
+      }
+
+      newLabels[i] = label;
+    }
+
+    // pointer jumping
+#pragma omp parallel for reduction(+ : changes)
+    for (size_t i = 0; i < nodes; i++) {
+      size_t label = newLabels[newLabels[i]];
+
+      if (label != labels[i]) {
+        changes++;
+      }
+
+      labels[i] = label;
+    }
+  }
+
+  std::vector<size_t> clusters(nodes, 0);
+  std::vector<size_t> clusterOfRoot(nodes, 0);
+  size_t clustercount = 0;
+
+  for (size_t i = 0; i < nodes; i++) {
+    if (offsets[i] == offsets[i + 1]) continue;
+
+    size_t root = labels[i];
+
+    if (clusterOfRoot[root] == 0) clusterOfRoot[root] = ++clustercount;
+
+    clusters[i] = clusterOfRoot[root];
+  }
+
+  return clusters;
+}
+
+}  // namespace ClusteringCPU
+}  // namespace datadriven
+}  // namespace sgpp
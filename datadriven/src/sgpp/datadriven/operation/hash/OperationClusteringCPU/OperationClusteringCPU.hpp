@@ -0,0 +1,64 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace ClusteringCPU {
+
+/**
+ * CPU version of the density based clustering pipeline (see OperationClusteringOCL):
+ * sparse grid density estimation, k nearest neighbor graph creation, density based pruning of
+ * the graph and labelling of the connected components of the remaining graph.
+ */
+class OperationClusteringCPU {
+ public:
+  /**
+   * Constructor
+   *
+   * @param verbose print progress and timing information
+   */
+  explicit OperationClusteringCPU(bool verbose = false);
+
+  /**
+   * Clusters the given dataset
+   *
+   * @param grid sparse grid used for the density estimation
+   * @param dataset datapoints (one datapoint per row)
+   * @param lambda regularization parameter of the density estimation
+   * @param k number of neighbors per datapoint
+   * @param treshold density threshold used for the pruning of the graph
+   * @return cluster index for each datapoint, 0 for datapoints that do not belong to a cluster
+   */
+  std::vector<size_t> calculate_clusters(base::Grid* grid, base::DataMatrix& dataset,
+                                         double lambda, size_t k, double treshold);
+
+  /**
+   * Assign a cluster index for each datapoint using the connected components of the graph.
+   * The graph is treated as undirected; edges marked with -2 and nodes marked with -1 (as
+   * produced by the pruning) are ignored. The components are labelled in parallel by
+   * minimum label propagation with pointer jumping.
+   *
+   * @param graph k nearest neighbor graph of all datapoints
+   * @param k number of neighbors per datapoint
+   * @return cluster index for each datapoint starting with 1, removed and isolated datapoints
+   * get the index 0
+   */
+  static std::vector<size_t> find_clusters(std::vector<int>& graph, size_t k);
+
+ private:
+  bool verbose;
+};
+
+}  // namespace ClusteringCPU
+}  // namespace datadriven
+}  // namespace sgpp
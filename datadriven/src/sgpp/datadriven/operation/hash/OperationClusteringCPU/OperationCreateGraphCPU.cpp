@@ -0,0 +1,169 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationCreateGraphCPU.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace ClusteringCPU {
+
+OperationCreateGraphCPU::OperationCreateGraphCPU(base::DataMatrix& dataset, size_t k,
+                                                 size_t maxLeafSize)
+    : dataset(dataset),
+      k(k),
+      maxLeafSize(std::max<size_t>(maxLeafSize, 1)),
+      dimensions(dataset.getNcols()) {
+  if (k == 0 || k >= dataset.getNrows()) {
+    throw base::operation_exception(
+        "OperationCreateGraphCPU: k has to be positive and smaller than the number of "
+        "datapoints");
+  }
+
+  permutation.resize(dataset.getNrows());
+  std::iota(permutation.begin(), permutation.end(), 0);
+  buildTree(0, permutation.size());
+}
+
+OperationCreateGraphCPU::~OperationCreateGraphCPU() {}
+
+size_t OperationCreateGraphCPU::buildTree(size_t begin, size_t end) {
+  size_t nodeIndex = tree.size();
+  tree.push_back(TreeNode{begin, end, 0, 0.0, 0, 0});
+
+  if (end - begin <= maxLeafSize) {
+    return nodeIndex;
+  }
+
+  // split along the dimension with the largest spread at the median
+  size_t splitDim = 0;
+  double maxSpread = -1.0;
+
+  for (size_t d = 0; d < dimensions; d++) {
+    double minValue = dataset.get(permutation[begin], d);
+    double maxValue = minValue;
+
+    for (size_t i = begin + 1; i < end; i++) {
+      double value = dataset.get(permutation[i], d);
+      minValue = std::min(minValue, value);
+      maxValue = std::max(maxValue, value);
+    }
+
+    if (maxValue - minValue > maxSpread) {
+      maxSpread = maxValue - minValue;
+      splitDim = d;
+    }
+  }
+
+  if (maxSpread <= 0.0) {
+    // all points are identical, splitting does not help
+    return nodeIndex;
+  }
+
+  size_t middle = begin + (end - begin) / 2;
+  std::nth_element(permutation.begin() + begin, permutation.begin() + middle,
+                   permutation.begin() + end, [this, splitDim](size_t a, size_t b) {
+                     return dataset.get(a, splitDim) < dataset.get(b, splitDim);
+                   });
+
+  double splitValue = dataset.get(permutation[middle], splitDim);
+  size_t left = buildTree(begin, middle);
+  size_t right = buildTree(middle, end);
+
+  // the tree vector might have been reallocated by the recursive calls
+  tree[nodeIndex].splitDim = splitDim;
+  tree[nodeIndex].splitValue = splitValue;
+  tree[nodeIndex].left = left;
+  tree[nodeIndex].right = right;
+  return nodeIndex;
+}
+
+void OperationCreateGraphCPU::searchTree(size_t node, size_t queryIndex,
+                                         NeighborHeap& heap) const {
+  const TreeNode& current = tree[node];
+  const double* query = dataset.getPointer() + queryIndex * dimensions;
+
+  if (current.left == 0 && current.right == 0) {
+    for (size_t i = current.begin; i < current.end; i++) {
+      size_t candidate = permutation[i];
+
+      if (candidate == queryIndex) {
+        continue;
+      }
+
+      const double* point = dataset.getPointer() + candidate * dimensions;
+      double dist = 0.0;
+
+      for (size_t d = 0; d < dimensions; d++) {
+        dist += (query[d] - point[d]) * (query[d] - point[d]);
+      }
+
+      if (heap.size() < k) {
+        heap.push_back(std::make_pair(dist, candidate));
+        std::push_heap(heap.begin(), heap.end());
+      } else if (dist < heap.front().first) {
+        std::pop_heap(heap.begin(), heap.end());
+        heap.back() = std::make_pair(dist, candidate);
+        std::push_heap(heap.begin(), heap.end());
+      }
+    }
+
+    return;
+  }
+
+  double diff = query[current.splitDim] - current.splitValue;
+  size_t nearChild = (diff < 0.0) ? current.left : current.right;
+  size_t farChild = (diff < 0.0) ? current.right : current.left;
+
+  searchTree(nearChild, queryIndex, heap);
+
+  // the far side can only contain better neighbors if it is closer than the current worst one
+  if (heap.size() < k || diff * diff < heap.front().first) {
+    searchTree(farChild, queryIndex, heap);
+  }
+}
+
+void OperationCreateGraphCPU::create_graph(std::vector<int>& resultVector, int startid,
+                                           int chunksize) {
+  size_t datasetSize = dataset.getNrows();
+
+  if (startid < 0 || static_cast<size_t>(startid) > datasetSize) {
+    throw base::operation_exception("OperationCreateGraphCPU: invalid start index");
+  }
+
+  size_t start = static_cast<size_t>(startid);
+  size_t size = (chunksize <= 0) ? (datasetSize - start)
+                                 : std::min(static_cast<size_t>(chunksize), datasetSize - start);
+  resultVector.resize(size * k);
+
+#pragma omp parallel
+  {
+    NeighborHeap heap;
+    heap.reserve(k);
+
+#pragma omp for schedule(dynamic, 64)
+    for (size_t i = 0; i < size; i++) {
+      heap.clear();
+      searchTree(0, start + i, heap);
+      std::sort_heap(heap.begin(), heap.end());
+
+      for (size_t j = 0; j < k; j++) {
+        resultVector[i * k + j] = static_cast<int>(heap[j].second);
+      }
+    }
+  }
+}
+
+}  // namespace ClusteringCPU
+}  // namespace datadriven
+}  // namespace sgpp
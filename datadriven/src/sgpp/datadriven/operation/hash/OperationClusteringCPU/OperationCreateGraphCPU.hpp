@@ -0,0 +1,83 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace ClusteringCPU {
+
+/**
+ * CPU version of the k nearest neighbor graph creation (see OperationCreateGraphOCL).
+ * The neighbors are found with a k-d tree that is built once for the whole dataset, the queries
+ * of the individual datapoints are distributed with OpenMP.
+ *
+ * The resulting graph has the same layout as the one created by the OpenCL operation: entry
+ * j * k + i contains the index of the i-th nearest neighbor of the j-th datapoint of the
+ * processed chunk, the neighbors are sorted by increasing distance.
+ */
+class OperationCreateGraphCPU {
+ public:
+  /**
+   * Constructor
+   *
+   * @param dataset datapoints (one datapoint per row), the matrix has to outlive the operation
+   * @param k number of neighbors per datapoint
+   * @param maxLeafSize maximum number of datapoints stored in a leaf of the k-d tree
+   */
+  OperationCreateGraphCPU(base::DataMatrix& dataset, size_t k, size_t maxLeafSize = 16);
+
+  /**
+   * Destructor
+   */
+  virtual ~OperationCreateGraphCPU();
+
+  /**
+   * Creates the k nearest neighbor graph for a chunk of the dataset
+   *
+   * @param resultVector the neighbors of the chunk, resized to chunksize * k
+   * @param startid index of the first datapoint of the chunk
+   * @param chunksize number of datapoints in the chunk, 0 for all remaining datapoints
+   */
+  virtual void create_graph(std::vector<int>& resultVector, int startid = 0, int chunksize = 0);
+
+  /// Number of neighbors per datapoint
+  size_t getK() const { return k; }
+
+ protected:
+  /// Node of the k-d tree, leafs have left == right == 0
+  struct TreeNode {
+    size_t begin;
+    size_t end;
+    size_t splitDim;
+    double splitValue;
+    size_t left;
+    size_t right;
+  };
+
+  /// Max-heap of (squared distance, index) pairs of the currently best neighbors
+  typedef std::vector<std::pair<double, size_t>> NeighborHeap;
+
+  size_t buildTree(size_t begin, size_t end);
+  void searchTree(size_t node, size_t queryIndex, NeighborHeap& heap) const;
+
+  base::DataMatrix& dataset;
+  size_t k;
+  size_t maxLeafSize;
+  size_t dimensions;
+  /// Permutation of the datapoint indices, each tree node covers a contiguous range of it
+  std::vector<size_t> permutation;
+  std::vector<TreeNode> tree;
+};
+
+}  // namespace ClusteringCPU
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,108 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OperationPruneGraphCPU.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/operation/BaseOpFactory.hpp>
+#include <sgpp/base/operation/hash/OperationMultipleEval.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace ClusteringCPU {
+
+OperationPruneGraphCPU::OperationPruneGraphCPU(base::Grid& grid, base::DataVector& alpha,
+                                               base::DataMatrix& data, double threshold,
+                                               size_t k, size_t blockSize)
+    : grid(grid),
+      alpha(alpha),
+      data(data),
+      threshold(threshold),
+      k(k),
+      blockSize(std::max<size_t>(blockSize, 1)) {
+  if (k == 0) {
+    throw base::operation_exception("OperationPruneGraphCPU: k has to be positive");
+  }
+}
+
+OperationPruneGraphCPU::~OperationPruneGraphCPU() {}
+
+void OperationPruneGraphCPU::prune_graph(std::vector<int>& graph, size_t startid,
+                                         size_t chunksize) {
+  if (chunksize == 0) {
+    chunksize = graph.size() / k;
+  }
+
+  if (graph.size() < chunksize * k || startid + chunksize > data.getNrows()) {
+    throw base::operation_exception("OperationPruneGraphCPU: graph does not match the dataset");
+  }
+
+  const size_t dimensions = data.getNcols();
+  const double* points = data.getPointer();
+
+  for (size_t blockStart = 0; blockStart < chunksize; blockStart += blockSize) {
+    const size_t blockEnd = std::min(blockStart + blockSize, chunksize);
+    const size_t blockNodes = blockEnd - blockStart;
+
+    // the first rows are the datapoints themselves, followed by the k edge midpoints per node
+    base::DataMatrix evalPoints(blockNodes * (k + 1), dimensions);
+    double* evalData = evalPoints.getPointer();
+
+#pragma omp parallel for
+    for (size_t i = 0; i < blockNodes; i++) {
+      const size_t node = startid + blockStart + i;
+      const double* nodePoint = points + node * dimensions;
+      std::copy(nodePoint, nodePoint + dimensions, evalData + i * dimensions);
+
+      for (size_t j = 0; j < k; j++) {
+        double* midpoint = evalData + (blockNodes + i * k + j) * dimensions;
+        const int neighbor = graph[(blockStart + i) * k + j];
+
+        if (neighbor < 0) {
+          // already removed, the density value is ignored
+          std::copy(nodePoint, nodePoint + dimensions, midpoint);
+          continue;
+        }
+
+        const double* neighborPoint = points + static_cast<size_t>(neighbor) * dimensions;
+
+        for (size_t d = 0; d < dimensions; d++) {
+          midpoint[d] = neighborPoint[d] + (nodePoint[d] - neighborPoint[d]) * 0.5;
+        }
+      }
+    }
+
+    base::DataVector density(evalPoints.getNrows());
+    std::unique_ptr<base::OperationMultipleEval> eval(
+        op_factory::createOperationMultipleEval(grid, evalPoints));
+    eval->mult(alpha, density);
+
+#pragma omp parallel for
+    for (size_t i = 0; i < blockNodes; i++) {
+      int* edges = graph.data() + (blockStart + i) * k;
+
+      if (density[i] < threshold) {
+        std::fill(edges, edges + k, -1);
+        continue;
+      }
+
+      for (size_t j = 0; j < k; j++) {
+        if (edges[j] >= 0 && density[blockNodes + i * k + j] < threshold) {
+          edges[j] = -2;
+        }
+      }
+    }
+  }
+}
+
+}  // namespace ClusteringCPU
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,66 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#pragma once
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/globaldef.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+namespace ClusteringCPU {
+
+/**
+ * CPU version of the density based graph pruning (see OperationPruneGraphOCL).
+ * The sparse grid density is evaluated at the datapoints and at the midpoints of all edges with
+ * OperationMultipleEval. Datapoints with a density below the threshold are removed from the graph
+ * (all their entries are set to -1), edges whose midpoint has a density below the threshold are
+ * deleted (their entry is set to -2).
+ */
+class OperationPruneGraphCPU {
+ public:
+  /**
+   * Constructor
+   *
+   * @param grid sparse grid of the density function
+   * @param alpha surpluses of the density function
+   * @param data datapoints the graph was created for
+   * @param threshold density threshold
+   * @param k number of neighbors per datapoint
+   * @param blockSize number of datapoints whose density values are evaluated at once
+   */
+  OperationPruneGraphCPU(base::Grid& grid, base::DataVector& alpha, base::DataMatrix& data,
+                         double threshold, size_t k, size_t blockSize = 4096);
+
+  /**
+   * Destructor
+   */
+  virtual ~OperationPruneGraphCPU();
+
+  /**
+   * Deletes all nodes and edges within areas of low density which are in the given graph chunk
+   *
+   * @param graph the k nearest neighbor graph of the chunk
+   * @param startid index of the first datapoint of the chunk
+   * @param chunksize number of datapoints in the chunk, 0 for all datapoints of the graph
+   */
+  virtual void prune_graph(std::vector<int>& graph, size_t startid = 0, size_t chunksize = 0);
+
+ protected:
+  base::Grid& grid;
+  base::DataVector& alpha;
+  base::DataMatrix& data;
+  double threshold;
+  size_t k;
+  size_t blockSize;
+};
+
+}  // namespace ClusteringCPU
+}  // namespace datadriven
+}  // namespace sgpp
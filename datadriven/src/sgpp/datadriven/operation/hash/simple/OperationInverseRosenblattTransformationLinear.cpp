@@ -8,7 +8,6 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationLinear.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationDensityConditional.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensityMargTo1D.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensitySampling1D.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
@@ -18,6 +17,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <utility>
 #include <algorithm>
@@ -37,13 +37,17 @@ void OperationInverseRosenblattTransformationLinear::doTransformation(base::Data
   size_t num_samples = pointscdf->getNrows();
   size_t bucket_size = num_samples / num_dims + 1;
 
-  // 1. marginalize to all possible start dimensions
+  // 1. marginalize to all possible start dimensions and compute the CDFs of the marginals once,
+  // they are shared by all samples with the same start dimension
   std::vector<base::Grid*> grids1d(num_dims);
   std::vector<base::DataVector*> alphas1d(num_dims);
+  std::vector<std::vector<double>> cdfCoords(num_dims);
+  std::vector<std::vector<double>> cdfValues(num_dims);
   std::unique_ptr<OperationDensityMargTo1D> marg1d(
       op_factory::createOperationDensityMargTo1D(*this->grid));
   for (size_t idim = 0; idim < num_dims; idim++) {
     marg1d->margToDimX(alpha, grids1d[idim], alphas1d[idim], idim);
+    computeCDF1D(grids1d[idim], alphas1d[idim], cdfCoords[idim], cdfValues[idim]);
   }
 
   // 2. compute the start dimension for each sample
@@ -61,21 +65,26 @@ void OperationInverseRosenblattTransformationLinear::doTransformation(base::Data
 // 3. for every sample do...
 #pragma omp parallel
   {
+    // conditional densities of the start dimensions, built on first use by this thread
+    std::vector<std::unique_ptr<RosenblattConditionalChain>> chains(num_dims);
+    base::DataVector cdfs1d(num_dims);
+    base::DataVector coords1d(num_dims);
+
 #pragma omp for schedule(dynamic)
     for (size_t i = 0; i < pointscdf->getNrows(); i++) {
       // transform the point in the current dimension
       size_t idim = startindices[i];
-      double y = doTransformation1D(grids1d[idim], alphas1d[idim], pointscdf->get(i, idim));
+      double y = evalInverseCDF1D(cdfCoords[idim], cdfValues[idim], pointscdf->get(i, idim));
       // and write it to the output
       points->set(i, idim, y);
 
       // prepare the next dimensions -> read samples
-      base::DataVector cdfs1d(num_dims);
-      base::DataVector coords1d(num_dims);
-
       pointscdf->getRow(i, cdfs1d);
       points->getRow(i, coords1d);
-      doTransformation_start_dimX(this->grid, alpha, idim, &cdfs1d, &coords1d);
+      if (!chains[idim]) {
+        chains[idim] = std::make_unique<RosenblattConditionalChain>(*this->grid, idim);
+      }
+      doTransformation_start_dimX(*chains[idim], alpha, &cdfs1d, &coords1d);
       points->setRow(i, coords1d);
     }
   }
@@ -97,21 +106,25 @@ void OperationInverseRosenblattTransformationLinear::doTransformation(base::Data
   std::unique_ptr<OperationDensityMargTo1D> marg1d(
       op_factory::createOperationDensityMargTo1D(*this->grid));
   marg1d->margToDimX(alpha, g1d, a1d, dim_start);
+  std::vector<double> cdfCoords, cdfValues;
+  computeCDF1D(g1d, a1d, cdfCoords, cdfValues);
 
 #pragma omp parallel
   {
+    RosenblattConditionalChain chain(*this->grid, dim_start);
+    base::DataVector cdfs1d(pointscdf->getNcols());
+    base::DataVector coords1d(points->getNcols());
+
 #pragma omp for schedule(dynamic)
     for (size_t i = 0; i < pointscdf->getNrows(); i++) {
       // 2. 1D transformation on dim_start
-      double y = doTransformation1D(g1d, a1d, pointscdf->get(i, dim_start));
+      double y = evalInverseCDF1D(cdfCoords, cdfValues, pointscdf->get(i, dim_start));
       points->set(i, dim_start, y);
       // 3. for every missing dimension do...
-      base::DataVector cdfs1d(pointscdf->getNcols());
-      base::DataVector coords1d(points->getNcols());
 
       pointscdf->getRow(i, cdfs1d);
       points->getRow(i, coords1d);
-      doTransformation_start_dimX(this->grid, alpha, dim_start, &cdfs1d, &coords1d);
+      doTransformation_start_dimX(chain, alpha, &cdfs1d, &coords1d);
       points->setRow(i, coords1d);
     }
   }
@@ -121,13 +134,17 @@ void OperationInverseRosenblattTransformationLinear::doTransformation(base::Data
 }
 
 void OperationInverseRosenblattTransformationLinear::doTransformation_start_dimX(
-    base::Grid* g_in, base::DataVector* a_in, size_t dim_start, base::DataVector* cdfs1d,
+    RosenblattConditionalChain& chain, base::DataVector* a_in, base::DataVector* cdfs1d,
     base::DataVector* coords1d) {
   size_t dims = coords1d->getSize();  // total dimensions
+  size_t dim_start = chain.getStartDimension();
 
   if ((dims > 1) && (dim_start <= dims - 1)) {
-    size_t curr_dim = dim_start;
-    doTransformation_in_next_dim(g_in, a_in, dim_start, cdfs1d, coords1d, curr_dim);
+    chain.transform(
+        *a_in, *coords1d,
+        [this, cdfs1d, coords1d](base::Grid* g1d, base::DataVector* a1d, size_t curr_dim) {
+          coords1d->set(curr_dim, doTransformation1D(g1d, a1d, cdfs1d->get(curr_dim)));
+        });
   } else if (dims == 1) {
     throw base::operation_exception("Error: # of dimensions = 1. No operation needed!");
   } else {
@@ -137,56 +154,18 @@ void OperationInverseRosenblattTransformationLinear::doTransformation_start_dimX
   return;
 }
 
-void OperationInverseRosenblattTransformationLinear::doTransformation_in_next_dim(
-    base::Grid* g_in, base::DataVector* a_in, size_t op_dim, base::DataVector* cdfs1d,
-    base::DataVector* coords1d, size_t& curr_dim) {
-  size_t dims = cdfs1d->getSize();  // total dimensions
-
-  /* Step 1: do conditional in current dim */
-  base::Grid* g_out = NULL;
-  base::DataVector* a_out = new base::DataVector(1);
-  op_factory::createOperationDensityConditional(*g_in)->doConditional(
-      *a_in, g_out, *a_out, static_cast<unsigned int>(op_dim), coords1d->get(curr_dim));
-
-  // move on to next dim
-  curr_dim = (curr_dim + 1) % dims;
-  op_dim = (op_dim + 1) % g_out->getDimension();
-
-  /* Step 2: draw a sample in next dim */
-  double x = 0;
-
-  if (g_out->getDimension() > 1) {
-    // Marginalize to next dimension
-    base::Grid* g1d = NULL;
-    base::DataVector* a1d = NULL;
-    op_factory::createOperationDensityMargTo1D(*g_out)->margToDimX(a_out, g1d, a1d, op_dim);
-
-    // Draw a sample in next dimension
-    x = doTransformation1D(g1d, a1d, cdfs1d->get(curr_dim));
-    delete g1d;
-    delete a1d;
-
-  } else {
-    // skip Marginalize, directly draw a sample in next dimension
-    x = doTransformation1D(g_out, a_out, cdfs1d->get(curr_dim));
-  }
-
-  /* Step 3: copy sample to output */
-  coords1d->set(curr_dim, x);
-
-  /* Step 4: sample in next dimension */
-  if (g_out->getDimension() > 1)
-    doTransformation_in_next_dim(g_out, a_out, op_dim, cdfs1d, coords1d, curr_dim);
-
-  delete g_out;
-  delete a_out;
-
-  return;
-}
-
 double OperationInverseRosenblattTransformationLinear::doTransformation1D(base::Grid* grid1d,
                                                                           base::DataVector* alpha1d,
                                                                           double coord1d) {
+  std::vector<double> coords, cdfs;
+  computeCDF1D(grid1d, alpha1d, coords, cdfs);
+  return evalInverseCDF1D(coords, cdfs, coord1d);
+}
+
+void OperationInverseRosenblattTransformationLinear::computeCDF1D(base::Grid* grid1d,
+                                                                  base::DataVector* alpha1d,
+                                                                  std::vector<double>& coords,
+                                                                  std::vector<double>& cdfs) {
   /***************** STEP 1. Compute CDF  ********************/
 
   // compute PDF, sort by coordinates
@@ -254,41 +233,32 @@ double OperationInverseRosenblattTransformationLinear::doTransformation1D(base::
     ++it1;
   }
 
-  // compute CDF
-  double tmp_sum;
+  // compute CDF from the prefix sums of the areas
+  double tmp_sum = 0.0;
   unsigned int i = 0;
+  coords.clear();
+  cdfs.clear();
+  coords.reserve(coord_cdf.size());
+  cdfs.reserve(coord_cdf.size());
 
   for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    tmp_sum = 0.0;
-
-    for (unsigned int j = 0; j <= i; ++j) tmp_sum += tmp[j];
-
+    tmp_sum += tmp[i];
     ++i;
-    (*it1).second = tmp_sum / sum;
+    coords.push_back((*it1).first);
+    cdfs.push_back(tmp_sum / sum);
   }
+}
 
-  tmp.clear();
-  coord_pdf.clear();
-  /***************** STEP 1. Done  ********************/
-
-  /***************** STEP 2. Sampling  ********************/
-  double y, x1, x2, y1, y2;
-
+double OperationInverseRosenblattTransformationLinear::evalInverseCDF1D(
+    const std::vector<double>& coords, const std::vector<double>& cdfs, double coord1d) {
   // find cdf interval
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    if ((*it1).second >= coord1d) break;
-  }
+  size_t k = std::lower_bound(cdfs.begin(), cdfs.end(), coord1d) - cdfs.begin();
+  k = std::min(std::max<size_t>(k, 1), cdfs.size() - 1);
 
-  x2 = (*it1).first;
-  y2 = (*it1).second;
-  --it1;
-  x1 = (*it1).first;
-  y1 = (*it1).second;
+  double x1 = coords[k - 1], x2 = coords[k];
+  double y1 = cdfs[k - 1], y2 = cdfs[k];
   // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
-  y = (x2 - x1) / (y2 - y1) * (coord1d - y1) + x1;
-
-  /***************** STEP 2. Done  ********************/
-  return y;
-}  // end of compute_1D_cdf()
+  return (x2 - x1) / (y2 - y1) * (coord1d - y1) + x1;
+}
 }  // namespace datadriven
 }  // namespace sgpp
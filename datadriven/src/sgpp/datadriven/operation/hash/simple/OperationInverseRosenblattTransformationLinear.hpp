@@ -8,9 +8,12 @@
 
 #include <sgpp/base/grid/Grid.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformation.hpp>
+#include <sgpp/datadriven/operation/hash/simple/RosenblattConditionalChain.hpp>
 
 #include <sgpp/globaldef.hpp>
 
+#include <vector>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -46,12 +49,31 @@ class OperationInverseRosenblattTransformationLinear
 
  protected:
   base::Grid* grid;
-  void doTransformation_start_dimX(base::Grid* g_in, base::DataVector* a_in, size_t dim_start,
+  void doTransformation_start_dimX(RosenblattConditionalChain& chain, base::DataVector* a_in,
                                    base::DataVector* cdfs1d, base::DataVector* coords1d);
-  void doTransformation_in_next_dim(base::Grid* g_in, base::DataVector* a_in, size_t op_dim,
-                                    base::DataVector* cdfs1d, base::DataVector* coords1d,
-                                    size_t& curr_dim);
   double doTransformation1D(base::Grid* grid1d, base::DataVector* alpha1d, double coord1d);
+
+  /**
+   * Computes the piecewise linear CDF of a 1D density, which can be reused for many samples
+   *
+   * @param grid1d 1D grid
+   * @param alpha1d coefficients of the density on grid1d
+   * @param coords sorted coordinates of the CDF nodes (including 0 and 1)
+   * @param cdfs values of the CDF at the nodes
+   */
+  void computeCDF1D(base::Grid* grid1d, base::DataVector* alpha1d, std::vector<double>& coords,
+                    std::vector<double>& cdfs);
+
+  /**
+   * Evaluates the inverse of a CDF computed by computeCDF1D
+   *
+   * @param coords sorted coordinates of the CDF nodes
+   * @param cdfs values of the CDF at the nodes
+   * @param coord1d value of the CDF
+   * @return the coordinate at which the CDF attains coord1d
+   */
+  static double evalInverseCDF1D(const std::vector<double>& coords,
+                                 const std::vector<double>& cdfs, double coord1d);
 };
 }  // namespace datadriven
 }  // namespace sgpp
@@ -8,7 +8,6 @@
 #include <sgpp/base/operation/BaseOpFactory.hpp>
 #include <sgpp/base/operation/hash/OperationEval.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationDensityConditional.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensityMargTo1D.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensitySampling1D.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationInverseRosenblattTransformationModBspline.hpp>
@@ -20,6 +19,7 @@
 #include <iostream>
 #include <map>
 #include <utility>
+#include <memory>
 #include <vector>
 
 #ifdef _OPENMP
@@ -60,6 +60,9 @@ void OperationInverseRosenblattTransformationModBspline::doTransformation(
 // 3. for every sample do...
 #pragma omp parallel
   {
+    // conditional densities of the start dimensions, built on first use by this thread
+    std::vector<std::unique_ptr<RosenblattConditionalChain>> chains(num_dims);
+
 #pragma omp for schedule(dynamic)
     for (size_t i = 0; i < pointscdf->getNrows(); i++) {
       // transform the point in the current dimension
@@ -74,7 +77,10 @@ void OperationInverseRosenblattTransformationModBspline::doTransformation(
 
       pointscdf->getRow(i, cdfs1d);
       points->getRow(i, coords1d);
-      doTransformation_start_dimX(this->grid, alpha, idim, &cdfs1d, &coords1d);
+      if (!chains[idim]) {
+        chains[idim] = std::make_unique<RosenblattConditionalChain>(*this->grid, idim);
+      }
+      doTransformation_start_dimX(*chains[idim], alpha, &cdfs1d, &coords1d);
       points->setRow(i, coords1d);
     }
   }
@@ -98,6 +104,8 @@ void OperationInverseRosenblattTransformationModBspline::doTransformation(
 
 #pragma omp parallel
   {
+    RosenblattConditionalChain chain(*this->grid, dim_start);
+
 #pragma omp for schedule(dynamic)
     for (size_t i = 0; i < pointscdf->getNrows(); i++) {
       // 2. 1D transformation on dim_start
@@ -109,7 +117,7 @@ void OperationInverseRosenblattTransformationModBspline::doTransformation(
 
       pointscdf->getRow(i, cdfs1d);
       points->getRow(i, coords1d);
-      doTransformation_start_dimX(this->grid, alpha, dim_start, &cdfs1d, &coords1d);
+      doTransformation_start_dimX(chain, alpha, &cdfs1d, &coords1d);
       points->setRow(i, coords1d);
     }
   }
@@ -119,13 +127,17 @@ void OperationInverseRosenblattTransformationModBspline::doTransformation(
 }
 
 void OperationInverseRosenblattTransformationModBspline::doTransformation_start_dimX(
-    base::Grid* g_in, base::DataVector* a_in, size_t dim_start, base::DataVector* cdfs1d,
+    RosenblattConditionalChain& chain, base::DataVector* a_in, base::DataVector* cdfs1d,
     base::DataVector* coords1d) {
   size_t dims = coords1d->getSize();  // total dimensions
+  size_t dim_start = chain.getStartDimension();
 
   if ((dims > 1) && (dim_start <= dims - 1)) {
-    size_t curr_dim = dim_start;
-    doTransformation_in_next_dim(g_in, a_in, dim_start, cdfs1d, coords1d, curr_dim);
+    chain.transform(
+        *a_in, *coords1d,
+        [this, cdfs1d, coords1d](base::Grid* g1d, base::DataVector* a1d, size_t curr_dim) {
+          coords1d->set(curr_dim, doTransformation1D(g1d, a1d, cdfs1d->get(curr_dim)));
+        });
   } else if (dims == 1) {
     throw base::operation_exception("Error: # of dimensions = 1. No operation needed!");
   } else {
@@ -135,53 +147,6 @@ void OperationInverseRosenblattTransformationModBspline::doTransformation_start_
   return;
 }
 
-void OperationInverseRosenblattTransformationModBspline::doTransformation_in_next_dim(
-    base::Grid* g_in, base::DataVector* a_in, size_t op_dim, base::DataVector* cdfs1d,
-    base::DataVector* coords1d, size_t& curr_dim) {
-  size_t dims = cdfs1d->getSize();  // total dimensions
-
-  /* Step 1: do conditional in current dim */
-  base::Grid* g_out = NULL;
-  base::DataVector* a_out = new base::DataVector(1);
-  op_factory::createOperationDensityConditional(*g_in)->doConditional(
-      *a_in, g_out, *a_out, static_cast<unsigned int>(op_dim), coords1d->get(curr_dim));
-
-  // move on to next dim
-  curr_dim = (curr_dim + 1) % dims;
-  op_dim = (op_dim + 1) % g_out->getDimension();
-
-  /* Step 2: draw a sample in next dim */
-  double x = 0;
-
-  if (g_out->getDimension() > 1) {
-    // Marginalize to next dimension
-    base::Grid* g1d = NULL;
-    base::DataVector* a1d = NULL;
-    op_factory::createOperationDensityMargTo1D(*g_out)->margToDimX(a_out, g1d, a1d, op_dim);
-
-    // Draw a sample in next dimension
-    x = doTransformation1D(g1d, a1d, cdfs1d->get(curr_dim));
-    delete g1d;
-    delete a1d;
-
-  } else {
-    // skip Marginalize, directly draw a sample in next dimension
-    x = doTransformation1D(g_out, a_out, cdfs1d->get(curr_dim));
-  }
-
-  /* Step 3: copy sample to output */
-  coords1d->set(curr_dim, x);
-
-  /* Step 4: sample in next dimension */
-  if (g_out->getDimension() > 1)
-    doTransformation_in_next_dim(g_out, a_out, op_dim, cdfs1d, coords1d, curr_dim);
-
-  delete g_out;
-  delete a_out;
-
-  return;
-}
-
 double OperationInverseRosenblattTransformationModBspline::doTransformation1D(
     base::Grid* grid1d, base::DataVector* alpha1d, double coord1d) {
   std::unique_ptr<OperationTransformation1D> opInverseRosenblatt(
@@ -4,7 +4,6 @@
 // sgpp.sparsegrids.org
 
 #include <sgpp/datadriven/operation/hash/simple/OperationRosenblattTransformationLinear.hpp>
-#include <sgpp/datadriven/operation/hash/simple/OperationDensityConditional.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensityMargTo1D.hpp>
 #include <sgpp/datadriven/operation/hash/simple/OperationDensitySampling1D.hpp>
 #include <sgpp/datadriven/DatadrivenOpFactory.hpp>
@@ -19,6 +18,7 @@
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <utility>
 #include <algorithm>
@@ -35,13 +35,17 @@ void OperationRosenblattTransformationLinear::doTransformation(base::DataVector*
                                                                base::DataMatrix* pointscdf) {
   size_t num_dims = this->grid->getDimension();
 
-  // 1. marginalize to all possible start dimensions
+  // 1. marginalize to all possible start dimensions and compute the CDFs of the marginals once,
+  // they are shared by all samples with the same start dimension
   std::vector<base::Grid*> grids1d(num_dims);
   std::vector<base::DataVector*> alphas1d(num_dims);
+  std::vector<std::vector<double>> cdfCoords(num_dims);
+  std::vector<std::vector<double>> cdfValues(num_dims);
   std::unique_ptr<OperationDensityMargTo1D> marg1d(
       op_factory::createOperationDensityMargTo1D(*this->grid));
   for (size_t idim = 0; idim < num_dims; idim++) {
     marg1d->margToDimX(alpha, grids1d[idim], alphas1d[idim], idim);
+    computeCDF1D(grids1d[idim], alphas1d[idim], cdfCoords[idim], cdfValues[idim]);
   }
 
   // 2. compute the start dimension for each sample
@@ -62,21 +66,26 @@ void OperationRosenblattTransformationLinear::doTransformation(base::DataVector*
 // 3. for every sample do...
 #pragma omp parallel
   {
+    // conditional densities of the start dimensions, built on first use by this thread
+    std::vector<std::unique_ptr<RosenblattConditionalChain>> chains(num_dims);
+    base::DataVector cdfs1d(num_dims);
+    base::DataVector coords1d(num_dims);
+
 #pragma omp for schedule(dynamic)
     for (size_t i = 0; i < points->getNrows(); i++) {
       // transform the point in the current dimension
       size_t idim = startindices[i];
-      double y = doTransformation1D(grids1d[idim], alphas1d[idim], points->get(i, idim));
+      double y = evalCDF1D(cdfCoords[idim], cdfValues[idim], points->get(i, idim));
       // and write it to the output
       pointscdf->set(i, idim, y);
 
       // prepare the next dimensions -> read samples
-      base::DataVector cdfs1d(num_dims);
-      base::DataVector coords1d(num_dims);
-
       points->getRow(i, coords1d);
       pointscdf->getRow(i, cdfs1d);
-      doTransformation_start_dimX(this->grid, alpha, idim, &coords1d, &cdfs1d);
+      if (!chains[idim]) {
+        chains[idim] = std::make_unique<RosenblattConditionalChain>(*this->grid, idim);
+      }
+      doTransformation_start_dimX(*chains[idim], alpha, &coords1d, &cdfs1d);
       pointscdf->setRow(i, cdfs1d);
     }
   }
@@ -98,21 +107,24 @@ void OperationRosenblattTransformationLinear::doTransformation(base::DataVector*
   std::unique_ptr<OperationDensityMargTo1D> marg1d(
       op_factory::createOperationDensityMargTo1D(*this->grid));
   marg1d->margToDimX(alpha, g1d, a1d, dim_start);
+  std::vector<double> cdfCoords, cdfValues;
+  computeCDF1D(g1d, a1d, cdfCoords, cdfValues);
 
 #pragma omp parallel
   {
-#pragma omp for schedule(dynamic)
+    RosenblattConditionalChain chain(*this->grid, dim_start);
+    base::DataVector coords1d(points->getNcols());
+    base::DataVector cdfs1d(points->getNcols());
 
+#pragma omp for schedule(dynamic)
     for (size_t i = 0; i < points->getNrows(); i++) {
-      base::DataVector coords1d(points->getNcols());
-      base::DataVector cdfs1d(points->getNcols());
       // 2. 1D transformation on dim_start
-      double y = doTransformation1D(g1d, a1d, points->get(i, dim_start));
+      double y = evalCDF1D(cdfCoords, cdfValues, points->get(i, dim_start));
       pointscdf->set(i, dim_start, y);
       // 3. for every missing dimension do...
       points->getRow(i, coords1d);
       pointscdf->getRow(i, cdfs1d);
-      doTransformation_start_dimX(this->grid, alpha, dim_start, &coords1d, &cdfs1d);
+      doTransformation_start_dimX(chain, alpha, &coords1d, &cdfs1d);
       pointscdf->setRow(i, cdfs1d);
     }
   }
@@ -122,13 +134,17 @@ void OperationRosenblattTransformationLinear::doTransformation(base::DataVector*
 }
 
 void OperationRosenblattTransformationLinear::doTransformation_start_dimX(
-    base::Grid* g_in, base::DataVector* a_in, size_t dim_start, base::DataVector* coords1d,
+    RosenblattConditionalChain& chain, base::DataVector* a_in, base::DataVector* coords1d,
     base::DataVector* cdfs1d) {
   size_t dims = coords1d->getSize();  // total dimensions
+  size_t dim_start = chain.getStartDimension();
 
   if ((dims > 1) && (dim_start <= dims - 1)) {
-    size_t curr_dim = dim_start;
-    doTransformation_in_next_dim(g_in, a_in, dim_start, coords1d, cdfs1d, curr_dim);
+    chain.transform(
+        *a_in, *coords1d,
+        [this, coords1d, cdfs1d](base::Grid* g1d, base::DataVector* a1d, size_t curr_dim) {
+          cdfs1d->set(curr_dim, doTransformation1D(g1d, a1d, coords1d->get(curr_dim)));
+        });
   } else if (dims == 1) {
     throw base::operation_exception("Error: # of dimensions = 1. No operation needed!");
   } else {
@@ -138,58 +154,18 @@ void OperationRosenblattTransformationLinear::doTransformation_start_dimX(
   return;
 }
 
-void OperationRosenblattTransformationLinear::doTransformation_in_next_dim(
-    base::Grid* g_in, base::DataVector* a_in, size_t op_dim, base::DataVector* coords1d,
-    base::DataVector* cdfs1d, size_t& curr_dim) {
-  size_t dims = coords1d->getSize();  // total dimensions
-  // unsigned int op_dim = curr_dim + 1;  // (curr_dim < dim_x) ? 0 : (unsigned int) dim_x; //
-  // actual dim to be operated on
-
-  /* Step 1: do conditional in current dim */
-  base::Grid* g_out = NULL;
-  base::DataVector* a_out = new base::DataVector(1);
-  op_factory::createOperationDensityConditional(*g_in)->doConditional(
-      *a_in, g_out, *a_out, static_cast<unsigned int>(op_dim), coords1d->get(curr_dim));
-
-  // move on to next dim
-  curr_dim = (curr_dim + 1) % dims;
-  op_dim = (op_dim + 1) % g_out->getDimension();
-
-  /* Step 2: draw a sample in next dim */
-  double y = 0;
-
-  if (g_out->getDimension() > 1) {
-    // Marginalize to next dimension
-    base::Grid* g1d = NULL;
-    base::DataVector* a1d = NULL;
-    op_factory::createOperationDensityMargTo1D(*g_out)->margToDimX(a_out, g1d, a1d, op_dim);
-
-    // Draw a sample in next dimension
-    y = doTransformation1D(g1d, a1d, coords1d->get(curr_dim));
-    delete g1d;
-    delete a1d;
-
-  } else {
-    // skip Marginalize, directly draw a sample in next dimension
-    y = doTransformation1D(g_out, a_out, coords1d->get(curr_dim));
-  }
-
-  /* Step 3: copy sample to output */
-  cdfs1d->set(curr_dim, y);
-
-  /* Step 4: sample in next dimension */
-  if (g_out->getDimension() > 1)
-    doTransformation_in_next_dim(g_out, a_out, op_dim, coords1d, cdfs1d, curr_dim);
-
-  delete g_out;
-  delete a_out;
-
-  return;
-}
-
 double OperationRosenblattTransformationLinear::doTransformation1D(base::Grid* grid1d,
                                                                    base::DataVector* alpha1d,
                                                                    double coord1d) {
+  std::vector<double> coords, cdfs;
+  computeCDF1D(grid1d, alpha1d, coords, cdfs);
+  return evalCDF1D(coords, cdfs, coord1d);
+}
+
+void OperationRosenblattTransformationLinear::computeCDF1D(base::Grid* grid1d,
+                                                           base::DataVector* alpha1d,
+                                                           std::vector<double>& coords,
+                                                           std::vector<double>& cdfs) {
   /***************** STEP 1. Compute CDF  ********************/
   // compute PDF, sort by coordinates
   std::multimap<double, double> coord_pdf, coord_cdf;
@@ -256,41 +232,33 @@ double OperationRosenblattTransformationLinear::doTransformation1D(base::Grid* g
     ++it1;
   }
 
-  // compute CDF
-  double tmp_sum;
+  // compute CDF from the prefix sums of the areas
+  double tmp_sum = 0.0;
   unsigned int i = 0;
+  coords.clear();
+  cdfs.clear();
+  coords.reserve(coord_cdf.size());
+  cdfs.reserve(coord_cdf.size());
 
   for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    tmp_sum = 0.0;
-
-    for (unsigned int j = 0; j <= i; ++j) tmp_sum += tmp[j];
-
+    tmp_sum += tmp[i];
     ++i;
-    (*it1).second = tmp_sum / sum;
+    coords.push_back((*it1).first);
+    cdfs.push_back(tmp_sum / sum);
   }
+}
 
-  tmp.clear();
-  coord_pdf.clear();
-  /***************** STEP 1. Done  ********************/
-
-  /***************** STEP 2. Sampling  ********************/
-  double y, x1, x2, y1, y2;
-
+double OperationRosenblattTransformationLinear::evalCDF1D(const std::vector<double>& coords,
+                                                          const std::vector<double>& cdfs,
+                                                          double coord1d) {
   // find cdf interval
-  for (it1 = coord_cdf.begin(); it1 != coord_cdf.end(); ++it1) {
-    if ((*it1).first >= coord1d) break;
-  }
+  size_t k = std::lower_bound(coords.begin(), coords.end(), coord1d) - coords.begin();
+  k = std::min(std::max<size_t>(k, 1), coords.size() - 1);
 
-  x2 = (*it1).first;
-  y2 = (*it1).second;
-  --it1;
-  x1 = (*it1).first;
-  y1 = (*it1).second;
+  double x1 = coords[k - 1], x2 = coords[k];
+  double y1 = cdfs[k - 1], y2 = cdfs[k];
   // find x (linear interpolation): (y-y1)/(x-x1) = (y2-y1)/(x2-x1)
-  y = (y2 - y1) / (x2 - x1) * (coord1d - x1) + y1;
-
-  /***************** STEP 2. Done  ********************/
-  return y;
-}  // end of compute_1D_cdf()
+  return (y2 - y1) / (x2 - x1) * (coord1d - x1) + y1;
+}
 }  // namespace datadriven
 }  // namespace sgpp
@@ -0,0 +1,198 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/datadriven/operation/hash/simple/RosenblattConditionalChain.hpp>
+
+#include <sgpp/base/exception/operation_exception.hpp>
+#include <sgpp/base/grid/storage/hashmap/HashGridStorage.hpp>
+
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+RosenblattConditionalChain::RosenblattConditionalChain(base::Grid& grid, size_t dimStart)
+    : grid(grid.clone()), dimStart(dimStart) {
+  size_t dims = grid.getDimension();
+
+  // nothing to do, the transformation reports invalid arguments
+  if (dims < 2 || dimStart >= dims) {
+    return;
+  }
+
+  base::Grid* gIn = this->grid.get();
+  size_t currDim = dimStart;
+  size_t opDim = dimStart;
+  steps.resize(dims - 1);
+
+  for (Step& step : steps) {
+    base::GridStorage& gs = gIn->getStorage();
+    auto& basis = gIn->getBasis();
+    step.grid = gIn;
+    step.gridDim = static_cast<unsigned int>(opDim);
+    step.conditionDim = currDim;
+
+    // conditional density, see OperationDensityConditional
+    step.levels.resize(gs.getSize());
+    step.indices.resize(gs.getSize());
+    step.conditional.weights.resize(gs.getSize());
+
+    for (size_t seqNr = 0; seqNr < gs.getSize(); seqNr++) {
+      base::GridPoint& gp = gs.getPoint(seqNr);
+      step.levels[seqNr] = gp.getLevel(step.gridDim);
+      step.indices[seqNr] = gp.getIndex(step.gridDim);
+      double tmpint = 1;
+
+      for (unsigned int d = 0; d < gs.getDimension(); d++) {
+        if (d != step.gridDim) tmpint *= basis.getIntegral(gp.getLevel(d), gp.getIndex(d));
+      }
+
+      step.conditional.weights[seqNr] = tmpint;
+    }
+
+    step.conditionalGrid.reset(project(*gIn, step.gridDim, step.conditional));
+
+    // move on to next dim
+    currDim = (currDim + 1) % dims;
+    opDim = (opDim + 1) % step.conditionalGrid->getDimension();
+    step.nextDim = currDim;
+
+    // marginalize to the next dimension, see OperationDensityMargTo1D
+    size_t numDims = step.conditionalGrid->getDimension();
+
+    if (numDims > 1) {
+      std::vector<unsigned int> margDims;
+      unsigned int count = 0;
+
+      for (unsigned int idim = 0; idim < numDims; idim++) {
+        if (idim != opDim) {
+          margDims.push_back(idim - count);
+          count++;
+        }
+      }
+
+      step.marginals.resize(margDims.size());
+      std::unique_ptr<base::Grid> gMarg;
+
+      for (size_t ix = 0; ix < margDims.size(); ix++) {
+        base::Grid& gSource = (ix == 0) ? *step.conditionalGrid : *gMarg;
+        base::GridStorage& ms = gSource.getStorage();
+        auto& margBasis = gSource.getBasis();
+        Projection& marginal = step.marginals[ix];
+        marginal.weights.resize(ms.getSize());
+
+        for (size_t seqNr = 0; seqNr < ms.getSize(); seqNr++) {
+          base::GridPoint& gp = ms.getPoint(seqNr);
+          marginal.weights[seqNr] =
+              margBasis.getIntegral(gp.getLevel(margDims[ix]), gp.getIndex(margDims[ix]));
+        }
+
+        gMarg.reset(project(gSource, margDims[ix], marginal));
+      }
+
+      step.marginalGrid = std::move(gMarg);
+    }
+
+    gIn = step.conditionalGrid.get();
+  }
+}
+
+size_t RosenblattConditionalChain::getStartDimension() const { return dimStart; }
+
+void RosenblattConditionalChain::transform(const base::DataVector& alpha,
+                                           const base::DataVector& coords,
+                                           const Transformation1D& transformation1D) {
+  const base::DataVector* aIn = &alpha;
+
+  for (Step& step : steps) {
+    auto& basis = step.grid->getBasis();
+    double xbar = coords[step.conditionDim];
+    Projection& conditional = step.conditional;
+    conditional.alpha.resize(step.conditionalGrid->getSize());
+    conditional.alpha.setAll(0.0);
+    double theta = 0;
+
+    for (size_t seqNr = 0; seqNr < aIn->getSize(); seqNr++) {
+      double zeta = basis.eval(step.levels[seqNr], step.indices[seqNr], xbar);
+      theta += (*aIn)[seqNr] * zeta * conditional.weights[seqNr];
+      conditional.alpha[conditional.targets[seqNr]] += (*aIn)[seqNr] * zeta;
+    }
+
+    if (theta != 0) conditional.alpha.mult(1. / theta);
+
+    const base::DataVector* a1d = &conditional.alpha;
+
+    for (Projection& marginal : step.marginals) {
+      size_t size = (&marginal == &step.marginals.back()) ? step.marginalGrid->getSize()
+                                                          : (&marginal + 1)->targets.size();
+      marginal.alpha.resize(size);
+      marginal.alpha.setAll(0.0);
+
+      for (size_t seqNr = 0; seqNr < a1d->getSize(); seqNr++) {
+        marginal.alpha[marginal.targets[seqNr]] += (*a1d)[seqNr] * marginal.weights[seqNr];
+      }
+
+      a1d = &marginal.alpha;
+    }
+
+    base::Grid* grid1d = step.marginals.empty() ? step.conditionalGrid.get()
+                                                : step.marginalGrid.get();
+    transformation1D(grid1d, const_cast<base::DataVector*>(a1d), step.nextDim);
+
+    aIn = &conditional.alpha;
+  }
+}
+
+base::Grid* RosenblattConditionalChain::project(base::Grid& grid, unsigned int mdim,
+                                                Projection& projection) {
+  base::GridStorage& gs = grid.getStorage();
+
+  if (gs.getDimension() < 2) {
+    throw base::operation_exception(
+        "RosenblattConditionalChain: cannot remove a dimension of a 1D grid");
+  }
+
+  base::Grid* mg = grid.createGridOfEquivalentType(gs.getDimension() - 1);
+  base::GridStorage& mgs = mg->getStorage();
+  base::GridPoint mgp(mgs.getDimension());
+
+  // add the points one by one, the grid may be adaptively refined
+  for (size_t seqNr = 0; seqNr < gs.getSize(); seqNr++) {
+    base::GridPoint& gp = gs.getPoint(seqNr);
+
+    for (unsigned int d = 0; d < gs.getDimension(); d++) {
+      if (d < mdim) {
+        mgp.set(d, gp.getLevel(d), gp.getIndex(d));
+      } else if (d > mdim) {
+        mgp.set(d - 1, gp.getLevel(d), gp.getIndex(d));
+      }
+    }
+
+    if (!mgs.isContaining(mgp)) mgs.insert(mgp);
+  }
+
+  mgs.recalcLeafProperty();
+
+  projection.targets.resize(gs.getSize());
+
+  for (size_t seqNr = 0; seqNr < gs.getSize(); seqNr++) {
+    base::GridPoint& gp = gs.getPoint(seqNr);
+
+    for (unsigned int d = 0; d < gs.getDimension(); d++) {
+      if (d < mdim) {
+        mgp.set(d, gp.getLevel(d), gp.getIndex(d));
+      } else if (d > mdim) {
+        mgp.set(d - 1, gp.getLevel(d), gp.getIndex(d));
+      }
+    }
+
+    projection.targets[seqNr] = mgs.getSequenceNumber(mgp);
+  }
+
+  return mg;
+}
+
+}  // namespace datadriven
+}  // namespace sgpp
@@ -0,0 +1,129 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef ROSENBLATTCONDITIONALCHAIN_HPP
+#define ROSENBLATTCONDITIONALCHAIN_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace datadriven {
+
+/**
+ * Precomputed conditional densities for the (inverse) Rosenblatt transformation of a sparse grid
+ * density with a fixed starting dimension.
+ *
+ * For every sample, the transformation conditions the density on the coordinate of the current
+ * dimension, marginalizes the conditional density to the next dimension and transforms the
+ * sample there, until all dimensions are done. Conditioning and marginalizing only change the
+ * coefficients, the resulting grids only depend on the starting dimension. The chain builds
+ * these grids and the maps between their coefficient vectors once, so that a sample only needs
+ * a few sweeps over the coefficients instead of building all grids again. The results are the
+ * same as with OperationDensityConditional and OperationDensityMargTo1D.
+ *
+ * The chain owns its grids and scratch vectors, so every thread needs its own instance.
+ */
+class RosenblattConditionalChain {
+ public:
+  /**
+   * Callback for the 1D transformation of a sample in one dimension. Gets the 1D grid and the
+   * coefficients of the conditional density in this dimension and the dimension of the sample.
+   */
+  typedef std::function<void(base::Grid* grid1d, base::DataVector* alpha1d, size_t dim)>
+      Transformation1D;
+
+  /**
+   * Constructor
+   *
+   * @param grid grid of the density (is cloned)
+   * @param dimStart starting dimension of the transformation
+   */
+  RosenblattConditionalChain(base::Grid& grid, size_t dimStart);
+
+  /**
+   * @return the starting dimension of the transformation
+   */
+  size_t getStartDimension() const;
+
+  /**
+   * Transforms a sample in all dimensions but the starting dimension.
+   *
+   * @param alpha coefficients of the density
+   * @param coords coordinates of the sample. The coordinate of a dimension is read after the
+   * sample was transformed in this dimension, so the callback may set it (inverse transformation).
+   * @param transformation1D called for every dimension but the starting dimension in the order
+   * of the transformation
+   */
+  void transform(const base::DataVector& alpha, const base::DataVector& coords,
+                 const Transformation1D& transformation1D);
+
+ private:
+  /**
+   * Linear map from the coefficients of a grid to the coefficients of the grid with one
+   * dimension less
+   */
+  struct Projection {
+    /// sequence number in the projected grid for every grid point
+    std::vector<size_t> targets;
+    /// integral of the basis function in the removed dimension (marginalization) or over all
+    /// remaining dimensions (conditioning) for every grid point
+    std::vector<double> weights;
+    /// coefficients of the projected grid
+    base::DataVector alpha;
+  };
+
+  /**
+   * Conditioning on one dimension and marginalization of the result to the next one
+   */
+  struct Step {
+    /// grid that is conditioned
+    base::Grid* grid;
+    /// dimension of the grid that is conditioned
+    unsigned int gridDim;
+    /// dimension of the sample on whose coordinate the density is conditioned
+    size_t conditionDim;
+    /// dimension of the sample that is transformed in this step
+    size_t nextDim;
+    /// level and index of the grid points in gridDim
+    std::vector<base::GridPoint::level_type> levels;
+    std::vector<base::GridPoint::index_type> indices;
+    /// conditional density
+    Projection conditional;
+    std::unique_ptr<base::Grid> conditionalGrid;
+    /// successive marginalizations of the conditional density to nextDim
+    std::vector<Projection> marginals;
+    std::unique_ptr<base::Grid> marginalGrid;
+  };
+
+  /**
+   * Builds the grid with dimension mdim removed and the map of the grid points to it, as done by
+   * OperationDensityMarginalize and OperationDensityConditional.
+   *
+   * @param grid the grid
+   * @param mdim the dimension to remove
+   * @param projection targets are set
+   * @return the grid with one dimension less
+   */
+  static base::Grid* project(base::Grid& grid, unsigned int mdim, Projection& projection);
+
+  /// clone of the grid of the density
+  std::unique_ptr<base::Grid> grid;
+  /// starting dimension
+  size_t dimStart;
+  /// steps of the transformation
+  std::vector<Step> steps;
+};
+
+}  // namespace datadriven
+}  // namespace sgpp
+
+#endif /* ROSENBLATTCONDITIONALCHAIN_HPP */
@@ -386,6 +386,126 @@ void DataMatrixDistributed::solveCholesky(const DataMatrixDistributed& l, DataVe
 #endif /* USE_SCALAPACK */
 }
 
+void DataMatrixDistributed::choleskyDecomposition(DataMatrixDistributed& a,
+                                                  DataMatrixDistributed::TRIANGULAR uplo) {
+#ifdef USE_SCALAPACK
+  if (a.getGlobalRows() != a.getGlobalCols()) {
+    throw sgpp::base::algorithm_exception(
+        "DataMatrixDistributed::choleskyDecomposition(): matrix is not square");
+  }
+
+  if (a.isProcessMapped()) {
+    // upper and lower are switched, see solveCholesky()
+    const char* tri = (uplo == TRIANGULAR::LOWER ? upperTriangular : lowerTriangular);
+
+    int info = 0;
+    pdpotrf_(tri, a.getGlobalRows(), a.getLocalPointer(), 1, 1, a.getDescriptor(), info);
+
+    if (info != 0) {
+      throw sgpp::base::algorithm_exception(
+          "DataMatrixDistributed::choleskyDecomposition(): matrix is not positive definite");
+    }
+  }
+#else
+  throw sgpp::base::application_exception("Build without USE_SCALAPACK");
+#endif /* USE_SCALAPACK */
+}
+
+void DataMatrixDistributed::luDecomposition(DataMatrixDistributed& a,
+                                            std::vector<size_t>& pivots) {
+#ifdef USE_SCALAPACK
+  size_t n = a.getGlobalRows();
+
+  if (n != a.getGlobalCols()) {
+    throw sgpp::base::algorithm_exception(
+        "DataMatrixDistributed::luDecomposition(): matrix is not square");
+  } else if (a.rowBlockSize != a.columnBlockSize) {
+    throw sgpp::base::algorithm_exception(
+        "DataMatrixDistributed::luDecomposition(): block sizes have to be equal");
+  }
+
+  // the pivots of each local row are summed up over the grid, processes without data add zeros
+  std::vector<double> globalPivots(n, 0.0);
+
+  if (a.isProcessMapped()) {
+    std::vector<int> localPivots(a.localRows + a.rowBlockSize);
+
+    int info = 0;
+    pdgetrf_(n, n, a.getLocalPointer(), 1, 1, a.getDescriptor(), localPivots.data(), info);
+
+    if (info < 0) {
+      throw sgpp::base::algorithm_exception("DataMatrixDistributed::luDecomposition() failed");
+    } else if (info > 0) {
+      throw sgpp::base::algorithm_exception(
+          "DataMatrixDistributed::luDecomposition(): matrix is singular");
+    }
+
+    // the pivots are replicated in each process column, the first one contributes them
+    // (the local rows of ScaLAPACK are the local columns of the transposed layout)
+    if (a.grid->getCurrentColumn() == 0) {
+      for (size_t localRow = 0; localRow < a.localRows; localRow++) {
+        globalPivots[a.localToGlobalColumnIndex(localRow)] =
+            static_cast<double>(localPivots[localRow] - 1);
+      }
+    }
+
+    Cdgsum2d(a.grid->getContextHandle(), "All", " ", n, 1, globalPivots.data(), n, -1, -1);
+  }
+
+  pivots.resize(n);
+
+  for (size_t i = 0; i < n; i++) {
+    pivots[i] = static_cast<size_t>(globalPivots[i]);
+  }
+#else
+  throw sgpp::base::application_exception("Build without USE_SCALAPACK");
+#endif /* USE_SCALAPACK */
+}
+
+void DataMatrixDistributed::symmetricEigen(DataMatrixDistributed& a,
+                                           DataMatrixDistributed& eigenvectors,
+                                           sgpp::base::DataVector& eigenvalues) {
+#ifdef USE_SCALAPACK
+  size_t n = a.getGlobalRows();
+
+  if (n != a.getGlobalCols()) {
+    throw sgpp::base::algorithm_exception(
+        "DataMatrixDistributed::symmetricEigen(): matrix is not square");
+  } else if (a.rowBlockSize != a.columnBlockSize) {
+    throw sgpp::base::algorithm_exception(
+        "DataMatrixDistributed::symmetricEigen(): block sizes have to be equal");
+  }
+
+  eigenvectors = DataMatrixDistributed(a.grid, n, n, a.columnBlockSize, a.rowBlockSize);
+  eigenvalues.resize(n);
+
+  if (a.isProcessMapped()) {
+    int info = 0;
+    double workSize = 0.0;
+    int iworkSize = 0;
+
+    // workspace query
+    pdsyevd_("V", upperTriangular, n, a.getLocalPointer(), 1, 1, a.getDescriptor(),
+             eigenvalues.getPointer(), eigenvectors.getLocalPointer(), 1, 1,
+             eigenvectors.getDescriptor(), &workSize, -1, &iworkSize, -1, info);
+
+    std::vector<double> work(static_cast<size_t>(workSize));
+    std::vector<int> iwork(std::max(iworkSize, 1));
+    pdsyevd_("V", upperTriangular, n, a.getLocalPointer(), 1, 1, a.getDescriptor(),
+             eigenvalues.getPointer(), eigenvectors.getLocalPointer(), 1, 1,
+             eigenvectors.getDescriptor(), work.data(), static_cast<int>(work.size()),
+             iwork.data(), static_cast<int>(iwork.size()), info);
+
+    if (info != 0) {
+      throw sgpp::base::algorithm_exception(
+          "DataMatrixDistributed::symmetricEigen(): no convergence");
+    }
+  }
+#else
+  throw sgpp::base::application_exception("Build without USE_SCALAPACK");
+#endif /* USE_SCALAPACK */
+}
+
 void DataMatrixDistributed::resize(size_t rows, size_t cols) {
 #ifdef USE_SCALAPACK
   if (getGlobalRows() == rows && getGlobalCols() == cols) {
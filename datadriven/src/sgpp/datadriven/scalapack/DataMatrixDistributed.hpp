@@ -12,6 +12,7 @@
 #pragma once
 
 #include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 #include <sgpp/datadriven/scalapack/scalapack.hpp>
 
@@ -272,6 +273,40 @@ class DataMatrixDistributed {
   static void solveCholesky(const DataMatrixDistributed& l, DataVectorDistributed& b,
                             TRIANGULAR uplo = TRIANGULAR::LOWER);
 
+  /**
+   * Computes the Cholesky decomposition A=LL^T of a symmetric positive definite matrix in place
+   * (pdpotrf). Only the chosen triangle of the matrix is referenced and overwritten, the other
+   * triangle keeps its values.
+   *
+   * @param[in, out] a symmetric positive definite matrix A, is overwritten with the factor
+   * @param[in] uplo triangle in which the factor is stored, default lower triangular
+   */
+  static void choleskyDecomposition(DataMatrixDistributed& a,
+                                    TRIANGULAR uplo = TRIANGULAR::LOWER);
+
+  /**
+   * Computes the LU decomposition PA=LU of a square matrix with partial pivoting in place
+   * (pdgetrf). Requires square blocks. As the matrix is stored transposed, the factors are the
+   * ones of A^T, which equal the ones of A for the symmetric matrices used in the offline phase.
+   *
+   * @param[in, out] a matrix A, is overwritten with L (unit diagonal omitted) and U
+   * @param[out] pivots the global (0-based) row interchanges, row i was swapped with row
+   * pivots[i]. Available on all processes of the grid.
+   */
+  static void luDecomposition(DataMatrixDistributed& a, std::vector<size_t>& pivots);
+
+  /**
+   * Computes all eigenvalues and eigenvectors of a symmetric matrix (pdsyevd). Requires square
+   * blocks.
+   *
+   * @param[in, out] a symmetric matrix A, its content is destroyed
+   * @param[out] eigenvectors the eigenvectors, one per row, is resized to the size of A
+   * @param[out] eigenvalues the eigenvalues in ascending order, available on all processes of the
+   * grid
+   */
+  static void symmetricEigen(DataMatrixDistributed& a, DataMatrixDistributed& eigenvectors,
+                             sgpp::base::DataVector& eigenvalues);
+
   /**
    * Resizes the matrix to rows and cols, data is discarded.
    * @param rows
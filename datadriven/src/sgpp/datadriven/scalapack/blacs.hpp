@@ -47,6 +47,10 @@ void Cdgebs2d(int icontxt, const char *scope, const char *top, size_t m, size_t
 void Cdgebr2d(int icontxt, const char *scope, const char *top, size_t m, size_t n, double *a,
               size_t lda, int rsrc, int csrc);
 
+// element-wise sum over the processes in scope
+void Cdgsum2d(int icontxt, const char *scope, const char *top, size_t m, size_t n, double *a,
+              size_t lda, int rdest, int cdest);
+
 // p2p send/receive
 
 void Cdgesd2d(int icontxt, size_t m, size_t n, const double *a, size_t lda, int rdest, int cdest);
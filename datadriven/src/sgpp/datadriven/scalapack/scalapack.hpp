@@ -55,6 +55,22 @@ void pdpotrs_(const char *uplo, const size_t &n, const size_t &nrhs, const doubl
               const size_t &ia, const size_t &ja, const int *desca, double *b, const size_t &ib,
               const size_t &jb, const int *descb, const int &info);
 
+// Cholesky factorization A=U'*U or A=L*L'
+void pdpotrf_(const char *uplo, const size_t &n, double *a, const size_t &ia, const size_t &ja,
+              const int *desca, int &info);
+
+// LU factorization with partial pivoting A=P*L*U
+void pdgetrf_(const size_t &m, const size_t &n, double *a, const size_t &ia, const size_t &ja,
+              const int *desca, int *ipiv, int &info);
+
+// eigenvalue problems
+
+// all eigenvalues and eigenvectors of a symmetric matrix (divide and conquer)
+void pdsyevd_(const char *jobz, const char *uplo, const size_t &n, double *a, const size_t &ia,
+              const size_t &ja, const int *desca, double *w, double *z, const size_t &iz,
+              const size_t &jz, const int *descz, double *work, const int &lwork, int *iwork,
+              const int &liwork, int &info);
+
 // Level 1 BLAS
 
 // sub(y) := sub(y) + a*sub(x)
@@ -5,8 +5,12 @@
 
 #include <sgpp/datadriven/tools/Dataset.hpp>
 
+#include <sgpp/base/exception/data_exception.hpp>
 #include <sgpp/globaldef.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace sgpp {
 namespace datadriven {
 
@@ -34,5 +38,31 @@ const sgpp::base::DataVector& Dataset::getTargets() const { return targets; }
 
 const sgpp::base::DataMatrix& Dataset::getData() const { return data; }
 
+void Dataset::copyInstances(const Dataset& source, size_t first) {
+  if (source.dimension != dimension || first + numberInstances > source.numberInstances) {
+    throw sgpp::base::data_exception("Dataset::copyInstances : Dimensions do not match");
+  }
+
+  const double* srcSamples = source.data.getPointer() + first * dimension;
+  std::copy(srcSamples, srcSamples + numberInstances * dimension, data.getPointer());
+  const double* srcTargets = source.targets.getPointer() + first;
+  std::copy(srcTargets, srcTargets + numberInstances, targets.getPointer());
+}
+
+void Dataset::copyInstances(const Dataset& source, const std::vector<size_t>& indices) {
+  if (source.dimension != dimension || indices.size() != numberInstances) {
+    throw sgpp::base::data_exception("Dataset::copyInstances : Dimensions do not match");
+  }
+
+  const double* srcSamples = source.data.getPointer();
+  double* destSamples = data.getPointer();
+
+  for (size_t i = 0; i < numberInstances; i++) {
+    const double* srcRow = srcSamples + indices[i] * dimension;
+    std::copy(srcRow, srcRow + dimension, destSamples + i * dimension);
+    targets[i] = source.targets[indices[i]];
+  }
+}
+
 }  // namespace datadriven
 }  // namespace sgpp
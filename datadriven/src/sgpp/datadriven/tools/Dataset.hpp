@@ -12,6 +12,7 @@
 #include <sgpp/globaldef.hpp>
 
 #include <cstddef>
+#include <vector>
 
 namespace sgpp {
 namespace datadriven {
@@ -61,6 +62,25 @@ class Dataset {
    */
   const sgpp::base::DataMatrix& getData() const;
 
+  /**
+   * Copies a contiguous range of instances of another dataset with the same dimension into this
+   * dataset. The samples and the targets are each copied as one block.
+   *
+   * @param source dataset to copy from
+   * @param first index of the first instance in source, the range has as many instances as this
+   * dataset
+   */
+  void copyInstances(const Dataset& source, size_t first);
+
+  /**
+   * Copies the instances with the given indices of another dataset with the same dimension into
+   * this dataset, i.e. instance i of this dataset is instance indices[i] of source.
+   *
+   * @param source dataset to copy from
+   * @param indices indices of the instances in source, as many as this dataset has instances
+   */
+  void copyInstances(const Dataset& source, const std::vector<size_t>& indices);
+
  protected:
   size_t numberInstances;
   size_t dimension;
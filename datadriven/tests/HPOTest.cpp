@@ -137,6 +137,25 @@ BOOST_AUTO_TEST_CASE(upperLevelTest) {
   BOOST_CHECK_LE(res2, 0.3);
 }
 
+BOOST_AUTO_TEST_CASE(concurrentTrialsTest) {
+  // same as above, but with three miners evaluating batches of trials concurrently
+  std::string path("datadriven/tests/hpo_testconfig.json");
+  sgpp::datadriven::DataMiningConfigParser parser(path);
+  sgpp::datadriven::LeastSquaresRegressionMinerFactory minfac{};
+  sgpp::datadriven::BoHyperparameterOptimizer
+      bohpo(minfac.buildMiner(path), new FitterFactoryTester(), parser);
+  sgpp::datadriven::HarmonicaHyperparameterOptimizer
+      harmhpo(minfac.buildMiner(path), new FitterFactoryTester(), parser);
+  for (int i = 0; i < 2; ++i) {
+    bohpo.addWorkerMiner(minfac.buildMiner(path));
+    harmhpo.addWorkerMiner(minfac.buildMiner(path));
+  }
+  double res1 = bohpo.run(false);
+  double res2 = harmhpo.run(false);
+  BOOST_CHECK_LE(res1, 0.3);
+  BOOST_CHECK_LE(res2, 0.3);
+}
+
 BOOST_AUTO_TEST_CASE(harmonicaConfigs) {
   // tests the bit management, especially setParameters and addConstraint by comparing
   // to a vector of all possible bit configurations
@@ -353,6 +372,59 @@ BOOST_AUTO_TEST_CASE(addSamplesGP) {
   }
 }
 
+BOOST_AUTO_TEST_CASE(extendCholeskyGP) {
+  // extending the decomposition by single rows has to match the full decomposition
+  std::vector<BOConfig> initialConfigs{};
+  std::mt19937 generator(77);
+
+  std::vector<int> discOptions = {2, 3};
+  std::vector<int> catOptions = {2, 3};
+  size_t nCont = 3;
+  BOConfig prototype{&discOptions, &catOptions, nCont};
+
+  size_t size = 12;
+  for (size_t i = 0; i < size; i++) {
+    initialConfigs.emplace_back(prototype);
+    initialConfigs[i].randomize(generator);
+    initialConfigs[i].setScore(static_cast<double>(i));
+  }
+  sgpp::datadriven::BayesianOptimization bo(initialConfigs);
+  DataVector scales(prototype.getNPar() + 1, 1);
+
+  DataMatrix kernelmatrix(size, size);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t k = 0; k < i; ++k) {
+      double tmp = bo.kernel(initialConfigs[i].getScaledDistance(initialConfigs[k], scales));
+      kernelmatrix.set(k, i, tmp);
+      kernelmatrix.set(i, k, tmp);
+    }
+    kernelmatrix.set(i, i, 1.1);
+  }
+
+  DataMatrix full;
+  bo.decomposeCholesky(kernelmatrix, full);
+
+  DataMatrix leading(kernelmatrix);
+  leading.resizeQuadratic(1);
+  DataMatrix extended;
+  bo.decomposeCholesky(leading, extended);
+  for (size_t n = 1; n < size; ++n) {
+    DataVector newRow(n);
+    for (size_t k = 0; k < n; ++k) {
+      newRow[k] = kernelmatrix.get(n, k);
+    }
+    bo.extendCholesky(extended, newRow, kernelmatrix.get(n, n));
+  }
+
+  BOOST_REQUIRE_EQUAL(extended.getNrows(), size);
+  BOOST_REQUIRE_EQUAL(extended.getNcols(), size);
+  for (size_t i = 0; i < size; ++i) {
+    for (size_t k = 0; k < size; ++k) {
+      BOOST_CHECK_SMALL(extended.get(i, k) - full.get(i, k), 1e-12);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(fitScalesGP) {
   // test gaussian process fitting by fitting to a second GP
   std::vector<BOConfig> initialConfigs{};
@@ -18,8 +18,11 @@
 #include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
 #include <sgpp/datadriven/datamining/builder/ClassificationMinerFactory.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationClassification.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/FitterConfigurationDensityEstimation.hpp>
 #include <sgpp/datadriven/datamining/modules/fitting/ModelFittingBase.hpp>
+#include <sgpp/datadriven/datamining/modules/fitting/ModelFittingClassification.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
 #include <sgpp/datadriven/scalapack/BlacsProcessGrid.hpp>
 
 #include <cmath>
@@ -31,8 +34,12 @@
 using sgpp::datadriven::BlacsProcessGrid;
 using sgpp::datadriven::ClassificationMinerFactory;
 using sgpp::datadriven::CSVFileSampleProvider;
+using sgpp::datadriven::DataMatrix;
 using sgpp::datadriven::DataVector;
+using sgpp::datadriven::Dataset;
+using sgpp::datadriven::FitterConfigurationClassification;
 using sgpp::datadriven::ModelFittingBase;
+using sgpp::datadriven::ModelFittingClassification;
 using sgpp::datadriven::SparseGridMiner;
 
 double testModel(std::string configFile) {
@@ -82,6 +89,74 @@ BOOST_AUTO_TEST_CASE(testGeo) {
   std::cout << "Accuracy " << accuracy << std::endl;
   BOOST_CHECK(accuracy >= 0);
 }
+BOOST_AUTO_TEST_CASE(testOnOffSharedGrid) {
+  std::string configFileShared = "datadriven/tests/gmm_on_off_chol_shared.json";
+  double accuracyShared = testModel(configFileShared);
+
+  std::string configFile = "datadriven/tests/gmm_on_off_chol_fixed.json";
+  double accuracy = testModel(configFile);
+  std::cout << "Accuracy " << accuracyShared << std::endl;
+  BOOST_CHECK(accuracyShared > 0.7);
+  BOOST_CHECK_CLOSE(accuracyShared, accuracy, 1e-5);
+}
+BOOST_AUTO_TEST_CASE(testOnOffSharedGridDecayMissingClass) {
+  // the second batch only contains samples of the first class, so only the first class may be
+  // decayed by beta, as for the per class models
+  FitterConfigurationClassification config;
+  config.setupDefaults();
+  config.getGridConfig().level_ = 4;
+  config.getRegularizationConfig().lambda_ = 1e-2;
+  config.getDensityEstimationConfig().decomposition_ =
+      sgpp::datadriven::MatrixDecompositionType::Chol;
+  config.getLearnerConfig().beta = 0.5;
+  ModelFittingClassification model(config);
+  config.getLearnerConfig().sharedGrid = true;
+  ModelFittingClassification modelShared(config);
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<double> lower(0.05, 0.55);
+  std::uniform_real_distribution<double> upper(0.45, 0.95);
+  const size_t dim = 2;
+  const size_t numSamples = 100;
+
+  Dataset firstBatch(numSamples, dim);
+  for (size_t i = 0; i < numSamples; i++) {
+    double label = (i % 2 == 0) ? -1.0 : 1.0;
+    for (size_t d = 0; d < dim; d++) {
+      firstBatch.getData().set(i, d, label < 0.0 ? lower(generator) : upper(generator));
+    }
+    firstBatch.getTargets().set(i, label);
+  }
+  Dataset secondBatch(numSamples, dim);
+  for (size_t i = 0; i < numSamples; i++) {
+    for (size_t d = 0; d < dim; d++) {
+      secondBatch.getData().set(i, d, lower(generator));
+    }
+    secondBatch.getTargets().set(i, -1.0);
+  }
+
+  model.fit(firstBatch);
+  model.update(secondBatch);
+  modelShared.fit(firstBatch);
+  modelShared.update(secondBatch);
+
+  const size_t pointsPerDim = 21;
+  DataMatrix testPoints(pointsPerDim * pointsPerDim, dim);
+  for (size_t i = 0; i < pointsPerDim; i++) {
+    for (size_t j = 0; j < pointsPerDim; j++) {
+      testPoints.set(i * pointsPerDim + j, 0, static_cast<double>(i + 1) / (pointsPerDim + 1));
+      testPoints.set(i * pointsPerDim + j, 1, static_cast<double>(j + 1) / (pointsPerDim + 1));
+    }
+  }
+  DataVector predictions(testPoints.getNrows());
+  DataVector predictionsShared(testPoints.getNrows());
+  model.evaluate(testPoints, predictions);
+  modelShared.evaluate(testPoints, predictionsShared);
+
+  for (size_t i = 0; i < testPoints.getNrows(); i++) {
+    BOOST_CHECK_EQUAL(predictionsShared.get(i), predictions.get(i));
+  }
+}
 
 #ifdef USE_SCALAPACK
 BOOST_AUTO_TEST_CASE(testOnOffParallelChol) {
@@ -17,7 +17,9 @@
 #include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorSequential.hpp>
 #include <sgpp/datadriven/datamining/modules/dataSource/shuffling/DataShufflingFunctorCrossValidation.hpp>
 #include <sgpp/datadriven/configuration/CrossvalidationConfiguration.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
 
+#include <memory>
 #include <vector>
 
 using sgpp::datadriven::DataShufflingFunctor;
@@ -25,6 +27,8 @@ using sgpp::datadriven::DataShufflingFunctorSequential;
 using sgpp::datadriven::DataShufflingFunctorRandom;
 using sgpp::datadriven::DataShufflingFunctorCrossValidation;
 using sgpp::datadriven::CrossvalidationConfiguration;
+using sgpp::datadriven::CSVFileSampleProvider;
+using sgpp::datadriven::Dataset;
 
 bool testBijectivity(DataShufflingFunctor& shuffling, size_t numSamples) {
   std::vector<bool> hit(numSamples, false);
@@ -80,6 +84,101 @@ BOOST_AUTO_TEST_CASE(TestShufflingCrossValidation) {
   BOOST_CHECK(testOrder(cvShuffling, expectedOrder));
 }
 
+BOOST_AUTO_TEST_CASE(TestShuffleOncePerEpoch) {
+  // batches cut from the permuted dataset have to match the batches gathered sample by sample
+  std::string path = "datadriven/datasets/gmm/gmm_train.csv";
+  DataShufflingFunctorRandom shuffling{42};
+  CSVFileSampleProvider perBatch(&shuffling, false);
+  CSVFileSampleProvider perEpoch(&shuffling, true);
+  CSVFileSampleProvider unshuffled;
+  perBatch.readFile(path, true);
+  perEpoch.readFile(path, true);
+  unshuffled.readFile(path, true);
+  std::unique_ptr<Dataset> all(unshuffled.getAllSamples());
+  size_t numSamples = all->getNumberInstances();
+  size_t dim = all->getDimension();
+
+  for (size_t epoch = 0; epoch < 2; epoch++) {
+    perBatch.reset();
+    perEpoch.reset();
+    size_t counter = 0;
+    while (counter < numSamples) {
+      std::unique_ptr<Dataset> batch(perBatch.getNextSamples(37));
+      std::unique_ptr<Dataset> slice(perEpoch.getNextSamples(37));
+      BOOST_REQUIRE_EQUAL(batch->getNumberInstances(), slice->getNumberInstances());
+      for (size_t i = 0; i < batch->getNumberInstances(); i++) {
+        size_t srcIdx = shuffling(counter + i, numSamples);
+        BOOST_CHECK_EQUAL(batch->getTargets()[i], all->getTargets()[srcIdx]);
+        BOOST_CHECK_EQUAL(slice->getTargets()[i], all->getTargets()[srcIdx]);
+        for (size_t d = 0; d < dim; d++) {
+          BOOST_CHECK_EQUAL(batch->getData().get(i, d), all->getData().get(srcIdx, d));
+          BOOST_CHECK_EQUAL(slice->getData().get(i, d), all->getData().get(srcIdx, d));
+        }
+      }
+      counter += batch->getNumberInstances();
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestShuffleOncePerEpochWholeDataset) {
+  // taking the whole dataset at once must not break the following calls of the epoch
+  std::string path = "datadriven/datasets/gmm/gmm_train.csv";
+  DataShufflingFunctorRandom shuffling{42};
+  CSVFileSampleProvider perEpoch(&shuffling, true);
+  CSVFileSampleProvider unshuffled;
+  perEpoch.readFile(path, true);
+  unshuffled.readFile(path, true);
+  std::unique_ptr<Dataset> all(unshuffled.getAllSamples());
+  size_t numSamples = all->getNumberInstances();
+
+  std::unique_ptr<Dataset> whole(perEpoch.getAllSamples());
+  BOOST_CHECK_EQUAL(whole->getNumberInstances(), numSamples);
+  std::unique_ptr<Dataset> empty;
+  BOOST_CHECK_NO_THROW(empty.reset(perEpoch.getNextSamples(10)));
+  BOOST_CHECK_EQUAL(empty->getNumberInstances(), 0);
+
+  perEpoch.reset();
+  std::unique_ptr<Dataset> larger(perEpoch.getNextSamples(numSamples + 10));
+  BOOST_CHECK_EQUAL(larger->getNumberInstances(), numSamples);
+  BOOST_CHECK_NO_THROW(empty.reset(perEpoch.getNextSamples(10)));
+  BOOST_CHECK_EQUAL(empty->getNumberInstances(), 0);
+
+  // the next epoch reuses the permuted dataset of the previous epochs
+  perEpoch.reset();
+  std::unique_ptr<Dataset> batch(perEpoch.getNextSamples(10));
+  BOOST_REQUIRE_EQUAL(batch->getNumberInstances(), 10);
+  for (size_t i = 0; i < 10; i++) {
+    size_t srcIdx = shuffling(i, numSamples);
+    BOOST_CHECK_EQUAL(whole->getTargets()[i], all->getTargets()[srcIdx]);
+    BOOST_CHECK_EQUAL(batch->getTargets()[i], all->getTargets()[srcIdx]);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(TestShuffleOncePerEpochCrossValidation) {
+  // the permuted dataset has to follow the fold of the cross validation functor
+  std::string path = "datadriven/datasets/gmm/gmm_train.csv";
+  DataShufflingFunctorRandom randomShuffling{42};
+  CrossvalidationConfiguration cvConfig;
+  cvConfig.kfold_ = 3;
+  DataShufflingFunctorCrossValidation shuffling(cvConfig, &randomShuffling);
+  CSVFileSampleProvider perEpoch(&shuffling, true);
+  CSVFileSampleProvider unshuffled;
+  perEpoch.readFile(path, true);
+  unshuffled.readFile(path, true);
+  std::unique_ptr<Dataset> all(unshuffled.getAllSamples());
+  size_t numSamples = all->getNumberInstances();
+
+  for (size_t fold : {0, 1, 1, 2, 0}) {
+    shuffling.setFold(fold);
+    perEpoch.reset();
+    std::unique_ptr<Dataset> batch(perEpoch.getNextSamples(numSamples));
+    BOOST_REQUIRE_EQUAL(batch->getNumberInstances(), numSamples);
+    for (size_t i = 0; i < numSamples; i++) {
+      BOOST_CHECK_EQUAL(batch->getTargets()[i], all->getTargets()[shuffling(i, numSamples)]);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 
@@ -524,6 +524,131 @@ BOOST_AUTO_TEST_CASE(testIndices) {
   }
 }
 
+// symmetric positive definite test matrix
+DataMatrix createSpdMatrix(size_t n) {
+  DataMatrix matrix(n, n);
+
+  for (size_t i = 0; i < n; i++) {
+    for (size_t j = 0; j < n; j++) {
+      matrix.set(i, j, 1.0 / static_cast<double>(i + j + 1));
+    }
+
+    matrix.set(i, i, matrix.get(i, i) + static_cast<double>(n));
+  }
+
+  return matrix;
+}
+
+BOOST_AUTO_TEST_CASE(testCholeskyDecomposition) {
+  size_t n = 7;
+  DataMatrix spd = createSpdMatrix(n);
+
+  for (auto grid : {localGrid, processGrid}) {
+    if (!grid) {
+      continue;
+    }
+
+    DataMatrixDistributed a = DataMatrixDistributed::fromSharedData(spd.data(), grid, n, n, 2, 2);
+    DataMatrixDistributed::choleskyDecomposition(a);
+    DataMatrix l = a.toLocalDataMatrixBroadcast();
+
+    if (a.isProcessMapped()) {
+      // L * L^T has to reproduce the matrix, the upper triangle is not referenced
+      for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+          double value = 0.0;
+
+          for (size_t k = 0; k <= std::min(i, j); k++) {
+            value += l.get(i, k) * l.get(j, k);
+          }
+
+          BOOST_CHECK_CLOSE(value, spd.get(i, j), 0.0001);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testLUDecomposition) {
+  size_t n = 7;
+  DataMatrix spd = createSpdMatrix(n);
+
+  for (auto grid : {localGrid, processGrid}) {
+    if (!grid) {
+      continue;
+    }
+
+    DataMatrixDistributed a = DataMatrixDistributed::fromSharedData(spd.data(), grid, n, n, 2, 2);
+    std::vector<size_t> pivots;
+    DataMatrixDistributed::luDecomposition(a, pivots);
+    DataMatrix lu = a.toLocalDataMatrixBroadcast();
+
+    if (a.isProcessMapped()) {
+      BOOST_CHECK_EQUAL(pivots.size(), n);
+      lu.transpose();
+
+      // apply the row interchanges to the matrix, L * U has to reproduce it
+      DataMatrix permuted(spd);
+      DataVector row(n);
+      DataVector other(n);
+
+      for (size_t i = 0; i < n; i++) {
+        BOOST_CHECK(pivots[i] >= i && pivots[i] < n);
+        permuted.getRow(i, row);
+        permuted.getRow(pivots[i], other);
+        permuted.setRow(i, other);
+        permuted.setRow(pivots[i], row);
+      }
+
+      for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+          double value = (i <= j) ? lu.get(i, j) : 0.0;
+
+          for (size_t k = 0; k < std::min(i, j + 1); k++) {
+            value += lu.get(i, k) * lu.get(k, j);
+          }
+
+          BOOST_CHECK_CLOSE(value, permuted.get(i, j), 0.0001);
+        }
+      }
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testSymmetricEigen) {
+  size_t n = 7;
+  DataMatrix spd = createSpdMatrix(n);
+
+  for (auto grid : {localGrid, processGrid}) {
+    if (!grid) {
+      continue;
+    }
+
+    DataMatrixDistributed a = DataMatrixDistributed::fromSharedData(spd.data(), grid, n, n, 2, 2);
+    DataMatrixDistributed eigenvectors;
+    DataVector eigenvalues;
+    DataMatrixDistributed::symmetricEigen(a, eigenvectors, eigenvalues);
+    DataMatrix q = eigenvectors.toLocalDataMatrixBroadcast();
+
+    if (a.isProcessMapped()) {
+      BOOST_CHECK_EQUAL(eigenvalues.getSize(), n);
+
+      // each row is an eigenvector: A * v = lambda * v
+      DataVector v(n);
+      DataVector av(n);
+
+      for (size_t k = 0; k < n; k++) {
+        q.getRow(k, v);
+        spd.mult(v, av);
+
+        for (size_t i = 0; i < n; i++) {
+          BOOST_CHECK_SMALL(av.get(i) - eigenvalues.get(k) * v.get(i), 1e-10);
+        }
+      }
+    }
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 #endif
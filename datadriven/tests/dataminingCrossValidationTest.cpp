@@ -0,0 +1,54 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/datadriven/datamining/base/SparseGridMiner.hpp>
+#include <sgpp/datadriven/datamining/builder/DensityEstimationMinerFactory.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+
+using sgpp::datadriven::DensityEstimationMinerFactory;
+using sgpp::datadriven::SparseGridMiner;
+
+namespace {
+
+double crossValidate(size_t parallelFolds, size_t threadsPerFold) {
+  std::string config = "tmpcrossvalidationconfig.json";
+  std::ofstream stream(config);
+  stream << "{\"dataSource\" : { \"filePath\" : "
+         << "\"datadriven/datasets/densityEstimation/2D_StroSkewB2.csv\", \"hasTargets\" : false,"
+         << "\"batchSize\" : 100, \"epochs\" : 2}, \"scorer\" : { \"metric\" : \"NLL\"},"
+         << "\"fitter\" : { \"type\" : \"densityEstimation\", \"gridConfig\" : { \"gridType\" : "
+         << "\"linear\", \"level\" : 4}, \"adaptivityConfig\" : {\"numRefinements\" : 2, "
+         << "\"threshold\" : 0.001, \"maxLevelType\" : false, \"noPoints\" : 3},"
+         << "\"regularizationConfig\" : {\"lambda\" : 0.01}, \"densityEstimationConfig\" : { "
+         << "\"densityEstimationType\" : \"cg\"}, \"crossValidation\" : { \"enable\" : true, "
+         << "\"kFold\" : 4, \"parallelFolds\" : " << parallelFolds << ", \"threadsPerFold\" : "
+         << threadsPerFold << "}}}" << std::endl;
+  stream.close();
+
+  DensityEstimationMinerFactory factory;
+  std::unique_ptr<SparseGridMiner> miner(factory.buildMiner(config));
+  double score = miner->learn(false);
+  remove(config.c_str());
+  return score;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(dataminingCrossValidationTest)
+
+BOOST_AUTO_TEST_CASE(testConcurrentFolds) {
+  double sequentialScore = crossValidate(1, 0);
+  BOOST_CHECK_CLOSE(crossValidate(4, 0), sequentialScore, 1e-6);
+  BOOST_CHECK_CLOSE(crossValidate(2, 1), sequentialScore, 1e-6);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,164 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/datadriven/datamining/modules/dataSource/CSVFileSampleProvider.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceConfig.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourcePrefetcher.hpp>
+#include <sgpp/datadriven/datamining/modules/dataSource/DataSourceSplitting.hpp>
+#include <sgpp/datadriven/tools/Dataset.hpp>
+
+#include <memory>
+#include <stdexcept>
+
+using sgpp::datadriven::CSVFileSampleProvider;
+using sgpp::datadriven::DataSourceConfig;
+using sgpp::datadriven::DataSourcePrefetcher;
+using sgpp::datadriven::DataSourceSplitting;
+using sgpp::datadriven::Dataset;
+
+namespace {
+
+DataSourceConfig batchConfig(size_t prefetchBatches, size_t loaderThreads) {
+  DataSourceConfig config;
+  config.filePath = "datadriven/datasets/gmm/gmm_train.csv";
+  config.hasTargets = true;
+  config.batchSize = 37;
+  config.prefetchBatches = prefetchBatches;
+  config.loaderThreads = loaderThreads;
+  return config;
+}
+
+void checkEqual(const Dataset& expected, const Dataset& actual) {
+  BOOST_REQUIRE_EQUAL(expected.getNumberInstances(), actual.getNumberInstances());
+  BOOST_REQUIRE_EQUAL(expected.getDimension(), actual.getDimension());
+
+  for (size_t i = 0; i < expected.getNumberInstances(); i++) {
+    BOOST_CHECK_EQUAL(expected.getTargets()[i], actual.getTargets()[i]);
+
+    for (size_t d = 0; d < expected.getDimension(); d++) {
+      BOOST_CHECK_EQUAL(expected.getData().get(i, d), actual.getData().get(i, d));
+    }
+  }
+}
+
+// batch i holds i in each entry, after numBatches batches an empty batch is returned
+std::function<Dataset*()> countingReader(size_t& nextBatch, size_t numBatches) {
+  return [&nextBatch, numBatches]() {
+    if (nextBatch >= numBatches) {
+      return new Dataset(0, 2);
+    }
+
+    Dataset* batch = new Dataset(3, 2);
+    batch->getData().setAll(static_cast<double>(nextBatch));
+    batch->getTargets().setAll(static_cast<double>(nextBatch));
+    nextBatch++;
+    return batch;
+  };
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(dataminingDataSourcePrefetchingTest)
+
+BOOST_AUTO_TEST_CASE(testPrefetchedBatchesInOrder) {
+  for (size_t loaderThreads : {1, 3}) {
+    DataSourceSplitting reference(batchConfig(0, 0), new CSVFileSampleProvider());
+    DataSourceSplitting prefetching(batchConfig(2, loaderThreads), new CSVFileSampleProvider());
+
+    // the first epoch is aborted while the loaders are still reading ahead
+    for (size_t epoch = 0; epoch < 3; epoch++) {
+      reference.reset();
+      prefetching.reset();
+      checkEqual(*reference.getValidationData(), *prefetching.getValidationData());
+
+      size_t numBatches = 0;
+      while (epoch > 0 || numBatches < 2) {
+        std::unique_ptr<Dataset> expected(reference.getNextSamples());
+        std::unique_ptr<Dataset> actual(prefetching.getNextSamples());
+        checkEqual(*expected, *actual);
+
+        if (expected->getNumberInstances() == 0) {
+          break;
+        }
+
+        numBatches++;
+      }
+
+      BOOST_CHECK_EQUAL(reference.getCurrentIteration(), prefetching.getCurrentIteration());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPrefetchedTransformation) {
+  const size_t numBatches = 10;
+
+  for (size_t loaderThreads : {1, 3}) {
+    size_t nextBatch = 0;
+    // replaces odd batches by a new dataset and transforms even batches in place
+    DataSourcePrefetcher prefetcher(countingReader(nextBatch, numBatches),
+                                    [](Dataset* batch) {
+                                      Dataset* transformed = batch;
+
+                                      if (batch->getNumberInstances() > 0 &&
+                                          static_cast<size_t>(batch->getTargets()[0]) % 2 == 1) {
+                                        transformed = new Dataset(*batch);
+                                        delete batch;
+                                      }
+
+                                      transformed->getData().mult(2.0);
+                                      return transformed;
+                                    },
+                                    2, loaderThreads);
+
+    for (size_t i = 0; i < numBatches; i++) {
+      std::unique_ptr<Dataset> batch(prefetcher.getNextSamples());
+      BOOST_REQUIRE_EQUAL(batch->getNumberInstances(), 3);
+      BOOST_CHECK_EQUAL(batch->getTargets()[0], static_cast<double>(i));
+      BOOST_CHECK_EQUAL(batch->getData().get(2, 1), 2.0 * static_cast<double>(i));
+    }
+
+    std::unique_ptr<Dataset> last(prefetcher.getNextSamples());
+    BOOST_CHECK_EQUAL(last->getNumberInstances(), 0);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testPrefetchingException) {
+  const size_t numBatches = 10;
+  const size_t failingBatch = 4;
+
+  for (size_t loaderThreads : {1, 3}) {
+    size_t nextBatch = 0;
+    DataSourcePrefetcher prefetcher(countingReader(nextBatch, numBatches),
+                                    [failingBatch](Dataset* batch) {
+                                      if (batch->getNumberInstances() > 0 &&
+                                          batch->getTargets()[0] ==
+                                              static_cast<double>(failingBatch)) {
+                                        throw std::runtime_error("transformation failed");
+                                      }
+
+                                      return batch;
+                                    },
+                                    2, loaderThreads);
+
+    // the batches before the failing one are handed out, then the exception of the loader
+    // thread is rethrown in the consumer
+    for (size_t i = 0; i < failingBatch; i++) {
+      std::unique_ptr<Dataset> batch(prefetcher.getNextSamples());
+      BOOST_CHECK_EQUAL(batch->getTargets()[0], static_cast<double>(i));
+    }
+
+    BOOST_CHECK_THROW(prefetcher.getNextSamples(), std::runtime_error);
+
+    // the loaders were stopped, the next request starts them again
+    std::unique_ptr<Dataset> batch(prefetcher.getNextSamples());
+    BOOST_REQUIRE_EQUAL(batch->getNumberInstances(), 3);
+    BOOST_CHECK_GT(batch->getTargets()[0], static_cast<double>(failingBatch));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,191 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/datadriven/algorithm/DBMatDMSChol.hpp>
+#include <sgpp/datadriven/algorithm/DBMatOfflineChol.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+
+namespace {
+
+/// exposes the factor modification routines of DBMatOfflineChol
+class TestOfflineChol : public sgpp::datadriven::DBMatOfflineChol {
+ public:
+  explicit TestOfflineChol(const DataMatrix& factor) {
+    lhsMatrix = factor;
+    isConstructed = true;
+    isDecomposed = true;
+  }
+
+  using sgpp::datadriven::DBMatOfflineChol::choleskyAddPoints;
+  using sgpp::datadriven::DBMatOfflineChol::choleskyRemovePoints;
+};
+
+DataMatrix randomSPDMatrix(size_t size, std::mt19937& generator) {
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  DataMatrix B(size, size);
+
+  for (size_t i = 0; i < B.getSize(); i++) {
+    B[i] = distribution(generator);
+  }
+
+  DataMatrix A(size, size, 0.0);
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) {
+      double value = (i == j) ? static_cast<double>(size) : 0.0;
+
+      for (size_t l = 0; l < size; l++) {
+        value += B.get(i, l) * B.get(j, l);
+      }
+
+      A.set(i, j, value);
+    }
+  }
+
+  return A;
+}
+
+DataMatrix cholesky(const DataMatrix& A) {
+  size_t size = A.getNrows();
+  DataMatrix L(size, size, 0.0);
+
+  for (size_t j = 0; j < size; j++) {
+    for (size_t i = j; i < size; i++) {
+      double value = A.get(i, j);
+
+      for (size_t l = 0; l < j; l++) {
+        value -= L.get(i, l) * L.get(j, l);
+      }
+
+      L.set(i, j, (i == j) ? std::sqrt(value) : value / L.get(j, j));
+    }
+  }
+
+  return L;
+}
+
+void checkFactor(const DataMatrix& L, const DataMatrix& A) {
+  size_t size = A.getNrows();
+  BOOST_REQUIRE_EQUAL(L.getNrows(), size);
+  BOOST_REQUIRE_EQUAL(L.getNcols(), size);
+
+  for (size_t i = 0; i < size; i++) {
+    BOOST_CHECK_GT(L.get(i, i), 0.0);
+
+    for (size_t j = 0; j < size; j++) {
+      double value = 0.0;
+
+      for (size_t l = 0; l < size; l++) {
+        value += L.get(i, l) * L.get(j, l);
+      }
+
+      if (j > i) {
+        BOOST_CHECK_EQUAL(L.get(i, j), 0.0);
+      }
+
+      BOOST_CHECK_SMALL(value - A.get(i, j), 1e-9 * A.get(i, i));
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestCholeskyBlockUpdate)
+
+BOOST_AUTO_TEST_CASE(testBlockUpdateDowndate) {
+  std::mt19937 generator(7);
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  const size_t size = 37;
+  const size_t rank = 11;
+
+  DataMatrix A = randomSPDMatrix(size, generator);
+  DataMatrix W(size, rank, 0.0);
+
+  // the first rows of W vanish, as for the removal of grid points
+  for (size_t i = 5; i < size; i++) {
+    for (size_t l = 0; l < rank; l++) {
+      W.set(i, l, distribution(generator));
+    }
+  }
+
+  DataMatrix AUpdated(A);
+
+  for (size_t i = 0; i < size; i++) {
+    for (size_t j = 0; j < size; j++) {
+      for (size_t l = 0; l < rank; l++) {
+        AUpdated.set(i, j, AUpdated.get(i, j) + W.get(i, l) * W.get(j, l));
+      }
+    }
+  }
+
+  sgpp::datadriven::DBMatDMSChol solver;
+
+  // small block size to test the chunking of W and the panels of L
+  for (size_t blockSize : {4, 64}) {
+    DataMatrix L = cholesky(A);
+    solver.choleskyBlockUpdate(L, W, false, blockSize);
+    checkFactor(L, AUpdated);
+
+    solver.choleskyBlockUpdate(L, W, true, blockSize);
+    checkFactor(L, A);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testAddRemovePoints) {
+  std::mt19937 generator(3);
+  const size_t size = 50;
+  const size_t numNew = 7;
+  DataMatrix A = randomSPDMatrix(size + numNew, generator);
+
+  // factor of the leading block, the remaining points are added at once
+  DataMatrix ALeading(A);
+  ALeading.resizeQuadratic(size);
+  TestOfflineChol offline(cholesky(ALeading));
+
+  DataMatrix newCols(size + numNew, numNew);
+
+  for (size_t i = 0; i < size + numNew; i++) {
+    for (size_t p = 0; p < numNew; p++) {
+      newCols.set(i, p, A.get(i, size + p));
+    }
+  }
+
+  offline.choleskyAddPoints(newCols, 16);
+  checkFactor(offline.getDecomposedMatrix(), A);
+
+  // remove points scattered over the whole matrix
+  std::vector<size_t> deleted = {3, 4, 20, 21, 35, 56};
+  std::vector<size_t> kept;
+
+  for (size_t i = 0, d = 0; i < size + numNew; i++) {
+    if (d < deleted.size() && deleted[d] == i) {
+      d++;
+    } else {
+      kept.push_back(i);
+    }
+  }
+
+  DataMatrix AReduced(kept.size(), kept.size());
+
+  for (size_t i = 0; i < kept.size(); i++) {
+    for (size_t j = 0; j < kept.size(); j++) {
+      AReduced.set(i, j, A.get(kept[i], kept[j]));
+    }
+  }
+
+  offline.choleskyRemovePoints(deleted);
+  checkFactor(offline.getDecomposedMatrix(), AReduced);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,191 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#if defined(USE_GSL) || defined(USE_LAPACK)
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/datadriven/algorithm/DenseLinearAlgebra.hpp>
+
+#include <random>
+
+using sgpp::base::DataMatrix;
+using sgpp::base::DataVector;
+using sgpp::datadriven::DenseLinearAlgebra;
+
+namespace {
+
+DataMatrix randomMatrix(size_t nrows, size_t ncols, std::mt19937& generator) {
+  std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+  DataMatrix A(nrows, ncols);
+
+  for (size_t i = 0; i < A.getSize(); i++) {
+    A[i] = distribution(generator);
+  }
+
+  return A;
+}
+
+DataMatrix product(const DataMatrix& A, bool transA, const DataMatrix& B, bool transB) {
+  size_t m = transA ? A.getNcols() : A.getNrows();
+  size_t k = transA ? A.getNrows() : A.getNcols();
+  size_t n = transB ? B.getNrows() : B.getNcols();
+  DataMatrix C(m, n, 0.0);
+
+  for (size_t i = 0; i < m; i++) {
+    for (size_t j = 0; j < n; j++) {
+      double value = 0.0;
+
+      for (size_t l = 0; l < k; l++) {
+        value += (transA ? A.get(l, i) : A.get(i, l)) * (transB ? B.get(j, l) : B.get(l, j));
+      }
+
+      C.set(i, j, value);
+    }
+  }
+
+  return C;
+}
+
+DataMatrix randomSPDMatrix(size_t size, std::mt19937& generator) {
+  DataMatrix B = randomMatrix(size, size, generator);
+  DataMatrix A = product(B, false, B, true);
+
+  for (size_t i = 0; i < size; i++) {
+    A.set(i, i, A.get(i, i) + static_cast<double>(size));
+  }
+
+  return A;
+}
+
+void checkIdentity(const DataMatrix& A) {
+  for (size_t i = 0; i < A.getNrows(); i++) {
+    for (size_t j = 0; j < A.getNcols(); j++) {
+      BOOST_CHECK_SMALL(A.get(i, j) - ((i == j) ? 1.0 : 0.0), 1e-10);
+    }
+  }
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestDenseLinearAlgebra)
+
+BOOST_AUTO_TEST_CASE(testCholesky) {
+  std::mt19937 generator(11);
+  const size_t size = 45;
+  DataMatrix A = randomSPDMatrix(size, generator);
+
+  DataMatrix L(A);
+  DenseLinearAlgebra::choleskyDecomposition(L);
+  DataMatrix LLt = product(L, false, L, true);
+
+  for (size_t i = 0; i < size; i++) {
+    BOOST_CHECK_GT(L.get(i, i), 0.0);
+
+    for (size_t j = 0; j < size; j++) {
+      if (j > i) {
+        BOOST_CHECK_EQUAL(L.get(i, j), 0.0);
+      }
+
+      BOOST_CHECK_SMALL(LLt.get(i, j) - A.get(i, j), 1e-10 * A.get(i, i));
+    }
+  }
+
+  DataMatrix inverse(L);
+  DenseLinearAlgebra::choleskyInverse(inverse);
+  checkIdentity(product(A, false, inverse, false));
+}
+
+BOOST_AUTO_TEST_CASE(testInverse) {
+  std::mt19937 generator(12);
+  const size_t size = 30;
+  DataMatrix A = randomMatrix(size, size, generator);
+
+  for (size_t i = 0; i < size; i++) {
+    A.set(i, i, A.get(i, i) + 4.0);
+  }
+
+  DataMatrix inverse(A);
+  DenseLinearAlgebra::inverse(inverse);
+  checkIdentity(product(A, false, inverse, false));
+}
+
+BOOST_AUTO_TEST_CASE(testSymmetricEigen) {
+  std::mt19937 generator(13);
+  const size_t size = 25;
+  DataMatrix A = randomSPDMatrix(size, generator);
+
+  DataMatrix Q(A);
+  DataVector e(size);
+  DenseLinearAlgebra::symmetricEigen(Q, e);
+
+  // A q_c = e_c q_c for the eigenvectors stored in the columns of Q
+  DataMatrix AQ = product(A, false, Q, false);
+
+  for (size_t r = 0; r < size; r++) {
+    for (size_t c = 0; c < size; c++) {
+      BOOST_CHECK_SMALL(AQ.get(r, c) - e[c] * Q.get(r, c), 1e-9 * e.max());
+    }
+  }
+
+  checkIdentity(product(Q, true, Q, false));
+}
+
+BOOST_AUTO_TEST_CASE(testProducts) {
+  std::mt19937 generator(14);
+  const size_t m = 17;
+  const size_t k = 9;
+  const size_t n = 13;
+
+  for (bool transA : {false, true}) {
+    for (bool transB : {false, true}) {
+      DataMatrix A = transA ? randomMatrix(k, m, generator) : randomMatrix(m, k, generator);
+      DataMatrix B = transB ? randomMatrix(n, k, generator) : randomMatrix(k, n, generator);
+      DataMatrix C = randomMatrix(m, n, generator);
+      DataMatrix expected = product(A, transA, B, transB);
+
+      for (size_t i = 0; i < expected.getSize(); i++) {
+        expected[i] = 2.0 * expected[i] + 0.5 * C[i];
+      }
+
+      DenseLinearAlgebra::gemm(transA, transB, 2.0, A, B, 0.5, C);
+
+      for (size_t i = 0; i < expected.getSize(); i++) {
+        BOOST_CHECK_SMALL(C[i] - expected[i], 1e-12);
+      }
+    }
+  }
+
+  DataMatrix A = randomMatrix(m, n, generator);
+  DataVector x(n);
+  DataVector xt(m);
+
+  for (size_t i = 0; i < n; i++) x[i] = static_cast<double>(i) - 3.0;
+  for (size_t i = 0; i < m; i++) xt[i] = 1.0 / static_cast<double>(i + 1);
+
+  DataVector y(m, 1.0);
+  DenseLinearAlgebra::gemv(false, 1.0, A, x, 1.0, y);
+  DataVector yt(n, 0.0);
+  DenseLinearAlgebra::gemv(true, 1.0, A, xt, 0.0, yt);
+
+  for (size_t i = 0; i < m; i++) {
+    double value = 1.0;
+    for (size_t j = 0; j < n; j++) value += A.get(i, j) * x[j];
+    BOOST_CHECK_SMALL(y[i] - value, 1e-12);
+  }
+
+  for (size_t j = 0; j < n; j++) {
+    double value = 0.0;
+    for (size_t i = 0; i < m; i++) value += A.get(i, j) * xt[i];
+    BOOST_CHECK_SMALL(yt[j] - value, 1e-12);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+#endif /* USE_GSL || USE_LAPACK */
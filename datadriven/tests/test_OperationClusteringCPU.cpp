@@ -0,0 +1,131 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataMatrix.hpp>
+#include <sgpp/base/grid/Grid.hpp>
+#include <sgpp/base/grid/generation/GridGenerator.hpp>
+#include <sgpp/datadriven/operation/hash/OperationClusteringCPU/OpFactory.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <utility>
+#include <vector>
+
+using sgpp::base::DataMatrix;
+using sgpp::datadriven::ClusteringCPU::OperationClusteringCPU;
+using sgpp::datadriven::ClusteringCPU::OperationCreateGraphCPU;
+
+namespace {
+
+/// two well separated gaussian blobs in the unit square
+DataMatrix createTwoBlobs(size_t pointsPerBlob) {
+  std::mt19937 generator(42);
+  std::normal_distribution<double> distribution(0.0, 0.04);
+  DataMatrix data(2 * pointsPerBlob, 2);
+
+  for (size_t i = 0; i < 2 * pointsPerBlob; i++) {
+    double center = (i < pointsPerBlob) ? 0.25 : 0.75;
+
+    for (size_t d = 0; d < 2; d++) {
+      data.set(i, d, std::min(std::max(center + distribution(generator), 0.01), 0.99));
+    }
+  }
+
+  return data;
+}
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestOperationClusteringCPU)
+
+BOOST_AUTO_TEST_CASE(testNearestNeighborGraph) {
+  const size_t k = 5;
+  DataMatrix data = createTwoBlobs(150);
+  const size_t n = data.getNrows();
+
+  std::unique_ptr<OperationCreateGraphCPU> operation(
+      sgpp::datadriven::createNearestNeighborGraphCPU(data, k, 2));
+  std::vector<int> graph;
+  operation->create_graph(graph);
+  BOOST_CHECK_EQUAL(graph.size(), n * k);
+
+  // chunked creation has to yield the same neighbors
+  std::vector<int> chunk;
+  operation->create_graph(chunk, 100, 50);
+  BOOST_CHECK(std::equal(chunk.begin(), chunk.end(), graph.begin() + 100 * k));
+
+  // compare the neighbor distances with a brute force search
+  for (size_t i = 0; i < n; i++) {
+    std::vector<std::pair<double, size_t>> distances;
+
+    for (size_t j = 0; j < n; j++) {
+      if (i == j) continue;
+      double dx = data.get(i, 0) - data.get(j, 0);
+      double dy = data.get(i, 1) - data.get(j, 1);
+      distances.push_back(std::make_pair(dx * dx + dy * dy, j));
+    }
+
+    std::sort(distances.begin(), distances.end());
+
+    for (size_t j = 0; j < k; j++) {
+      size_t neighbor = static_cast<size_t>(graph[i * k + j]);
+      BOOST_CHECK_NE(neighbor, i);
+      double dx = data.get(i, 0) - data.get(neighbor, 0);
+      double dy = data.get(i, 1) - data.get(neighbor, 1);
+      BOOST_CHECK_CLOSE(dx * dx + dy * dy, distances[j].first, 1e-10);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(testFindClusters) {
+  // nodes 0-2 form a cluster connected by one directed edge only, node 3 is removed,
+  // node 4 has only deleted edges, nodes 5 and 6 form a second cluster
+  const size_t k = 2;
+  std::vector<int> graph = {1, -2, 2, -2, -2, -2, -1, -1, 3, -2, 6, -2, 5, 3};
+  std::vector<size_t> clusters = OperationClusteringCPU::find_clusters(graph, k);
+  std::vector<size_t> expected = {1, 1, 1, 0, 0, 2, 2};
+  BOOST_CHECK_EQUAL_COLLECTIONS(clusters.begin(), clusters.end(), expected.begin(),
+                                expected.end());
+}
+
+BOOST_AUTO_TEST_CASE(testClusteringTwoBlobs) {
+  DataMatrix data = createTwoBlobs(200);
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(2));
+  grid->getGenerator().regular(5);
+
+  OperationClusteringCPU operation;
+  std::vector<size_t> clusters = operation.calculate_clusters(grid.get(), data, 1e-4, 6, 0.1);
+
+  // both blobs have to be found and separated, most points have to be assigned to them
+  BOOST_CHECK_EQUAL(*std::max_element(clusters.begin(), clusters.end()), 2);
+  size_t assigned = 0;
+
+  for (size_t i = 0; i < data.getNrows(); i++) {
+    if (clusters[i] != 0) assigned++;
+  }
+
+  BOOST_CHECK_GT(assigned, data.getNrows() / 2);
+
+  size_t firstBlob = 0;
+  size_t secondBlob = 0;
+
+  for (size_t i = 0; i < 200; i++) {
+    if (clusters[i] != 0) firstBlob = clusters[i];
+    if (clusters[i + 200] != 0) secondBlob = clusters[i + 200];
+  }
+
+  BOOST_CHECK_NE(firstBlob, secondBlob);
+
+  for (size_t i = 0; i < 200; i++) {
+    BOOST_CHECK(clusters[i] == 0 || clusters[i] == firstBlob);
+    BOOST_CHECK(clusters[i + 200] == 0 || clusters[i + 200] == secondBlob);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,7 +18,8 @@ StdUpDown::StdUpDown(sgpp::base::GridStorage* storage)
 StdUpDown::~StdUpDown() {}
 
 void StdUpDown::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result) {
-  sgpp::base::DataVector beta(result.getSize());
+  UpDownWorkspaceVector betaVector(this->workspace, result.getSize());
+  sgpp::base::DataVector& beta = *betaVector;
   result.setAll(0.0);
 #pragma omp parallel
   {
@@ -30,7 +31,8 @@ void StdUpDown::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& resu
 
 void StdUpDown::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                           sgpp::base::DataVector& result) {
-  sgpp::base::DataVector beta(result.getSize());
+  UpDownWorkspaceVector betaVector(this->workspace, result.getSize());
+  sgpp::base::DataVector& beta = *betaVector;
   result.setAll(0.0);
 
   this->updown(alpha, beta, this->numAlgoDims_ - 1);
@@ -45,40 +47,46 @@ void StdUpDown::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& re
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownWorkspaceVector temp(this->workspace, alpha.getSize());
+    UpDownWorkspaceVector result_temp(this->workspace, alpha.getSize());
+    UpDownWorkspaceVector temp_two(this->workspace, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      up(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1);
+      up(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1);
     }
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1);
-      down(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1);
+      down(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    upAndDown(alpha, result, this->algoDims[dim]);
+  }
+}
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
-    up(alpha, result, this->algoDims[dim]);
+void StdUpDown::upAndDown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                          size_t dim) {
+  bool parallel = this->numAlgoDims_ <= this->maxParallelDims_;
+  UpDownWorkspaceVector temp(this->workspace, alpha.getSize());
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    down(alpha, temp, this->algoDims[dim]);
+#pragma omp task if (parallel) shared(alpha, result)
+  up(alpha, result, dim);
+
+#pragma omp task if (parallel) shared(alpha, temp)
+  down(alpha, *temp, dim);
 
 #pragma omp taskwait
 
-    result.add(temp);
-  }
+  result.add(*temp);
 }
 }  // namespace pde
 }  // namespace sgpp
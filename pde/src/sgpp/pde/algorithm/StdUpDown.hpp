@@ -9,6 +9,7 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/UpDownWorkspacePool.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
 #define TASKS_PARALLEL_UPDOWN 4
@@ -24,6 +25,8 @@ namespace pde {
 /**
  * Implements a standard Up/Down Schema without any operation dim.
  *
+ * Temporary vectors are taken from a workspace pool that is kept between calls of mult. The
+ * pool is shared by all threads (see UpDownWorkspacePool).
  */
 class StdUpDown : public sgpp::base::OperationMatrix {
  public:
@@ -68,6 +71,8 @@ class StdUpDown : public sgpp::base::OperationMatrix {
   const size_t numAlgoDims_;
   /// max number of parallel stages (dimension recursive calls)
   static const size_t maxParallelDims_ = TASKS_PARALLEL_UPDOWN;
+  /// temporary vectors of the recursion, reused between calls
+  UpDownWorkspacePool workspace;
 
   /**
    * Recursive procedure for updown
@@ -78,6 +83,19 @@ class StdUpDown : public sgpp::base::OperationMatrix {
    */
   void updown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
 
+  /**
+   * Computes the sum of the 1D up and down operations in the last dimension of the
+   * recursion. The default implementation executes up and down as two tasks and adds their
+   * results; operations whose up and down parts are sweeps can override it with
+   * base::sweep::sweep1DFused to avoid the grid-sized temporary of the down part.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   * @param dim dimension in which to apply the up- and down-part
+   */
+  virtual void upAndDown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                         size_t dim);
+
   /**
    * 1D up Operation
    *
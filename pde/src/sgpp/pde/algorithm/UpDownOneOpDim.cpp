@@ -34,7 +34,8 @@ void UpDownOneOpDim::mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector&
       for (size_t i = 0; i < this->numAlgoDims_; i++) {
 #pragma omp task firstprivate(i) shared(alpha, result)
         {
-          sgpp::base::DataVector beta(result.getSize());
+          UpDownWorkspaceVector betaVector(this->workspace, result.getSize());
+          sgpp::base::DataVector& beta = *betaVector;
 
           if (this->coefs != NULL) {
             if (this->coefs->get(i) != 0.0) {
@@ -62,7 +63,8 @@ void UpDownOneOpDim::multParallelBuildingBlock(sgpp::base::DataVector& alpha,
                                                size_t operationDim) {
   result.setAll(0.0);
 
-  sgpp::base::DataVector beta(result.getSize());
+  UpDownWorkspaceVector betaVector(this->workspace, result.getSize());
+  sgpp::base::DataVector& beta = *betaVector;
 
   if (this->coefs != NULL) {
     if (this->coefs->get(operationDim) != 0.0) {
@@ -88,42 +90,48 @@ void UpDownOneOpDim::updown(sgpp::base::DataVector& alpha, sgpp::base::DataVecto
     // Unidirectional scheme
     if (dim > 0) {
       // Reordering ups and downs
-      sgpp::base::DataVector temp(alpha.getSize());
-      sgpp::base::DataVector result_temp(alpha.getSize());
-      sgpp::base::DataVector temp_two(alpha.getSize());
+      UpDownWorkspaceVector temp(this->workspace, alpha.getSize());
+      UpDownWorkspaceVector result_temp(this->workspace, alpha.getSize());
+      UpDownWorkspaceVector temp_two(this->workspace, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
       {
-        up(alpha, temp, this->algoDims[dim]);
-        updown(temp, result, dim - 1, op_dim);
+        up(alpha, *temp, this->algoDims[dim]);
+        updown(*temp, result, dim - 1, op_dim);
       }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
       {  // NOLINT(whitespace/braces)
-        updown(alpha, temp_two, dim - 1, op_dim);
-        down(temp_two, result_temp, this->algoDims[dim]);
+        updown(alpha, *temp_two, dim - 1, op_dim);
+        down(*temp_two, *result_temp, this->algoDims[dim]);
       }
 
 #pragma omp taskwait
 
-      result.add(result_temp);
+      result.add(*result_temp);
     } else {
       // Terminates dimension recursion
-      sgpp::base::DataVector temp(alpha.getSize());
+      upAndDown(alpha, result, this->algoDims[dim]);
+    }
+  }
+}
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
-      up(alpha, result, this->algoDims[dim]);
+void UpDownOneOpDim::upAndDown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                               size_t dim) {
+  bool parallel = this->numAlgoDims_ <= this->maxParallelDims_;
+  UpDownWorkspaceVector temp(this->workspace, alpha.getSize());
 
-#pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-      down(alpha, temp, this->algoDims[dim]);
+#pragma omp task if (parallel) shared(alpha, result)
+  up(alpha, result, dim);
+
+#pragma omp task if (parallel) shared(alpha, temp)
+  down(alpha, *temp, dim);
 
 #pragma omp taskwait
 
-      result.add(temp);
-    }
-  }
+  result.add(*temp);
 }
 
 void UpDownOneOpDim::specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
@@ -134,40 +142,40 @@ void UpDownOneOpDim::specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVe
   // Unidirectional scheme
   if (dim > 0) {
     // Reordering ups and downs
-    sgpp::base::DataVector temp(alpha.getSize());
-    sgpp::base::DataVector result_temp(alpha.getSize());
-    sgpp::base::DataVector temp_two(alpha.getSize());
+    UpDownWorkspaceVector temp(this->workspace, alpha.getSize());
+    UpDownWorkspaceVector result_temp(this->workspace, alpha.getSize());
+    UpDownWorkspaceVector temp_two(this->workspace, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp, result)
     {
-      upOpDim(alpha, temp, this->algoDims[dim]);
-      updown(temp, result, dim - 1, op_dim);
+      upOpDim(alpha, *temp, this->algoDims[dim]);
+      updown(*temp, result, dim - 1, op_dim);
     }
 
 // Same from the other direction:
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp_two, \
                                                                         result_temp)
     {  // NOLINT(whitespace/braces)
-      updown(alpha, temp_two, dim - 1, op_dim);
-      downOpDim(temp_two, result_temp, this->algoDims[dim]);
+      updown(alpha, *temp_two, dim - 1, op_dim);
+      downOpDim(*temp_two, *result_temp, this->algoDims[dim]);
     }
 
 #pragma omp taskwait
 
-    result.add(result_temp);
+    result.add(*result_temp);
   } else {
     // Terminates dimension recursion
-    sgpp::base::DataVector temp(alpha.getSize());
+    UpDownWorkspaceVector temp(this->workspace, alpha.getSize());
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, result)
     upOpDim(alpha, result, this->algoDims[dim]);
 
 #pragma omp task if (curNumAlgoDims - dim <= curMaxParallelDims) shared(alpha, temp)
-    downOpDim(alpha, temp, this->algoDims[dim]);
+    downOpDim(alpha, *temp, this->algoDims[dim]);
 
 #pragma omp taskwait
 
-    result.add(temp);
+    result.add(*temp);
   }
 }
 }  // namespace pde
@@ -9,6 +9,7 @@
 #include <sgpp/base/grid/GridStorage.hpp>
 #include <sgpp/base/operation/hash/OperationMatrix.hpp>
 #include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/pde/algorithm/UpDownWorkspacePool.hpp>
 
 #ifndef TASKS_PARALLEL_UPDOWN
 #define TASKS_PARALLEL_UPDOWN 4
@@ -26,6 +27,8 @@ namespace pde {
  *
  * Parallelization with OpenMP 2 / 3 is supported!
  *
+ * Temporary vectors are taken from a workspace pool that is kept between calls of mult. The
+ * pool is shared by all threads (see UpDownWorkspacePool).
  */
 class UpDownOneOpDim : public sgpp::base::OperationMatrix {
  public:
@@ -87,6 +90,8 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   const size_t numAlgoDims_;
   /// max number of parallel stages (dimension recursive calls)
   static const size_t maxParallelDims_ = TASKS_PARALLEL_UPDOWN;
+  /// temporary vectors of the recursion, reused between calls
+  UpDownWorkspacePool workspace;
 
   /**
    * Recursive procedure for updown(), parallel version using OpenMP 3
@@ -110,6 +115,19 @@ class UpDownOneOpDim : public sgpp::base::OperationMatrix {
   virtual void specialOP(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim,
                          size_t op_dim);
 
+  /**
+   * Computes the sum of the 1D up and down operations in the last dimension of the
+   * recursion. The default implementation executes up and down as two tasks and adds their
+   * results; operations whose up and down parts are sweeps can override it with
+   * base::sweep::sweep1DFused to avoid the grid-sized temporary of the down part.
+   *
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   * @param dim dimension in which to apply the up- and down-part
+   */
+  virtual void upAndDown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                         size_t dim);
+
   /**
    * std 1D up operation
    *
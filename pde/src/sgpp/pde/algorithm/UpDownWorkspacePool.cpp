@@ -0,0 +1,75 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/pde/algorithm/UpDownWorkspacePool.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <algorithm>
+#include <functional>
+
+namespace sgpp {
+namespace pde {
+
+UpDownWorkspacePool::UpDownWorkspacePool() {}
+
+UpDownWorkspacePool::~UpDownWorkspacePool() {}
+
+sgpp::base::DataVector* UpDownWorkspacePool::acquire(size_t size) {
+  sgpp::base::DataVector* vec = NULL;
+
+#pragma omp critical(UpDownWorkspacePool)
+  {
+    if (unused.empty()) {
+      vectors.emplace_back(new sgpp::base::DataVector(size));
+      vec = vectors.back().get();
+    } else {
+      vec = unused.back();
+      unused.pop_back();
+    }
+  }
+
+  // zeroing is done outside of the critical section
+  if (vec->getSize() != size) {
+    vec->resize(size);
+  }
+
+  vec->setAll(0.0);
+  return vec;
+}
+
+void UpDownWorkspacePool::release(sgpp::base::DataVector* vec) {
+#pragma omp critical(UpDownWorkspacePool)
+  { unused.push_back(vec); }
+}
+
+size_t UpDownWorkspacePool::getNumberOfVectors() const {
+  size_t numberOfVectors = 0;
+
+#pragma omp critical(UpDownWorkspacePool)
+  { numberOfVectors = vectors.size(); }
+
+  return numberOfVectors;
+}
+
+void UpDownWorkspacePool::clear() {
+#pragma omp critical(UpDownWorkspacePool)
+  {
+    // sort the unused vectors to look them up while removing them in a single pass
+    std::less<sgpp::base::DataVector*> less;
+    std::sort(unused.begin(), unused.end(), less);
+    vectors.erase(std::remove_if(vectors.begin(), vectors.end(),
+                                 [this, &less](const std::unique_ptr<sgpp::base::DataVector>& v) {
+                                   return std::binary_search(unused.begin(), unused.end(),
+                                                             v.get(), less);
+                                 }),
+                  vectors.end());
+
+    unused.clear();
+  }
+}
+
+}  // namespace pde
+}  // namespace sgpp
@@ -0,0 +1,108 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef UPDOWNWORKSPACEPOOL_HPP
+#define UPDOWNWORKSPACEPOOL_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace sgpp {
+namespace pde {
+
+/**
+ * Pool of temporary vectors for the Up/Down schemes.
+ *
+ * Every recursion level of an Up/Down scheme needs temporaries of grid size. Instead of
+ * allocating them in every call of mult, they are taken from this pool and handed back
+ * afterwards, so repeated applications of an operator (e.g. in every CG iteration) reuse the
+ * same memory. The pool grows to the maximal number of simultaneously used vectors and may be
+ * accessed concurrently from OpenMP tasks. It is a single pool per operator, protected by a
+ * critical section; vectors are not bound to threads, since a vector acquired by one task may
+ * be reused by a task running on another thread.
+ */
+class UpDownWorkspacePool {
+ public:
+  /**
+   * Constructor, creates an empty pool
+   */
+  UpDownWorkspacePool();
+
+  /**
+   * Destructor
+   */
+  ~UpDownWorkspacePool();
+
+  /**
+   * Takes a vector from the pool (or allocates a new one if all are in use).
+   *
+   * @param size size of the vector
+   * @return vector of the given size with all entries set to zero
+   */
+  sgpp::base::DataVector* acquire(size_t size);
+
+  /**
+   * Hands a vector obtained by acquire back to the pool.
+   *
+   * @param vec the vector
+   */
+  void release(sgpp::base::DataVector* vec);
+
+  /**
+   * @return number of vectors allocated by the pool so far
+   */
+  size_t getNumberOfVectors() const;
+
+  /**
+   * Frees all vectors that are currently not in use.
+   */
+  void clear();
+
+ private:
+  /// all vectors owned by the pool
+  std::vector<std::unique_ptr<sgpp::base::DataVector>> vectors;
+  /// vectors that are currently not in use
+  std::vector<sgpp::base::DataVector*> unused;
+};
+
+/**
+ * Scoped temporary vector of an UpDownWorkspacePool, acquired on construction and handed back
+ * on destruction.
+ */
+class UpDownWorkspaceVector {
+ public:
+  /**
+   * Constructor
+   *
+   * @param pool the pool the vector is taken from
+   * @param size size of the vector
+   */
+  UpDownWorkspaceVector(UpDownWorkspacePool& pool, size_t size)
+      : pool(pool), vec(pool.acquire(size)) {}
+
+  /**
+   * Destructor
+   */
+  ~UpDownWorkspaceVector() { pool.release(vec); }
+
+  UpDownWorkspaceVector(const UpDownWorkspaceVector&) = delete;
+  UpDownWorkspaceVector& operator=(const UpDownWorkspaceVector&) = delete;
+
+  /// @return the acquired vector
+  sgpp::base::DataVector& operator*() { return *vec; }
+
+ private:
+  UpDownWorkspacePool& pool;
+  sgpp::base::DataVector* vec;
+};
+
+}  // namespace pde
+}  // namespace sgpp
+
+#endif /* UPDOWNWORKSPACEPOOL_HPP */
@@ -37,5 +37,15 @@ void OperationLTwoDotProductLinear::down(sgpp::base::DataVector& alpha,
 
   s.sweep1D(alpha, result, dim);
 }
+
+void OperationLTwoDotProductLinear::upAndDown(sgpp::base::DataVector& alpha,
+                                              sgpp::base::DataVector& result, size_t dim) {
+  // phi * phi
+  PhiPhiUpBBLinear upFunc(this->storage);
+  PhiPhiDownBBLinear downFunc(this->storage);
+  sgpp::base::sweep<PhiPhiUpBBLinear> s(upFunc, *this->storage);
+
+  s.sweep1DFused(downFunc, alpha, result, dim);
+}
 }  // namespace pde
 }  // namespace sgpp
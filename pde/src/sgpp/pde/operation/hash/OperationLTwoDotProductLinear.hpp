@@ -53,6 +53,17 @@ class OperationLTwoDotProductLinear : public StdUpDown {
    * @param result vector to store the results in
    */
   virtual void down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
+
+  /**
+   * Up- and down-step in dimension <i>dim</i> for \f$(\phi_i(x),\phi_j(x))_{L_2}\f$,
+   * executed pole by pole with base::sweep::sweep1DFused (without a grid-sized temporary).
+   *
+   * @param dim dimension in which to apply the up- and down-part
+   * @param alpha vector of coefficients
+   * @param result vector to store the results in
+   */
+  virtual void upAndDown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                         size_t dim);
 };
 }  // namespace pde
 }  // namespace sgpp
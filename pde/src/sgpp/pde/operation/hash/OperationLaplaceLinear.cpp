@@ -32,9 +32,9 @@ void OperationLaplaceLinear::specialOP(sgpp::base::DataVector& alpha,
   // In direction gradient_dim we only calculate the norm of the gradient
   // The up-part is empty, thus omitted
   if (dim > 0) {
-    sgpp::base::DataVector temp(alpha.getSize());
-    updown(alpha, temp, dim - 1, gradient_dim);
-    downOpDim(temp, result, gradient_dim);
+    UpDownWorkspaceVector temp(this->workspace, alpha.getSize());
+    updown(alpha, *temp, dim - 1, gradient_dim);
+    downOpDim(*temp, result, gradient_dim);
   } else {
     // Terminates dimension recursion
     downOpDim(alpha, result, gradient_dim);
@@ -55,6 +55,14 @@ void OperationLaplaceLinear::down(sgpp::base::DataVector& alpha, sgpp::base::Dat
   s.sweep1D(alpha, result, dim);
 }
 
+void OperationLaplaceLinear::upAndDown(sgpp::base::DataVector& alpha,
+                                       sgpp::base::DataVector& result, size_t dim) {
+  PhiPhiUpBBLinear upFunc(this->storage);
+  PhiPhiDownBBLinear downFunc(this->storage);
+  sgpp::base::sweep<PhiPhiUpBBLinear> s(upFunc, *this->storage);
+  s.sweep1DFused(downFunc, alpha, result, dim);
+}
+
 void OperationLaplaceLinear::downOpDim(sgpp::base::DataVector& alpha,
                                        sgpp::base::DataVector& result, size_t dim) {
   DowndPhidPhiBBIterativeLinear myDown(this->storage);
@@ -47,6 +47,9 @@ class OperationLaplaceLinear : public UpDownOneOpDim {
 
   virtual void down(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
 
+  virtual void upAndDown(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result,
+                         size_t dim);
+
   virtual void downOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
 
   virtual void upOpDim(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result, size_t dim);
@@ -28,7 +28,7 @@ void OperationMatrixLTwoDotBsplineClenshawCurtis::mult(sgpp::base::DataVector& a
   const size_t pp1h = (p + 1) >> 1;  // (p + 1) / 2
   const size_t quadOrder = p + 1;
   // clenshawCurtisPoint Method modifies base so we need to cast constness away
-  base::SBsplineClenshawCurtisBase& basis =
+  base::SBsplineClenshawCurtisBase& gridBasis =
     const_cast<base::SBsplineClenshawCurtisBase&>(
       dynamic_cast<const base::SBsplineClenshawCurtisBase&>(grid->getBasis()));
   base::GridStorage& storage = grid->getStorage();
@@ -51,73 +51,84 @@ void OperationMatrixLTwoDotBsplineClenshawCurtis::mult(sgpp::base::DataVector& a
     result[i] = 0;
   }
 
-  for (size_t i = 0; i < gridSize; i++) {
-    for (size_t j = i; j < gridSize; j++) {
-      double temp_ij = 1;
-
-      for (size_t k = 0; k < gridDim; k++) {
-        const base::level_t lik = storage[i].getLevel(k);
-        const base::level_t ljk = storage[j].getLevel(k);
-        const base::index_t iik = storage[i].getIndex(k);
-        const base::index_t ijk = storage[j].getIndex(k);
-        const int left_iik = static_cast<int>(iik) - static_cast<int>(pp1h);
-        const int left_ijk = static_cast<int>(ijk) - static_cast<int>(pp1h);
-        // clenshawCurtisPoint returns 0.0 if point is right of 1.0
-        const double right_iik_point =
-          basis.clenshawCurtisPoint(lik, iik + static_cast<base::index_t>(pp1h));
-        const double right_ijk_point =
-          basis.clenshawCurtisPoint(ljk, ijk + static_cast<base::index_t>(pp1h));
-        // points are not uniformly distributed thus we need to find the left and right boundarys
-        const double left_i = ((left_iik > 0)? basis.clenshawCurtisPoint(lik, left_iik) : 0.0);
-        const double right_i = (right_iik_point == 0.0
-                                || (right_iik_point >= 1.0)) ? 1.0 : right_iik_point;
-        const double left_j = ((left_ijk > 0)? basis.clenshawCurtisPoint(ljk, left_ijk) : 0.0);
-        const double right_j = (right_ijk_point == 0.0
-                                || (right_ijk_point >= 1.0)) ? 1.0 : right_ijk_point;
-
-        // Check if ansatz functions overlap. We need to use the actual position of the
-        // boundaries because the index values iik and ijk might be for different levels.
-        if (left_j > right_i && left_i > right_j) {
-          // Ansatz functions do not not overlap:
-          temp_ij = 0.0;
-          break;
-        } else {
-          size_t start;
-          size_t stop;
-          double scaling;
-          // find the finer one of the two levels and calculate the first and last intervall
-          const base::level_t finest_l = std::max(lik, ljk);
-          // start and stop are the *absolute* index values of the interval we want to sum up
-          if (lik >= ljk) {
-            start = ((iik < pp1h) ? 0 : (iik - pp1h));
-            stop = std::min(iik + pp1h - 1, static_cast<size_t>((1 << lik) - 1));
+#pragma omp parallel
+  {
+    sgpp::base::DataVector privateResult(gridSize, 0.0);
+    // evaluating the basis is not thread-safe, each thread works on its own copy
+    sgpp::base::SBsplineClenshawCurtisBase basis(gridBasis);
+
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < gridSize; i++) {
+      for (size_t j = i; j < gridSize; j++) {
+        double temp_ij = 1;
+
+        for (size_t k = 0; k < gridDim; k++) {
+          const base::level_t lik = storage[i].getLevel(k);
+          const base::level_t ljk = storage[j].getLevel(k);
+          const base::index_t iik = storage[i].getIndex(k);
+          const base::index_t ijk = storage[j].getIndex(k);
+          const int left_iik = static_cast<int>(iik) - static_cast<int>(pp1h);
+          const int left_ijk = static_cast<int>(ijk) - static_cast<int>(pp1h);
+          // clenshawCurtisPoint returns 0.0 if point is right of 1.0
+          const double right_iik_point =
+            basis.clenshawCurtisPoint(lik, iik + static_cast<base::index_t>(pp1h));
+          const double right_ijk_point =
+            basis.clenshawCurtisPoint(ljk, ijk + static_cast<base::index_t>(pp1h));
+          // points are not uniformly distributed thus we need to find the left and right boundarys
+          const double left_i = ((left_iik > 0)? basis.clenshawCurtisPoint(lik, left_iik) : 0.0);
+          const double right_i = (right_iik_point == 0.0
+                                  || (right_iik_point >= 1.0)) ? 1.0 : right_iik_point;
+          const double left_j = ((left_ijk > 0)? basis.clenshawCurtisPoint(ljk, left_ijk) : 0.0);
+          const double right_j = (right_ijk_point == 0.0
+                                  || (right_ijk_point >= 1.0)) ? 1.0 : right_ijk_point;
+
+          // Check if ansatz functions overlap. We need to use the actual position of the
+          // boundaries because the index values iik and ijk might be for different levels.
+          if (left_j > right_i && left_i > right_j) {
+            // Ansatz functions do not not overlap:
+            temp_ij = 0.0;
+            break;
           } else {
-            start = ((ijk < pp1h) ? 0 : (ijk - pp1h));
-            stop = std::min(ijk + pp1h - 1, static_cast<size_t>((1 << ljk) - 1));
-          }
-          double temp_res = 0.0;
-          for (size_t n = start; n <= stop; n++) {
-            double left = std::max(basis.clenshawCurtisPoint(
-                                                      finest_l,
-                                                      static_cast<base::index_t>(n)), 0.0);
-            double right = std::min(basis.clenshawCurtisPoint(
-                                                       finest_l,
-                                                       static_cast<base::index_t>(n+1)), 1.0);
-            scaling = right - left;
-            for (size_t c = 0; c < quadOrder; c++) {
-              const double x = left + scaling * coordinates[c];
-              temp_res += scaling *
-                         (weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x));
+            size_t start;
+            size_t stop;
+            double scaling;
+            // find the finer one of the two levels and calculate the first and last intervall
+            const base::level_t finest_l = std::max(lik, ljk);
+            // start and stop are the *absolute* index values of the interval we want to sum up
+            if (lik >= ljk) {
+              start = ((iik < pp1h) ? 0 : (iik - pp1h));
+              stop = std::min(iik + pp1h - 1, static_cast<size_t>((1 << lik) - 1));
+            } else {
+              start = ((ijk < pp1h) ? 0 : (ijk - pp1h));
+              stop = std::min(ijk + pp1h - 1, static_cast<size_t>((1 << ljk) - 1));
             }
+            double temp_res = 0.0;
+            for (size_t n = start; n <= stop; n++) {
+              double left = std::max(basis.clenshawCurtisPoint(
+                                                        finest_l,
+                                                        static_cast<base::index_t>(n)), 0.0);
+              double right = std::min(basis.clenshawCurtisPoint(
+                                                         finest_l,
+                                                         static_cast<base::index_t>(n+1)), 1.0);
+              scaling = right - left;
+              for (size_t c = 0; c < quadOrder; c++) {
+                const double x = left + scaling * coordinates[c];
+                temp_res += scaling *
+                           (weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x));
+              }
+            }
+            temp_ij *= temp_res;
           }
-          temp_ij *= temp_res;
         }
-      }
 
-      result[i] += temp_ij * alpha[j];
-      if (i != j)
-        result[j] += temp_ij * alpha[i];
+        privateResult[i] += temp_ij * alpha[j];
+        if (i != j)
+          privateResult[j] += temp_ij * alpha[i];
+      }
     }
+
+#pragma omp critical
+    { result.add(privateResult); }
   }
 }
 }  // namespace pde
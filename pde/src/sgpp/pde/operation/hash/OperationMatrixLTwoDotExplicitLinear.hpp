@@ -58,13 +58,15 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
   virtual void mult(sgpp::base::DataVector& alpha, sgpp::base::DataVector& result);
 
   /**
-   * generalization of "buildMatrix" function, creates L2-dot-product matrix for specified bounds
+   * generalization of "buildMatrix" function, creates L2-dot-product matrix for specified bounds.
+   * If all bounds are zero, the full symmetric matrix is built, else the entry (i, j) of the block
+   * is stored at (i - i_start, j - j_start) of mat.
    * @param mat matrix for storage of L2 producs
    * @param grid the underlying grid
    * @param i_start start index for row iteration
-   * @param i_end end index for row iteration
+   * @param i_end end index for row iteration (0 for the grid size)
    * @param j_start start index for column iteration
-   * @param j_end end index for column iteration
+   * @param j_end end index for column iteration (0 for the grid size)
    */
   inline void buildMatrixWithBounds(sgpp::base::DataMatrix* mat, sgpp::base::Grid* grid,
                                     size_t i_start = 0, size_t i_end = 0, size_t j_start = 0,
@@ -82,12 +84,13 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
 
     // init standard values
     i_end = i_end == 0 ? gridSize : i_end;
+    j_end = j_end == 0 ? gridSize : j_end;
 
     for (size_t i = i_start; i < i_end; i++) {
-      j_start = j_start == 0 ? i : j_start;
-      j_end = j_end == 0 ? gridSize : j_end;
+      // the quadratic matrix is symmetric, only its upper triangle is computed
+      size_t j_begin = mat_quadratic ? i : j_start;
 #pragma omp parallel for schedule(guided)
-      for (size_t j = j_start; j < j_end; j++) {
+      for (size_t j = j_begin; j < j_end; j++) {
         double res = 1;
 
         for (size_t k = 0; k < gridDim; k++) {
@@ -133,7 +136,7 @@ class OperationMatrixLTwoDotExplicitLinear : public sgpp::base::OperationMatrix
           mat->set(i, j, res);
           mat->set(j, i, res);
         } else {
-          mat->set(i, j - j_start, res);
+          mat->set(i - i_start, j - j_start, res);
         }
       }
     }
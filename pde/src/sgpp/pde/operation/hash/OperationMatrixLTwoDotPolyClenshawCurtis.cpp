@@ -50,40 +50,49 @@ void OperationMatrixLTwoDotPolyClenshawCurtis::mult(sgpp::base::DataVector& alph
     result[i] = 0;
   }
 
-  for (size_t i = 0; i < gridSize; i++) {
-    for (size_t j = i; j < gridSize; j++) {
-      double temp_ij = 1;
-
-      for (size_t k = 0; k < gridDim; k++) {
-        const base::level_t lik = storage[i].getLevel(k);
-        const base::level_t ljk = storage[j].getLevel(k);
-        const base::index_t iik = storage[i].getIndex(k);
-        const base::index_t ijk = storage[j].getIndex(k);
-        const double left_i = clenshawCurtisTable.getPoint(lik, iik - 1);
-        const double right_i = clenshawCurtisTable.getPoint(lik, iik + 1);
-        const double left_j = clenshawCurtisTable.getPoint(ljk, ijk - 1);
-        const double right_j = clenshawCurtisTable.getPoint(ljk, ijk + 1);
-
-        if (left_j >= right_i || left_i >= right_j) {
-          // Ansatz functions do not not overlap:
-          temp_ij = 0.0;
-          break;
-        } else {
-          const double left = std::max(left_i, left_j);
-          const double right = std::min(right_i, right_j);
-          const double scaling = right - left;
-          double temp_res = 0.0;
-          for (size_t c = 0; c < quadOrder; c++) {
-            const double x = left + scaling * coordinates[c];
-            temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
+#pragma omp parallel
+  {
+    sgpp::base::DataVector privateResult(gridSize, 0.0);
+
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < gridSize; i++) {
+      for (size_t j = i; j < gridSize; j++) {
+        double temp_ij = 1;
+
+        for (size_t k = 0; k < gridDim; k++) {
+          const base::level_t lik = storage[i].getLevel(k);
+          const base::level_t ljk = storage[j].getLevel(k);
+          const base::index_t iik = storage[i].getIndex(k);
+          const base::index_t ijk = storage[j].getIndex(k);
+          const double left_i = clenshawCurtisTable.getPoint(lik, iik - 1);
+          const double right_i = clenshawCurtisTable.getPoint(lik, iik + 1);
+          const double left_j = clenshawCurtisTable.getPoint(ljk, ijk - 1);
+          const double right_j = clenshawCurtisTable.getPoint(ljk, ijk + 1);
+
+          if (left_j >= right_i || left_i >= right_j) {
+            // Ansatz functions do not not overlap:
+            temp_ij = 0.0;
+            break;
+          } else {
+            const double left = std::max(left_i, left_j);
+            const double right = std::min(right_i, right_j);
+            const double scaling = right - left;
+            double temp_res = 0.0;
+            for (size_t c = 0; c < quadOrder; c++) {
+              const double x = left + scaling * coordinates[c];
+              temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
+            }
+            temp_ij *= scaling*temp_res;
           }
-          temp_ij *= scaling*temp_res;
         }
+        privateResult[i] += temp_ij * alpha[j];
+        if (i != j)
+          privateResult[j] += temp_ij * alpha[i];
       }
-      result[i] += temp_ij * alpha[j];
-      if (i != j)
-        result[j] += temp_ij * alpha[i];
     }
+
+#pragma omp critical
+    { result.add(privateResult); }
   }
 }
 }  // namespace pde
@@ -50,62 +50,71 @@ void OperationMatrixLTwoDotPolyClenshawCurtisBoundary::mult(sgpp::base::DataVect
     result[i] = 0;
   }
 
-  for (size_t i = 0; i < gridSize; i++) {
-    for (size_t j = i; j < gridSize; j++) {
-      double temp_ij = 1;
-
-      for (size_t k = 0; k < gridDim; k++) {
-        const base::level_t lik = storage[i].getLevel(k);
-        const base::level_t ljk = storage[j].getLevel(k);
-        const base::index_t iik = storage[i].getIndex(k);
-        const base::index_t ijk = storage[j].getIndex(k);
-        // points are not uniformly distributed thus we need to find the left and right boundarys
-        double left_i;
-        double right_i;
-        double left_j;
-        double right_j;
-        // correct boundary cases
-        // left i
-        if (iik == 0)
-          left_i = 0;
-        else
-          left_i = clenshawCurtisTable.getPoint(lik, iik - 1);
-        // left j
-        if (ijk == 0)
-          left_j = 0;
-        else
-          left_j = clenshawCurtisTable.getPoint(ljk, ijk - 1);
-        // right i
-        if (iik == static_cast<base::index_t>(1 << lik))
-          right_i = clenshawCurtisTable.getPoint(lik, iik);
-        else
-          right_i = clenshawCurtisTable.getPoint(lik, iik + 1);
-        // right j
-        if (ijk == static_cast<base::index_t>(1 << ljk))
-          right_j = clenshawCurtisTable.getPoint(ljk, ijk);
-        else
-          right_j = clenshawCurtisTable.getPoint(ljk, ijk + 1);
-
-        if (left_j >= right_i || left_i >= right_j) {
-          // Ansatz functions do not not overlap:
-          temp_ij = 0.0;
-          break;
-        } else {
-          const double left = std::max(left_i, left_j);
-          const double right = std::min(right_i, right_j);
-          const double scaling = right - left;
-          double temp_res = 0.0;
-          for (size_t c = 0; c < quadOrder; c++) {
-            const double x = left + scaling * coordinates[c];
-            temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
+#pragma omp parallel
+  {
+    sgpp::base::DataVector privateResult(gridSize, 0.0);
+
+#pragma omp for schedule(dynamic)
+    for (size_t i = 0; i < gridSize; i++) {
+      for (size_t j = i; j < gridSize; j++) {
+        double temp_ij = 1;
+
+        for (size_t k = 0; k < gridDim; k++) {
+          const base::level_t lik = storage[i].getLevel(k);
+          const base::level_t ljk = storage[j].getLevel(k);
+          const base::index_t iik = storage[i].getIndex(k);
+          const base::index_t ijk = storage[j].getIndex(k);
+          // points are not uniformly distributed thus we need to find the left and right boundarys
+          double left_i;
+          double right_i;
+          double left_j;
+          double right_j;
+          // correct boundary cases
+          // left i
+          if (iik == 0)
+            left_i = 0;
+          else
+            left_i = clenshawCurtisTable.getPoint(lik, iik - 1);
+          // left j
+          if (ijk == 0)
+            left_j = 0;
+          else
+            left_j = clenshawCurtisTable.getPoint(ljk, ijk - 1);
+          // right i
+          if (iik == static_cast<base::index_t>(1 << lik))
+            right_i = clenshawCurtisTable.getPoint(lik, iik);
+          else
+            right_i = clenshawCurtisTable.getPoint(lik, iik + 1);
+          // right j
+          if (ijk == static_cast<base::index_t>(1 << ljk))
+            right_j = clenshawCurtisTable.getPoint(ljk, ijk);
+          else
+            right_j = clenshawCurtisTable.getPoint(ljk, ijk + 1);
+
+          if (left_j >= right_i || left_i >= right_j) {
+            // Ansatz functions do not not overlap:
+            temp_ij = 0.0;
+            break;
+          } else {
+            const double left = std::max(left_i, left_j);
+            const double right = std::min(right_i, right_j);
+            const double scaling = right - left;
+            double temp_res = 0.0;
+            for (size_t c = 0; c < quadOrder; c++) {
+              const double x = left + scaling * coordinates[c];
+              temp_res += weights[c] * basis.eval(lik, iik, x) * basis.eval(ljk, ijk, x);
+            }
+            temp_ij *= scaling*temp_res;
           }
-          temp_ij *= scaling*temp_res;
         }
+        privateResult[i] += temp_ij * alpha[j];
+        if (i != j)
+          privateResult[j] += temp_ij * alpha[i];
       }
-      result[i] += temp_ij * alpha[j];
-      if (i != j)
-        result[j] += temp_ij * alpha[i];
     }
+
+#pragma omp critical
+    { result.add(privateResult); }
   }
 }
 }  // namespace pde
@@ -41,6 +41,40 @@ namespace pde {
     }
   }
 
+  BOOST_AUTO_TEST_CASE(testOperationLaplaceLinear) {
+    const size_t d = 4;
+    const size_t l = 4;
+    sgpp::base::Grid* grid(sgpp::base::Grid::createLinearGrid(d));
+    grid->getGenerator().regular(l);
+    sgpp::base::OperationMatrix* opExplicit =
+      sgpp::op_factory::createOperationLaplaceExplicit(*grid);
+    sgpp::base::OperationMatrix* opImplicit =
+      sgpp::op_factory::createOperationLaplace(*grid);
+
+    sgpp::base::DataVector alpha(grid->getSize());
+    sgpp::base::DataVector resultImplicit(grid->getSize());
+    sgpp::base::DataVector resultExplicit(grid->getSize());
+
+    for (size_t i = 0; i < grid->getSize(); i++) {
+      alpha[i] = static_cast<double>((i * 7) % 11) / 11.0 - 0.5;
+    }
+
+    opExplicit->mult(alpha, resultExplicit);
+
+    // the second application reuses the temporaries of the first one
+    for (size_t k = 0; k < 2; k++) {
+      opImplicit->mult(alpha, resultImplicit);
+
+      for (size_t i = 0; i < grid->getSize(); i++) {
+        BOOST_CHECK_SMALL(resultImplicit.get(i) - resultExplicit.get(i), 1e-12);
+      }
+    }
+
+    delete opImplicit;
+    delete opExplicit;
+    delete grid;
+  }
+
   BOOST_AUTO_TEST_CASE(testOperationLaplaceBsplineBoundary1D) {
     const size_t resolution = 10000;
     const size_t d = 1;
@@ -9,7 +9,11 @@
 #include <sgpp_base.hpp>
 #include <sgpp_pde.hpp>
 #include <sgpp/pde/operation/PdeOpFactory.hpp>
+#include <sgpp/pde/operation/hash/OperationMatrixLTwoDotExplicitLinear.hpp>
 #include <sgpp/globaldef.hpp>
+
+#include <memory>
+
 namespace sgpp {
 namespace pde {
 
@@ -80,6 +84,33 @@ BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitLinear) {
   delete opExplicit;
 }
 
+// test for blocks of the Linear matrix
+BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitLinearBounds) {
+  const size_t d = 3;
+  const size_t l = 4;
+  std::unique_ptr<sgpp::base::Grid> grid(sgpp::base::Grid::createLinearGrid(d));
+  grid->getGenerator().regular(l);
+  const size_t n = grid->getSize();
+
+  sgpp::base::DataMatrix m(n, n);
+  OperationMatrixLTwoDotExplicitLinear op;
+  op.buildMatrixWithBounds(&m, grid.get());
+
+  // blocks below, above and on the diagonal, including the first row and column
+  const size_t bounds[][4] = {{0, 7, 0, 5}, {3, 11, 0, 0}, {n / 2, n, 2, n / 3}, {5, 9, 5, 9}};
+  for (auto& b : bounds) {
+    size_t iEnd = b[1] == 0 ? n : b[1];
+    size_t jEnd = b[3] == 0 ? n : b[3];
+    sgpp::base::DataMatrix block(iEnd - b[0], jEnd - b[2]);
+    op.buildMatrixWithBounds(&block, grid.get(), b[0], b[1], b[2], b[3]);
+    for (size_t i = b[0]; i < iEnd; i++) {
+      for (size_t j = b[2]; j < jEnd; j++) {
+        BOOST_CHECK_EQUAL(block.get(i - b[0], j - b[2]), m.get(i, j));
+      }
+    }
+  }
+}
+
 // test for ModLinear
 BOOST_AUTO_TEST_CASE(testOperationMatrixLTwoDotExplicitModLinear) {
   const size_t d = 3;
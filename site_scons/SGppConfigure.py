@@ -119,6 +119,7 @@ def doConfigure(env, moduleFolders, languageWrapperFolders):
   checkOpenCL(config)
   detectGSL(config)
   detectZlib(config)
+  detectLAPACK(config)
   detectScaLAPACK(config)
   detectPythonAPI(config)
   checkDAKOTA(config)
@@ -632,6 +633,34 @@ def detectZlib(config):
   else:
     Helper.printInfo("ZLIB support could not be enabled.")
 
+def detectLAPACK(config):
+  if "LAPACK_LIBRARY_PATH" in config.env:
+    config.env.AppendUnique(LIBPATH=[config.env["LAPACK_LIBRARY_PATH"]])
+
+  # check if USE_LAPACK was given as parameter and is disabled
+  if "USE_LAPACK" in config.env and not config.env["USE_LAPACK"]:
+    Helper.printInfo("LAPACK disabled.")
+    return
+
+  if "LAPACK_LIBRARY_NAME" in config.env:
+    candidates = [[lib.strip() for lib in config.env["LAPACK_LIBRARY_NAME"].split(",")]]
+  else:
+    candidates = [["openblas"], ["mkl_rt"], ["lapack", "blas"]]
+
+  for libs in candidates:
+    if config.CheckLib(libs[0], "dpotrf_", language="c++", autoadd=0):
+      config.env["LAPACK_LIBS"] = libs
+      config.env["USE_LAPACK"] = True
+      config.env["CPPDEFINES"]["USE_LAPACK"] = "1"
+      Helper.printInfo("Using LAPACK/BLAS from " + ", ".join(libs))
+      return
+
+  if "USE_LAPACK" in config.env and config.env["USE_LAPACK"]:
+    Helper.printErrorAndExit("USE_LAPACK was set, but no LAPACK/BLAS library was found.")
+  else:
+    config.env["USE_LAPACK"] = False
+    Helper.printInfo("No LAPACK/BLAS library found, LAPACK support disabled.")
+
 def detectScaLAPACK(config):
   if "SCALAPACK_LIBRARY_PATH" in config.env:
     config.env.AppendUnique(LIBPATH=[config.env["SCALAPACK_LIBRARY_PATH"]])
@@ -0,0 +1,56 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/ODESolver.hpp>
+#include <sgpp/base/tools/SGppStopwatch.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+void ODESolver::resetTimestepHistory() {
+  numStoredSolutions = 0;
+  stepIterations.clear();
+  stepResiduums.clear();
+  stepSolveTimes.clear();
+}
+
+void ODESolver::solveTimestep(SLESolver& LinearSystemSolver,
+                              sgpp::solver::OperationParabolicPDESolverSystem& System,
+                              sgpp::base::DataVector& rhs, bool warmStart) {
+  sgpp::base::DataVector& alpha = *System.getGridCoefficientsForCG();
+  const size_t size = alpha.getSize();
+
+  // the grid may have changed in coarsenAndRefine, the history is useless then
+  if ((numStoredSolutions > 0) &&
+      ((lastSolution.getSize() != size) ||
+       ((numStoredSolutions > 1) && (secondLastSolution.getSize() != size)))) {
+    numStoredSolutions = 0;
+  }
+
+  if (warmStart && extrapolateInitialGuess && (numStoredSolutions == 2)) {
+    // alpha = 2 * u_n - u_(n-1), u_n is contained in alpha
+    for (size_t i = 0; i < size; i++) {
+      alpha[i] = 2.0 * lastSolution[i] - secondLastSolution[i];
+    }
+  }
+
+  sgpp::base::SGppStopwatch stopwatch;
+  stopwatch.start();
+  LinearSystemSolver.solve(System, alpha, rhs, true, false, -1.0);
+  stepSolveTimes.push_back(stopwatch.stop());
+  stepIterations.push_back(LinearSystemSolver.getNumberIterations());
+  stepResiduums.push_back(LinearSystemSolver.getResiduum());
+
+  if (warmStart) {
+    secondLastSolution.swap(lastSolution);
+    lastSolution = alpha;
+    numStoredSolutions = (numStoredSolutions < 2) ? (numStoredSolutions + 1) : 2;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -13,6 +13,8 @@
 #include <sgpp/solver/SGSolver.hpp>
 #include <sgpp/solver/SLESolver.hpp>
 
+#include <vector>
+
 #include <sgpp/globaldef.hpp>
 
 namespace sgpp {
@@ -26,7 +28,8 @@ class ODESolver : public SGSolver {
    * @param imax number of maximum executed iterations
    * @param timestepSize the size of one timestep
    */
-  ODESolver(size_t imax, double timestepSize) : SGSolver(imax, timestepSize) {}
+  ODESolver(size_t imax, double timestepSize)
+      : SGSolver(imax, timestepSize), extrapolateInitialGuess(true), numStoredSolutions(0) {}
 
   /**
    * Std-Destructor
@@ -46,6 +49,71 @@ class ODESolver : public SGSolver {
   virtual void solve(SLESolver& LinearSystemSolver,
                      sgpp::solver::OperationParabolicPDESolverSystem& System,
                      bool bIdentifyLastStep = false, bool verbose = false) = 0;
+
+  /**
+   * Enables or disables the extrapolation of the initial guess of the linear solver from the
+   * solutions of the two preceding timesteps (enabled by default). Only used by ODE solvers
+   * with fixed timesteps.
+   *
+   * @param extrapolate true to extrapolate the initial guess, false to start every solve from
+   * the solution of the last timestep
+   */
+  void setExtrapolateInitialGuess(bool extrapolate) { extrapolateInitialGuess = extrapolate; }
+
+  /**
+   * @return number of iterations of the linear solver in every solve of the last call of solve
+   */
+  const std::vector<size_t>& getStepIterations() const { return stepIterations; }
+
+  /**
+   * @return final residuum of the linear solver in every solve of the last call of solve
+   */
+  const std::vector<double>& getStepResiduums() const { return stepResiduums; }
+
+  /**
+   * @return wall clock time (in seconds) of every solve of the linear solver in the last call of
+   * solve
+   */
+  const std::vector<double>& getStepSolveTimes() const { return stepSolveTimes; }
+
+ protected:
+  /// extrapolate the initial guess of the linear solver from the last two timesteps
+  bool extrapolateInitialGuess;
+  /// solution of the last timestep
+  sgpp::base::DataVector lastSolution;
+  /// solution of the second to last timestep
+  sgpp::base::DataVector secondLastSolution;
+  /// number of stored solutions (0, 1 or 2)
+  size_t numStoredSolutions;
+  /// iterations of the linear solver per solve
+  std::vector<size_t> stepIterations;
+  /// final residuum of the linear solver per solve
+  std::vector<double> stepResiduums;
+  /// wall clock time of the linear solver per solve
+  std::vector<double> stepSolveTimes;
+
+  /**
+   * Resets the solution history and the per step statistics, has to be called at the beginning
+   * of solve.
+   */
+  void resetTimestepHistory();
+
+  /**
+   * Solves the system of linear equations of one timestep and records its costs.
+   * The solver is started from the current coefficients; if warmStart is set and the
+   * solutions of the two preceding timesteps are available on the same grid, the initial guess
+   * is extrapolated linearly from them instead. The System's operators and grids stay the
+   * same between timesteps, so this only changes the starting point of the iteration.
+   *
+   * @param LinearSystemSolver the linear solver
+   * @param System the system of the current timestep
+   * @param rhs the right hand side of the current timestep
+   * @param warmStart set to true to extrapolate the initial guess and to store the solution
+   * for the following timesteps
+   */
+  void solveTimestep(SLESolver& LinearSystemSolver,
+                     sgpp::solver::OperationParabolicPDESolverSystem& System,
+                     sgpp::base::DataVector& rhs, bool warmStart = false);
 };
 
 }  // namespace solver
@@ -29,6 +29,7 @@ void AdamsBashforth::solve(SLESolver& LinearSystemSolver,
                            sgpp::solver::OperationParabolicPDESolverSystem& System,
                            bool bIdentifyLastStep, bool verbose) {
   size_t allIter = 0;
+  this->resetTimestepHistory();
   sgpp::base::DataVector* rhs;
 
   for (size_t i = 0; i < this->nMaxIterations; i++) {
@@ -41,7 +42,7 @@ void AdamsBashforth::solve(SLESolver& LinearSystemSolver,
     rhs = System.generateRHS();
 
     // solve the system of the current timestep
-    LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+    this->solveTimestep(LinearSystemSolver, System, *rhs, true);
 
     allIter += LinearSystemSolver.getNumberIterations();
 
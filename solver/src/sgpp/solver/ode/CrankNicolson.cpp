@@ -23,6 +23,7 @@ void CrankNicolson::solve(SLESolver& LinearSystemSolver,
                           sgpp::solver::OperationParabolicPDESolverSystem& System,
                           bool bIdentifyLastStep, bool verbose) {
   size_t allIter = 0;
+  this->resetTimestepHistory();
   sgpp::base::DataVector* rhs = NULL;
 
   for (size_t i = 0; i < this->nMaxIterations; i++) {
@@ -30,7 +31,7 @@ void CrankNicolson::solve(SLESolver& LinearSystemSolver,
     rhs = System.generateRHS();
 
     // solve the system of the current timestep
-    LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+    this->solveTimestep(LinearSystemSolver, System, *rhs, true);
     allIter += LinearSystemSolver.getNumberIterations();
 
     if (verbose == true) {
@@ -37,6 +37,7 @@ void Euler::solve(SLESolver& LinearSystemSolver,
                   sgpp::solver::OperationParabolicPDESolverSystem& System, bool bIdentifyLastStep,
                   bool verbose) {
   size_t allIter = 0;
+  this->resetTimestepHistory();
   sgpp::base::DataVector* rhs;
 
   // Do some animation creation exception handling
@@ -66,7 +67,7 @@ void Euler::solve(SLESolver& LinearSystemSolver,
     rhs = System.generateRHS();
 
     // solve the system of the current timestep
-    LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+    this->solveTimestep(LinearSystemSolver, System, *rhs, true);
 
     allIter += LinearSystemSolver.getNumberIterations();
 
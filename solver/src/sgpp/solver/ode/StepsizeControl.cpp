@@ -95,6 +95,7 @@ void StepsizeControl::solve(SLESolver& LinearSystemSolver,
                             sgpp::solver::OperationParabolicPDESolverSystem& System,
                             bool bIdentifyLastStep, bool verbose) {
   size_t allIter = 0;
+  this->resetTimestepHistory();
   sgpp::base::DataVector* rhs;
   sgpp::base::DataVector YkAdBas(System.getGridCoefficients()->getSize());
   sgpp::base::DataVector YkImEul(System.getGridCoefficients()->getSize());
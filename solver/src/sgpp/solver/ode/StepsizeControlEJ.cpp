@@ -57,7 +57,7 @@ void StepsizeControlEJ::corrector(SLESolver& LinearSystemSolver,
   rhs = System.generateRHS();
 
   // solve the system of the current timestep
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  this->solveTimestep(LinearSystemSolver, System, *rhs);
 
   System.finishTimestep();
   dv.resize(System.getGridCoefficients()->getSize());
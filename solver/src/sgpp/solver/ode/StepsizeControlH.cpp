@@ -43,7 +43,7 @@ void StepsizeControlH::predictor(SLESolver& LinearSystemSolver,
   rhs = System.generateRHS();
 
   // solve the system of the current timesteps
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  this->solveTimestep(LinearSystemSolver, System, *rhs);
 
   System.finishTimestep();
 
@@ -64,12 +64,12 @@ void StepsizeControlH::corrector(SLESolver& LinearSystemSolver,
   rhs = System.generateRHS();
 
   // solve the system of the current timesteps
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  this->solveTimestep(LinearSystemSolver, System, *rhs);
   System.finishTimestep();
 
   rhs = System.generateRHS();
 
-  LinearSystemSolver.solve(System, *System.getGridCoefficientsForCG(), *rhs, true, false, -1.0);
+  this->solveTimestep(LinearSystemSolver, System, *rhs);
   System.finishTimestep();
 
   dv.resize(System.getGridCoefficients()->getSize());
@@ -0,0 +1,163 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <iostream>
+
+namespace sgpp {
+namespace solver {
+
+PipelinedConjugateGradients::PipelinedConjugateGradients(size_t imax, double epsilon)
+    : ConjugateGradients(imax, epsilon) {}
+
+PipelinedConjugateGradients::~PipelinedConjugateGradients() {}
+
+void PipelinedConjugateGradients::solve(sgpp::base::OperationMatrix& SystemMatrix,
+                                        sgpp::base::DataVector& alpha, sgpp::base::DataVector& b,
+                                        bool reuse, bool verbose, double max_threshold) {
+  this->starting();
+
+  if (verbose == true) {
+    std::cout << "Starting Pipelined Conjugated Gradients" << std::endl;
+  }
+
+  // needed for residuum calculation
+  double epsilonSquared = this->myEpsilon * this->myEpsilon;
+  // number off current iterations
+  this->nIterations = 0;
+
+  const size_t n = alpha.getSize();
+
+  // r: residual, w = A*r, z = A*s, s = A*p, q = A*w, p: search direction
+  sgpp::base::DataVector r(b);
+  sgpp::base::DataVector w(n);
+  sgpp::base::DataVector q(n);
+  sgpp::base::DataVector z(n, 0.0);
+  sgpp::base::DataVector s(n, 0.0);
+  sgpp::base::DataVector p(n, 0.0);
+  sgpp::base::DataVector temp(n);
+
+  double delta_0 = 0.0;
+
+  if (reuse == true) {
+    delta_0 = b.dotProduct(b) * epsilonSquared;
+  } else {
+    alpha.setAll(0.0);
+  }
+
+  // calculate the starting residuum
+  SystemMatrix.mult(alpha, temp);
+  r.sub(temp);
+  SystemMatrix.mult(r, w);
+
+  double gamma = r.dotProduct(r);
+  double delta = w.dotProduct(r);
+  double gamma_old = 0.0;
+  double a = 0.0;
+  double a_old = 0.0;
+  double beta = 0.0;
+
+  if (reuse == false) {
+    delta_0 = gamma * epsilonSquared;
+  }
+
+  this->residuum = (delta_0 / epsilonSquared);
+  this->calcStarting();
+
+  if (verbose == true) {
+    std::cout << "Starting norm of residuum: " << (delta_0 / epsilonSquared) << std::endl;
+    std::cout << "Target norm:               " << (delta_0) << std::endl;
+  }
+
+  double* x_ = alpha.getPointer();
+  double* r_ = r.getPointer();
+  double* w_ = w.getPointer();
+  double* q_ = q.getPointer();
+  double* z_ = z.getPointer();
+  double* s_ = s.getPointer();
+  double* p_ = p.getPointer();
+
+  while ((this->nIterations < this->nMaxIterations) && (gamma > delta_0) &&
+         (gamma > max_threshold)) {
+    // q = A*w, does not depend on the reduction of this iteration's inner products
+    SystemMatrix.mult(w, q);
+
+    if (this->nIterations == 0) {
+      beta = 0.0;
+
+      if (delta == 0.0) {
+        break;
+      }
+
+      a = gamma / delta;
+    } else {
+      beta = gamma / gamma_old;
+      double denominator = delta - beta * gamma / a_old;
+
+      if (denominator == 0.0) {
+        break;
+      }
+
+      a = gamma / denominator;
+    }
+
+    // fused vector updates and inner products of the next iteration
+    double gamma_new = 0.0;
+    double delta_new = 0.0;
+
+#pragma omp parallel for reduction(+ : gamma_new, delta_new)
+    for (size_t i = 0; i < n; i++) {
+      z_[i] = q_[i] + beta * z_[i];
+      s_[i] = w_[i] + beta * s_[i];
+      p_[i] = r_[i] + beta * p_[i];
+      x_[i] += a * p_[i];
+      r_[i] -= a * s_[i];
+      w_[i] -= a * z_[i];
+      gamma_new += r_[i] * r_[i];
+      delta_new += w_[i] * r_[i];
+    }
+
+    // residual replacement to limit the drift of the recurrences
+    if (((this->nIterations + 1) % 50) == 0) {
+      SystemMatrix.mult(alpha, temp);
+      r.copyFrom(b);
+      r.sub(temp);
+      SystemMatrix.mult(r, w);
+      SystemMatrix.mult(p, s);
+      SystemMatrix.mult(s, z);
+      gamma_new = r.dotProduct(r);
+      delta_new = w.dotProduct(r);
+    }
+
+    gamma_old = gamma;
+    a_old = a;
+    gamma = gamma_new;
+    delta = delta_new;
+
+    this->residuum = gamma;
+    this->iterationComplete();
+
+    if (verbose == true) {
+      std::cout << "delta: " << gamma << std::endl;
+    }
+
+    this->nIterations++;
+  }
+
+  this->residuum = gamma;
+  this->complete();
+
+  if (verbose == true) {
+    std::cout << "Number of iterations: " << this->nIterations << " (max. " << this->nMaxIterations
+              << ")" << std::endl;
+    std::cout << "Final norm of residuum: " << gamma << std::endl;
+  }
+}
+
+}  // namespace solver
+}  // namespace sgpp
@@ -0,0 +1,54 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+
+#ifndef PIPELINEDCONJUGATEGRADIENTS_HPP
+#define PIPELINEDCONJUGATEGRADIENTS_HPP
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+namespace sgpp {
+namespace solver {
+
+/**
+ * Pipelined variant of the method of conjugate gradients (P. Ghysels and W. Vanroose,
+ * "Hiding global synchronization latency in the preconditioned Conjugate Gradient algorithm",
+ * Parallel Computing 40, 2014).
+ *
+ * Mathematically equivalent to ConjugateGradients, but both inner products of an iteration
+ * are computed in a single fused reduction that does not depend on the result of the
+ * iteration's matrix vector product, and all vector updates are fused into one pass over the
+ * data. This removes one of the two synchronization points per iteration and halves the
+ * memory traffic of the vector operations at the price of three additional vectors and a
+ * slightly weaker numerical stability, which is countered by recomputing the residual every
+ * 50 iterations.
+ */
+class PipelinedConjugateGradients : public ConjugateGradients {
+ public:
+  /**
+   * Std-Constructor
+   *
+   * @param imax number of maximum executed iterations
+   * @param epsilon the final error in the iterative solver
+   */
+  PipelinedConjugateGradients(size_t imax, double epsilon);
+
+  /**
+   * Std-Destructor
+   */
+  ~PipelinedConjugateGradients() override;
+
+  void solve(sgpp::base::OperationMatrix& SystemMatrix, sgpp::base::DataVector& alpha,
+             sgpp::base::DataVector& b, bool reuse = false, bool verbose = false,
+             double max_threshold = -1.0) override;
+};
+
+}  // namespace solver
+}  // namespace sgpp
+
+#endif /* PIPELINEDCONJUGATEGRADIENTS_HPP */
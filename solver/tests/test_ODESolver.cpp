@@ -0,0 +1,114 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/solver/ode/CrankNicolson.hpp>
+#include <sgpp/solver/operation/hash/OperationParabolicPDESolverSystem.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+#include <numeric>
+
+using sgpp::base::DataVector;
+
+namespace {
+
+/**
+ * Crank-Nicolson system of the 1D heat equation u' = -K u discretized by finite
+ * differences, K = tridiag(-1, 2, -1) / h^2 (homogeneous Dirichlet boundaries).
+ */
+class FiniteDifferenceHeatSystem : public sgpp::solver::OperationParabolicPDESolverSystem {
+ public:
+  FiniteDifferenceHeatSystem(DataVector& u, double timestepSize) {
+    this->alpha_complete = &u;
+    this->TimestepSize = timestepSize;
+    this->rhs = new DataVector(u.getSize());
+    this->tOperationMode = "CrNic";
+  }
+
+  ~FiniteDifferenceHeatSystem() override { delete this->rhs; }
+
+  void mult(DataVector& alpha, DataVector& result) override {
+    applyK(alpha, result);
+    result.mult(0.5 * this->TimestepSize);
+    result.add(alpha);
+  }
+
+  DataVector* generateRHS() override {
+    applyK(*this->alpha_complete, *this->rhs);
+    this->rhs->mult(-0.5 * this->TimestepSize);
+    this->rhs->add(*this->alpha_complete);
+    return this->rhs;
+  }
+
+  void finishTimestep() override {}
+  void coarsenAndRefine(bool isLastTimestep) override {}
+  void startTimestep() override {}
+  DataVector* getGridCoefficientsForCG() override { return this->alpha_complete; }
+
+ private:
+  void applyK(const DataVector& x, DataVector& y) {
+    const size_t n = x.getSize();
+    const double h = 1.0 / static_cast<double>(n + 1);
+
+    for (size_t i = 0; i < n; i++) {
+      double v = 2.0 * x[i];
+
+      if (i > 0) v -= x[i - 1];
+      if (i + 1 < n) v -= x[i + 1];
+
+      y[i] = v / (h * h);
+    }
+  }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestODESolver)
+
+BOOST_AUTO_TEST_CASE(testCrankNicolsonExtrapolatedInitialGuess) {
+  const size_t n = 255;
+  const size_t numTimesteps = 20;
+  const double timestepSize = 1e-5;
+
+  DataVector initial(n);
+
+  for (size_t i = 0; i < n; i++) {
+    const double x = static_cast<double>(i + 1) / static_cast<double>(n + 1);
+    initial[i] = (x < 0.3) ? (x / 0.3) : ((1.0 - x) / 0.7);
+  }
+
+  size_t totalIterations[2];
+  DataVector solutions[2] = {initial, initial};
+
+  for (size_t k = 0; k < 2; k++) {
+    FiniteDifferenceHeatSystem system(solutions[k], timestepSize);
+    sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+    sgpp::solver::CrankNicolson cn(numTimesteps, timestepSize);
+    cn.setExtrapolateInitialGuess(k == 1);
+    cn.solve(cg, system);
+
+    const std::vector<size_t>& iterations = cn.getStepIterations();
+    BOOST_CHECK_EQUAL(iterations.size(), numTimesteps);
+    BOOST_CHECK_EQUAL(cn.getStepSolveTimes().size(), numTimesteps);
+    BOOST_CHECK_EQUAL(cn.getStepResiduums().size(), numTimesteps);
+    totalIterations[k] = std::accumulate(iterations.begin(), iterations.end(), size_t(0));
+    BOOST_CHECK_EQUAL(totalIterations[k], cn.getNumberIterations());
+  }
+
+  // warm-started solves have to reach the same solution with fewer iterations
+  for (size_t i = 0; i < n; i++) {
+    BOOST_CHECK_SMALL(solutions[0][i] - solutions[1][i], 1e-8);
+  }
+
+  BOOST_CHECK_LT(totalIterations[1], totalIterations[0]);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,79 @@
+// Copyright (C) 2008-today The SG++ project
+// This file is part of the SG++ project. For conditions of distribution and
+// use, please see the copyright notice provided with SG++ or at
+// sgpp.sparsegrids.org
+#define BOOST_TEST_DYN_LINK
+
+#include <boost/test/unit_test.hpp>
+
+#include <sgpp/base/datatypes/DataVector.hpp>
+#include <sgpp/base/operation/hash/OperationMatrix.hpp>
+#include <sgpp/solver/sle/ConjugateGradients.hpp>
+#include <sgpp/solver/sle/PipelinedConjugateGradients.hpp>
+
+#include <sgpp/globaldef.hpp>
+
+#include <cmath>
+
+using sgpp::base::DataVector;
+
+namespace {
+
+/**
+ * symmetric positive definite test matrix: shifted 1D finite difference Laplacian with
+ * varying diagonal
+ */
+class TridiagonalMatrix : public sgpp::base::OperationMatrix {
+ public:
+  void mult(DataVector& alpha, DataVector& result) override {
+    const size_t n = alpha.getSize();
+
+    for (size_t i = 0; i < n; i++) {
+      double v = (2.0 + 1e-2 * static_cast<double>(i % 7)) * alpha[i];
+
+      if (i > 0) v -= alpha[i - 1];
+      if (i + 1 < n) v -= alpha[i + 1];
+
+      result[i] = v;
+    }
+  }
+};
+
+}  // namespace
+
+BOOST_AUTO_TEST_SUITE(TestPipelinedConjugateGradients)
+
+BOOST_AUTO_TEST_CASE(testPipelinedEqualsStandardCG) {
+  const size_t n = 400;
+  TridiagonalMatrix A;
+  DataVector b(n);
+
+  for (size_t i = 0; i < n; i++) {
+    b[i] = std::sin(0.1 * static_cast<double>(i)) + 1.0;
+  }
+
+  for (bool reuse : {false, true}) {
+    DataVector xCG(n, 0.1);
+    DataVector xPCG(n, 0.1);
+
+    sgpp::solver::ConjugateGradients cg(1000, 1e-10);
+    sgpp::solver::PipelinedConjugateGradients pcg(1000, 1e-10);
+    cg.solve(A, xCG, b, reuse);
+    pcg.solve(A, xPCG, b, reuse);
+
+    // more than 50 iterations are needed, so the residual replacement is tested as well
+    BOOST_CHECK_GT(pcg.getNumberIterations(), 50);
+    BOOST_CHECK_LE(pcg.getNumberIterations(), cg.getNumberIterations() + 5);
+
+    DataVector residual(n);
+    A.mult(xPCG, residual);
+    residual.sub(b);
+    BOOST_CHECK_SMALL(residual.l2Norm() / b.l2Norm(), 1e-8);
+
+    for (size_t i = 0; i < n; i++) {
+      BOOST_CHECK_SMALL(xCG[i] - xPCG[i], 1e-6);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()